@@ -98,6 +98,9 @@ void lse_core_export_namespace(napi_env env, napi_value exports, const char* ns,
 #define JS_ENV_NEW_INSTANCE "$newInstance"
 #define JS_ENV_CONFIGURE "$configure"
 #define JS_ENV_UPDATE "$update"
+#define JS_ENV_GET_FRAME_STATS "$getFrameStats"
+#define JS_ENV_GET_FRAME_DELAY "$getFrameDelay"
+#define JS_ENV_GET_IMAGE_CACHE_STATS "$getImageCacheStats"
 #define JS_ENV_DESTROY "$destroy"
 #define JS_ENV_ADD_WINDOW "$addWindow"
 #define JS_ENV_REMOVE_WINDOW "$removeWindow"
@@ -137,6 +140,15 @@ void lse_core_export_namespace(napi_env env, napi_value exports, const char* ns,
 #define JS_WINDOW_GET_FLAGS "$getFlags"
 #define JS_WINDOW_CREATE_NODE "$createNode"
 #define JS_WINDOW_ADD_IMAGE "$addImage"
+#define JS_WINDOW_GET_SKIPPED_FRAME_COUNT "$getSkippedFrameCount"
+#define JS_WINDOW_GET_DRAW_CALL_COUNT "$getDrawCallCount"
+#define JS_WINDOW_GET_CULLED_NODE_COUNT "$getCulledNodeCount"
+#define JS_WINDOW_GET_RENDER_STATS "$getRenderStats"
+#define JS_WINDOW_BEGIN_BATCH "$beginBatch"
+#define JS_WINDOW_END_BATCH "$endBatch"
+#define JS_WINDOW_ANIMATE "$animate"
+#define JS_WINDOW_CANCEL_ANIMATION "$cancelAnimation"
+#define JS_WINDOW_IS_ANIMATING "$isAnimating"
 
 // ////////////////////////////////////////////////////////////////////////////
 // style constants
@@ -17,6 +17,7 @@
 #include <lse_style_meta.h>
 #include <lse_types.h>
 #include <stc/ccommon.h>
+#include <string.h>
 
 static napi_ref s_gamepad_status_ref = NULL;
 static napi_ref s_gamepad_button_ref = NULL;
@@ -51,9 +52,12 @@ JS_CALLBACK(configure) {
   JS_METHOD_SIG(lse_env, 1)
 
   lse_settings settings = lse_settings_init();
+  char buffer[16];
   napi_value mock = napix_get_own_property(env, argv[0], "mock");
   napi_value sdl = napix_get_own_property(env, argv[0], "sdl");
   napi_value sdl_mixer = napix_get_own_property(env, argv[0], "sdl_mixer");
+  napi_value render = napix_get_own_property(env, argv[0], "render");
+  napi_value vsync;
 
   if (napix_type_of(env, mock) == napi_object) {
     settings.mock_settings.enabled = napix_obj_get_boolean(env, mock, "enabled", false);
@@ -67,6 +71,36 @@ JS_CALLBACK(configure) {
     settings.sdl_mixer_settings.enabled = napix_obj_get_boolean(env, sdl_mixer, "enabled", true);
   }
 
+  if (napix_type_of(env, render) == napi_object) {
+    settings.render_settings.partial_redraw = napix_obj_get_boolean(env, render, "partialRedraw", false);
+    settings.render_settings.show_redraw_regions = napix_obj_get_boolean(env, render, "showRedrawRegions", false);
+    settings.render_settings.batch_geometry = napix_obj_get_boolean(env, render, "batchGeometry", true);
+    settings.render_settings.fps_limit = napix_obj_get_i(env, render, "fpsLimit", 0);
+    settings.render_settings.image_cache_budget = napix_obj_get_i(
+        env, render, "imageCacheBudget", (int32_t)settings.render_settings.image_cache_budget);
+    settings.render_settings.image_store_budget = napix_obj_get_i(
+        env, render, "imageStoreBudget", (int32_t)settings.render_settings.image_store_budget);
+
+    vsync = napix_get_own_property(env, render, "vsync");
+
+    if (!napix_is_nullish(env, vsync)) {
+      // non-strings and strings too long for the buffer read as empty, an unknown mode
+      if (!napix_read_string(env, vsync, buffer, sizeof(buffer))) {
+        buffer[0] = '\0';
+      }
+
+      if (strcmp("on", buffer) == 0) {
+        settings.render_settings.vsync = LSE_VSYNC_MODE_ON;
+      } else if (strcmp("off", buffer) == 0) {
+        settings.render_settings.vsync = LSE_VSYNC_MODE_OFF;
+      } else if (strcmp("adaptive", buffer) == 0) {
+        settings.render_settings.vsync = LSE_VSYNC_MODE_ADAPTIVE;
+      } else {
+        return lse_core_throw_error(env, LSE_ERR_ILLEGAL_ARGUMENT);
+      }
+    }
+  }
+
   lse_status status = lse_env_configure(self, &settings);
 
   LSE_CORE_CHECK_STATUS(env, status);
@@ -216,6 +250,56 @@ JS_CALLBACK(update) {
   return napix_get_boolean(env, !lse_env_has_quit_request(self));
 }
 
+JS_CALLBACK(get_frame_stats) {
+  JS_METHOD_SIG_NO_ARGS(lse_env)
+
+  lse_frame_stats stats;
+  // [frame_count, idle_frame_count, then min, avg, p99 of each phase in lse_frame_phase order]
+  napi_value out = napix_create_array(env, 2 + LSE_FRAME_PHASE_COUNT * 3);
+  uint32_t index = 0;
+
+  lse_env_get_frame_stats(self, &stats);
+
+  napi_set_element(env, out, index++, napix_create_uint32(env, stats.frame_count));
+  napi_set_element(env, out, index++, napix_create_double(env, (double)stats.idle_frame_count));
+
+  for (int32_t i = 0; i < LSE_FRAME_PHASE_COUNT; i++) {
+    napi_set_element(env, out, index++, napix_create_float(env, stats.phases[i].min));
+    napi_set_element(env, out, index++, napix_create_float(env, stats.phases[i].avg));
+    napi_set_element(env, out, index++, napix_create_float(env, stats.phases[i].p99));
+  }
+
+  return out;
+}
+
+JS_CALLBACK(get_frame_delay) {
+  JS_METHOD_SIG_NO_ARGS(lse_env)
+
+  return napix_create_double(env, lse_env_get_frame_delay(self));
+}
+
+JS_CALLBACK(get_image_cache_stats) {
+  JS_METHOD_SIG_NO_ARGS(lse_env)
+
+  lse_image_cache_stats stats;
+  // field order of lse_image_cache_stats
+  napi_value out = napix_create_array(env, 9);
+
+  lse_env_get_image_cache_stats(self, &stats);
+
+  napi_set_element(env, out, 0, napix_create_int32(env, stats.image_count));
+  napi_set_element(env, out, 1, napix_create_double(env, (double)stats.resident_bytes));
+  napi_set_element(env, out, 2, napix_create_double(env, (double)stats.budget_bytes));
+  napi_set_element(env, out, 3, napix_create_double(env, (double)stats.evictions));
+  napi_set_element(env, out, 4, napix_create_int32(env, stats.retained_count));
+  napi_set_element(env, out, 5, napix_create_double(env, (double)stats.retained_bytes));
+  napi_set_element(env, out, 6, napix_create_double(env, (double)stats.hits));
+  napi_set_element(env, out, 7, napix_create_double(env, (double)stats.misses));
+  napi_set_element(env, out, 8, napix_create_double(env, (double)stats.retained_evictions));
+
+  return out;
+}
+
 JS_CALLBACK(add_window) {
   JS_METHOD_SIG_NO_ARGS(lse_env)
   return lse_core_class_new_with_object(env, lse_window_type, (lse_object*)lse_env_add_window(self));
@@ -446,6 +530,9 @@ void lse_core_env_init(napi_env env, napi_value exports) {
   lse_add_function(&ns, JS_ENV_CONFIGURE, &configure);
   lse_add_function(&ns, JS_ENV_DESTROY, &destroy);
   lse_add_function(&ns, JS_ENV_UPDATE, &update);
+  lse_add_function(&ns, JS_ENV_GET_FRAME_STATS, &get_frame_stats);
+  lse_add_function(&ns, JS_ENV_GET_FRAME_DELAY, &get_frame_delay);
+  lse_add_function(&ns, JS_ENV_GET_IMAGE_CACHE_STATS, &get_image_cache_stats);
   lse_add_function(&ns, JS_ENV_ADD_WINDOW, &add_window);
   lse_add_function(&ns, JS_ENV_REMOVE_WINDOW, &remove_window);
   lse_add_function(&ns, JS_ENV_GET_DISPLAY_NAME, &get_display_name);
@@ -660,6 +660,23 @@ static napi_value nsnode_setText(napi_env env, napi_callback_info info) {
   return lse_core_box_bool(env, result);
 }
 
+static napi_value nsnode_setDecodeSize(napi_env env, napi_callback_info info) {
+  lse_node* self;
+  napi_value args[3];
+
+  if (!lse_core_get_cb_info(env, info, (void**)&self, lse_node_interface_type, true, args, c_arraylen(args))) {
+    return JS_UNDEFINED;
+  }
+
+  lse_node_set_decode_size(
+    lse_core_unbox_self(env, args[0]),
+    lse_core_unbox_int(env, args[1]),
+    lse_core_unbox_int(env, args[2])
+  );
+
+  return JS_UNDEFINED;
+}
+
 void lse_core_exports(napi_env env, napi_value exports) {
   lse_function nsglobal[] = {
     { "bind", &nsglobal_bind },
@@ -710,6 +727,7 @@ void lse_core_exports(napi_env env, napi_value exports) {
     { "destroy", &nsnode_destroy },
     { "setSource", &nsnode_setSource },
     { "setText", &nsnode_setText },
+    { "setDecodeSize", &nsnode_setDecodeSize },
   };
 
   lse_core_export_namespace(env, exports, "nsglobal", nsglobal, c_arraylen(nsglobal));
@@ -82,12 +82,22 @@ static lse_thread_pool_task* queue(
     lse_thread_pool_user_data_finalize user_data_finalize) {
   if (!thread_pool_is_connected(pool)) {
     // TODO: log warning
+    // the pool owns user_data, even when the task is not queued
+    if (user_data && user_data_finalize) {
+      user_data_finalize(user_data);
+    }
+
     return NULL;
   }
 
   napi_async_work async_work;
   lse_thread_pool_task* task = thread_pool_task_new(pool);
 
+  task->user_data = user_data;
+  task->user_data_finalize = user_data_finalize;
+  task->work = thread_pool_work;
+  task->complete = thread_pool_complete;
+
   if (napi_create_async_work(
           pool->js_env, NULL, napix_create_string(pool->js_env, resource_name), &work, &complete, task, &async_work) !=
       napi_ok) {
@@ -97,10 +107,6 @@ static lse_thread_pool_task* queue(
   }
 
   task->async = async_work;
-  task->user_data = user_data;
-  task->user_data_finalize = user_data_finalize;
-  task->work = thread_pool_work;
-  task->complete = thread_pool_complete;
 
   if (napi_queue_async_work(pool->js_env, async_work) != napi_ok) {
     // TODO: log error
@@ -14,6 +14,7 @@
 #include "lse_core.h"
 
 #include "napix.h"
+#include <lse_animation.h>
 #include "string.h"
 
 static lse_window_settings parse_window_settings(napi_env env, napi_value value);
@@ -78,6 +79,102 @@ JS_CALLBACK(get_flags) {
   return napix_create_uint32(env, lse_window_get_flags(self));
 }
 
+JS_CALLBACK(get_skipped_frame_count) {
+  JS_METHOD_SIG_NO_ARGS(lse_window)
+  return napix_create_double(env, (double)lse_window_get_skipped_frame_count(self));
+}
+
+JS_CALLBACK(get_draw_call_count) {
+  JS_METHOD_SIG_NO_ARGS(lse_window)
+  return napix_create_uint32(env, lse_window_get_draw_call_count(self));
+}
+
+JS_CALLBACK(get_culled_node_count) {
+  JS_METHOD_SIG_NO_ARGS(lse_window)
+  return napix_create_uint32(env, lse_window_get_culled_node_count(self));
+}
+
+JS_CALLBACK(get_render_stats) {
+  JS_METHOD_SIG(lse_window, 1)
+
+  lse_render_stats stats;
+  // field order of lse_render_stats
+  napi_value out = napix_create_array(env, 12);
+
+  lse_window_get_render_stats(self, napix_as_boolean(env, argv[0], false), &stats);
+
+  napi_set_element(env, out, 0, napix_create_double(env, (double)stats.draw_calls));
+  napi_set_element(env, out, 1, napix_create_double(env, (double)stats.render_target_changes));
+  napi_set_element(env, out, 2, napix_create_double(env, (double)stats.textures_created));
+  napi_set_element(env, out, 3, napix_create_double(env, (double)stats.textures_destroyed));
+  napi_set_element(env, out, 4, napix_create_double(env, (double)stats.bytes_uploaded));
+  napi_set_element(env, out, 5, napix_create_double(env, (double)stats.color_mod_changes));
+  napi_set_element(env, out, 6, napix_create_double(env, (double)stats.alpha_mod_changes));
+  napi_set_element(env, out, 7, napix_create_double(env, (double)stats.clip_rect_changes));
+  napi_set_element(env, out, 8, napix_create_double(env, (double)stats.image_cache_evictions));
+  napi_set_element(env, out, 9, napix_create_int32(env, stats.image_cache_count));
+  napi_set_element(env, out, 10, napix_create_double(env, (double)stats.image_cache_bytes));
+  napi_set_element(env, out, 11, napix_create_int32(env, stats.render_object_count));
+
+  return out;
+}
+
+JS_CALLBACK(begin_batch) {
+  JS_METHOD_SIG_NO_ARGS(lse_window)
+  lse_window_begin_batch(self);
+  return JS_UNDEFINED;
+}
+
+JS_CALLBACK(end_batch) {
+  JS_METHOD_SIG_NO_ARGS(lse_window)
+  lse_window_end_batch(self);
+  return JS_UNDEFINED;
+}
+
+JS_CALLBACK(animate) {
+  JS_METHOD_SIG(lse_window, 8)
+
+  lse_node* node = (lse_node*)lse_core_unwrap(env, argv[0]);
+  lse_style* keyframes[LSE_ANIMATION_MAX_KEYFRAMES];
+  float offsets[LSE_ANIMATION_MAX_KEYFRAMES];
+  bool has_offsets = !napix_is_nullish(env, argv[2]);
+  uint32_t count = 0;
+  lse_animation_settings settings = {
+    .duration = napix_unbox_f(env, argv[3], 0),
+    .delay = napix_unbox_f(env, argv[4], 0),
+    .iterations = napix_unbox_i(env, argv[5], 1),
+    .alternate = napix_as_boolean(env, argv[6], false),
+    .easing = (lse_animation_easing)napix_unbox_i(env, argv[7], LSE_ANIMATION_EASING_LINEAR),
+  };
+
+  if (!node || napi_get_array_length(env, argv[1], &count) != napi_ok || count == 0
+      || count > LSE_ANIMATION_MAX_KEYFRAMES) {
+    return lse_core_throw_error(env, LSE_ERR_ILLEGAL_ARGUMENT);
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    keyframes[i] = (lse_style*)lse_core_unwrap(env, napix_get_element(env, argv[1], i));
+    offsets[i] = has_offsets ? napix_get_element_f(env, argv[2], i, 0) : 0;
+
+    if (!keyframes[i]) {
+      return lse_core_throw_error(env, LSE_ERR_ILLEGAL_ARGUMENT);
+    }
+  }
+
+  return napix_create_int32(
+      env, lse_window_animate(self, node, keyframes, has_offsets ? offsets : NULL, count, &settings));
+}
+
+JS_CALLBACK(cancel_animation) {
+  JS_METHOD_SIG(lse_window, 1)
+  return napix_get_boolean(env, lse_window_cancel_animation(self, napix_unbox_i(env, argv[0], 0)));
+}
+
+JS_CALLBACK(is_animating) {
+  JS_METHOD_SIG(lse_window, 1)
+  return napix_get_boolean(env, lse_window_is_animating(self, napix_unbox_i(env, argv[0], 0)));
+}
+
 JS_CALLBACK(create_node) {
   JS_METHOD_SIG(lse_window, 1)
   char tag[12];
@@ -113,6 +210,15 @@ void lse_core_window_init(napi_env env, napi_value exports) {
   lse_add_function(&ns, JS_WINDOW_GET_FLAGS, &get_flags);
   lse_add_function(&ns, JS_WINDOW_CREATE_NODE, &create_node);
   lse_add_function(&ns, JS_WINDOW_ADD_IMAGE, &add_image);
+  lse_add_function(&ns, JS_WINDOW_GET_SKIPPED_FRAME_COUNT, &get_skipped_frame_count);
+  lse_add_function(&ns, JS_WINDOW_GET_DRAW_CALL_COUNT, &get_draw_call_count);
+  lse_add_function(&ns, JS_WINDOW_GET_CULLED_NODE_COUNT, &get_culled_node_count);
+  lse_add_function(&ns, JS_WINDOW_GET_RENDER_STATS, &get_render_stats);
+  lse_add_function(&ns, JS_WINDOW_BEGIN_BATCH, &begin_batch);
+  lse_add_function(&ns, JS_WINDOW_END_BATCH, &end_batch);
+  lse_add_function(&ns, JS_WINDOW_ANIMATE, &animate);
+  lse_add_function(&ns, JS_WINDOW_CANCEL_ANIMATION, &cancel_animation);
+  lse_add_function(&ns, JS_WINDOW_IS_ANIMATING, &is_animating);
 }
 
 static lse_window_settings parse_window_settings(napi_env env, napi_value value) {
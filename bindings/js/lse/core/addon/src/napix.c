@@ -39,6 +39,12 @@ napi_value napix_create_float(napi_env env, float value) {
   return napi_create_double(env, value, &obj) == napi_ok ? obj : NULL;
 }
 
+napi_value napix_create_double(napi_env env, double value) {
+  napi_value obj;
+
+  return napi_create_double(env, value, &obj) == napi_ok ? obj : NULL;
+}
+
 napi_value napix_create_uint32(napi_env env, uint32_t value) {
   napi_value obj;
 
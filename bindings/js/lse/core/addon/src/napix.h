@@ -34,6 +34,7 @@ bool napix_is_nullish(napi_env env, napi_value value);
 
 napi_value napix_create_int32(napi_env env, int32_t value);
 napi_value napix_create_float(napi_env env, float value);
+napi_value napix_create_double(napi_env env, double value);
 napi_value napix_create_uint32(napi_env env, uint32_t value);
 napi_value napix_create_string(napi_env env, const char* utf8);
 napi_value napix_create_object(napi_env env);
@@ -20,10 +20,28 @@ import { performance } from 'perf_hooks'
 
 const { now } = performance
 
+// order of lse_frame_phase
+const kFramePhases = [
+  'frame',
+  'events',
+  'layout',
+  'resolve',
+  'paint',
+  'paintBox',
+  'paintImage',
+  'paintText',
+  'composite',
+  'upload',
+  'present'
+]
+
 const {
   $configure,
   $destroy,
   $update,
+  $getFrameStats,
+  $getFrameDelay,
+  $getImageCacheStats,
   $getVideoDrivers,
   $getDisplayCount,
   $getRenderers,
@@ -70,7 +88,9 @@ export class Env extends EventEmitter {
 
     let lastTick = now()
 
-    this.#mainLoopId = setInterval(() => {
+    // the native frame pacer decides when the next frame starts: aligned to the display refresh with vsync, or on
+    // fixed deadlines at the fps limit without
+    const frame = () => {
       // TODO: check init
       // TODO: reset windows
 
@@ -82,12 +102,16 @@ export class Env extends EventEmitter {
 
       if (!$update(this)) {
         this.destroy()
+      } else {
+        this.#mainLoopId = setTimeout(frame, $getFrameDelay(this))
       }
-    }, 1000 / 60)
+    }
+
+    this.#mainLoopId = setTimeout(frame, 0)
   }
 
   destroy () {
-    clearInterval(this.#mainLoopId)
+    clearTimeout(this.#mainLoopId)
     this.#mainLoopId = null
 
     this.emitEvent({ $type: $EventBeforeDestroy, env: this })
@@ -135,6 +159,46 @@ export class Env extends EventEmitter {
     return result
   }
 
+  /**
+   * Timings of the most recent frames, in milliseconds.
+   *
+   * Each phase of a frame (frame, events, layout, resolve, paint, paintBox, paintImage, paintText, composite, upload
+   * and present) has min, avg and p99 values. paintBox, paintImage and paintText are the parts of paint spent in nodes
+   * of that type. frameCount is the number of frames the values were computed from. idleFrameCount is the number of
+   * frames where no window had anything to draw; they are left out of the values.
+   */
+  get frameStats () {
+    const values = $getFrameStats(this)
+    const stats = { frameCount: values[0], idleFrameCount: values[1] }
+    let index = 2
+
+    for (const phase of kFramePhases) {
+      stats[phase] = { min: values[index++], avg: values[index++], p99: values[index++] }
+    }
+
+    return stats
+  }
+
+  /**
+   * Image textures resident in the graphics backends of all windows.
+   *
+   * When resident bytes exceed the per window budget (render.imageCacheBudget setting), textures of images that have
+   * not been drawn recently are evicted. An evicted image is decoded and uploaded again the next time it is drawn.
+   *
+   * Released images are retained up to the render.imageStoreBudget setting, so a uri used again soon after its last
+   * use is not decoded again. hits counts image loads served without decoding and misses counts loads that decoded.
+   */
+  get imageCacheStats () {
+    const [
+      imageCount, residentBytes, budgetBytes, evictions,
+      retainedCount, retainedBytes, hits, misses, retainedEvictions
+    ] = $getImageCacheStats(this)
+
+    return {
+      imageCount, residentBytes, budgetBytes, evictions, retainedCount, retainedBytes, hits, misses, retainedEvictions
+    }
+  }
+
   get fonts () {
     return [...this.#fonts]
   }
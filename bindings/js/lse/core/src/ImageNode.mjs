@@ -14,10 +14,12 @@
 import { Node } from './Node.mjs'
 import { nsnode } from './addon.mjs'
 
-const { setSource } = nsnode
+const { setSource, setDecodeSize } = nsnode
 
 export class ImageNode extends Node {
   #src = ''
+  #decodeWidth = 0
+  #decodeHeight = 0
 
   get tag () {
     return 'img'
@@ -40,4 +42,31 @@ export class ImageNode extends Node {
       this.#src = value
     }
   }
+
+  /**
+   * Width, in px, to decode the image at. If decodeWidth or decodeHeight is 0 (the default), the image is decoded for
+   * the size of the node.
+   */
+  get decodeWidth () {
+    return this.#decodeWidth
+  }
+
+  set decodeWidth (value) {
+    this.#decodeWidth = toDecodeDimension(value)
+    setDecodeSize(this, this.#decodeWidth, this.#decodeHeight)
+  }
+
+  /**
+   * Height, in px, to decode the image at. See decodeWidth.
+   */
+  get decodeHeight () {
+    return this.#decodeHeight
+  }
+
+  set decodeHeight (value) {
+    this.#decodeHeight = toDecodeDimension(value)
+    setDecodeSize(this, this.#decodeWidth, this.#decodeHeight)
+  }
 }
+
+const toDecodeDimension = (value) => Number.isFinite(value) && value > 0 ? Math.ceil(value) : 0
@@ -588,4 +588,12 @@ export class Style {
     $set(this, 70, value)
   }
 
+  get willChange () {
+    return $get(this, 71)
+  }
+
+  set willChange (value) {
+    $set(this, 71, value)
+  }
+
 }
@@ -17,7 +17,57 @@ import { EventEmitter } from './EventEmitter.mjs'
 import { $EventAfterDestroy, $EventBeforeDestroy } from './EventSymbols.mjs'
 import { isPlainObject, illegalArgumentError } from './util.mjs'
 
-const { $getRoot, $configure, $setTitle, $getWidth, $getHeight, $getRefreshRate, $createNode, $addImage } = $window
+const easings = {
+  linear: 0,
+  ease: 1,
+  'ease-in': 2,
+  'ease-out': 3,
+  'ease-in-out': 4
+}
+
+// order of lse_render_stats fields
+const kRenderStats = [
+  'drawCalls',
+  'renderTargetChanges',
+  'texturesCreated',
+  'texturesDestroyed',
+  'bytesUploaded',
+  'colorModChanges',
+  'alphaModChanges',
+  'clipRectChanges',
+  'imageCacheEvictions',
+  'imageCacheCount',
+  'imageCacheBytes',
+  'renderObjectCount'
+]
+
+const toRenderStats = (values) => {
+  const stats = {}
+
+  kRenderStats.forEach((name, i) => { stats[name] = values[i] })
+
+  return stats
+}
+
+const {
+  $getRoot,
+  $configure,
+  $setTitle,
+  $getWidth,
+  $getHeight,
+  $getRefreshRate,
+  $getSkippedFrameCount,
+  $getDrawCallCount,
+  $getCulledNodeCount,
+  $getRenderStats,
+  $beginBatch,
+  $endBatch,
+  $animate,
+  $cancelAnimation,
+  $isAnimating,
+  $createNode,
+  $addImage
+} = $window
 
 export class Window extends EventEmitter {
   #title = ''
@@ -43,6 +93,65 @@ export class Window extends EventEmitter {
     return $createNode(this, tag)
   }
 
+  /**
+   * Start a batch of scene graph mutations.
+   *
+   * Inside a batch, appendChild, insertBefore and removeChild skip the layout pass that normally follows each
+   * mutation. A single layout runs when the outermost batch ends. Every beginBatch() must be paired with an
+   * endBatch().
+   */
+  beginBatch () {
+    $beginBatch(this)
+  }
+
+  endBatch () {
+    $endBatch(this)
+  }
+
+  /**
+   * Animate opacity, transform or color style properties of a node.
+   *
+   * The animation runs natively, stepped with each frame, so a running animation makes no calls into javascript.
+   * keyframes is an array of style objects, optionally with an offset (0 - 1) each. Without offsets, keyframes are
+   * spaced evenly. A single keyframe animates from the node's current value.
+   *
+   * options: duration (ms), delay (ms), iterations (Infinity repeats until cancelled), direction ('normal' or
+   * 'alternate') and easing ('linear', 'ease', 'ease-in', 'ease-out' or 'ease-in-out').
+   *
+   * Returns an animation id for cancelAnimation(), or 0 if none of the keyframe properties can be animated.
+   */
+  animate (node, keyframes, options = {}) {
+    if (!Array.isArray(keyframes) || !keyframes.length) {
+      illegalArgumentError('keyframes', keyframes)
+    }
+
+    const { duration = 0, delay = 0, iterations = 1, direction = 'normal', easing = 'linear' } = options
+    const hasOffsets = keyframes.some(frame => typeof frame?.offset === 'number')
+    const styles = keyframes.map(({ offset, ...frame }) => StyleOps.StyleClass(frame))
+    const offsets = hasOffsets
+      ? keyframes.map(({ offset }, i) => offset ?? (keyframes.length > 1 ? i / (keyframes.length - 1) : 1))
+      : null
+
+    return $animate(
+      this,
+      node,
+      styles,
+      offsets,
+      duration,
+      delay,
+      Number.isFinite(iterations) ? iterations : 0,
+      direction === 'alternate',
+      easings[easing] ?? easings.linear)
+  }
+
+  cancelAnimation (animationId) {
+    return $cancelAnimation(this, animationId)
+  }
+
+  isAnimating (animationId) {
+    return $isAnimating(this, animationId)
+  }
+
   addImage (spec) {
     if (typeof spec === 'string') {
       spec = { uri: spec }
@@ -84,6 +193,37 @@ export class Window extends EventEmitter {
     return $getRefreshRate(this)
   }
 
+  /**
+   * Number of frames skipped because nothing in the scene graph changed since the last presented frame.
+   */
+  get skippedFrameCount () {
+    return $getSkippedFrameCount(this)
+  }
+
+  /**
+   * Number of draw calls submitted to the graphics backend in the last presented frame.
+   */
+  get drawCallCount () {
+    return $getDrawCallCount(this)
+  }
+
+  /**
+   * Number of nodes skipped in the last presented frame because they were off-screen or hidden by a clipping ancestor.
+   */
+  get culledNodeCount () {
+    return $getCulledNodeCount(this)
+  }
+
+  /**
+   * Graphics backend counters for the last presented frame (frame) and since the window was configured (total).
+   *
+   * imageCacheCount, imageCacheBytes and renderObjectCount are resources alive when the stats were read, rather than
+   * counters.
+   */
+  get renderStats () {
+    return { frame: toRenderStats($getRenderStats(this, false)), total: toRenderStats($getRenderStats(this, true)) }
+  }
+
   get fullscreen () {
     return false
   }
@@ -56,6 +56,8 @@ export const createReconciler = () => {
     },
 
     prepareForCommit (containerInfo) {
+      // mutations in the commit only mark the scene graph dirty. layout runs once in resetAfterCommit.
+      containerInfo.node.window.beginBatch()
       return null
     },
 
@@ -64,7 +66,7 @@ export const createReconciler = () => {
     },
 
     resetAfterCommit (containerInfo) {
-      // noop
+      containerInfo.node.window.endBatch()
     },
 
     resetTextContent (wordElement) {
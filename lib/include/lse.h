@@ -130,6 +130,24 @@ typedef enum lse_env_state {
   LSE_ENV_STATE_PAUSED = 4
 } lse_env_state;
 
+typedef enum lse_frame_phase {
+  // lse_env_update(), end to end
+  LSE_FRAME_PHASE_FRAME = 0,
+  LSE_FRAME_PHASE_EVENTS = 1,
+  LSE_FRAME_PHASE_LAYOUT = 2,
+  LSE_FRAME_PHASE_RESOLVE = 3,
+  // all on_paint calls. the per node type phases below are subsets of paint.
+  LSE_FRAME_PHASE_PAINT = 4,
+  LSE_FRAME_PHASE_PAINT_BOX = 5,
+  LSE_FRAME_PHASE_PAINT_IMAGE = 6,
+  LSE_FRAME_PHASE_PAINT_TEXT = 7,
+  LSE_FRAME_PHASE_COMPOSITE = 8,
+  // pixel uploads to textures, wherever they happen in the frame
+  LSE_FRAME_PHASE_UPLOAD = 9,
+  LSE_FRAME_PHASE_PRESENT = 10,
+  LSE_FRAME_PHASE_COUNT
+} lse_frame_phase;
+
 typedef enum lse_keyspace {
   LSE_KEYSPACE_MAPPED = 0,
   LSE_KEYSPACE_HARDWARE = 1,
@@ -438,6 +456,24 @@ typedef enum lse_window_fit {
   LSE_WINDOW_FIT_EXACT = 1,
 } lse_window_fit;
 
+typedef enum lse_vsync_mode {
+  // wait for the vertical blank before presenting a frame
+  LSE_VSYNC_MODE_ON = 0,
+  // present immediately. frames are paced by the fps limit or the display refresh rate.
+  LSE_VSYNC_MODE_OFF = 1,
+  // wait for the vertical blank while frames fit in a refresh interval. when frames run long, present immediately
+  // (and tear) rather than waiting a whole extra interval.
+  LSE_VSYNC_MODE_ADAPTIVE = 2,
+} lse_vsync_mode;
+
+typedef enum lse_animation_easing {
+  LSE_ANIMATION_EASING_LINEAR = 0,
+  LSE_ANIMATION_EASING_EASE = 1,
+  LSE_ANIMATION_EASING_EASE_IN = 2,
+  LSE_ANIMATION_EASING_EASE_OUT = 3,
+  LSE_ANIMATION_EASING_EASE_IN_OUT = 4,
+} lse_animation_easing;
+
 typedef enum {
   LSE_RESOURCE_STATE_INIT = 0,
   LSE_RESOURCE_STATE_LOADING = 1,
@@ -522,6 +558,7 @@ typedef enum {
   LSE_SP_TRANSFORM_ORIGIN_X = 68,
   LSE_SP_TRANSFORM_ORIGIN_Y = 69,
   LSE_SP_WHITE_SPACE = 70,
+  LSE_SP_WILL_CHANGE = 71,
 } lse_style_property;
 
 typedef enum lse_style_align {
@@ -665,6 +702,13 @@ typedef enum lse_style_font_kerning {
 } lse_style_font_kerning;
 #define k_lse_style_font_kerning_count 2
 
+typedef enum lse_style_will_change {
+  LSE_STYLE_WILL_CHANGE_AUTO = 0,
+  LSE_STYLE_WILL_CHANGE_TRANSFORM = 1,
+  LSE_STYLE_WILL_CHANGE_OPACITY = 2,
+} lse_style_will_change;
+#define k_lse_style_will_change_count 3
+
 typedef enum lse_style_anchor {
   LSE_STYLE_ANCHOR_TOP = 0,
   LSE_STYLE_ANCHOR_RIGHT = 1,
@@ -750,6 +794,12 @@ typedef struct lse_font_event lse_font_event;
 typedef struct lse_image_event lse_image_event;
 typedef struct lse_window_settings lse_window_settings;
 typedef struct lse_settings lse_settings;
+typedef struct lse_render_settings lse_render_settings;
+typedef struct lse_frame_phase_stats lse_frame_phase_stats;
+typedef struct lse_frame_stats lse_frame_stats;
+typedef struct lse_render_stats lse_render_stats;
+typedef struct lse_image_cache_stats lse_image_cache_stats;
+typedef struct lse_animation_settings lse_animation_settings;
 typedef struct lse_sdl_mixer_settings lse_sdl_mixer_settings;
 typedef struct lse_sdl_settings lse_sdl_settings;
 typedef struct lse_style_filter lse_style_filter;
@@ -802,10 +852,82 @@ struct lse_sdl_mixer_settings {
   bool enabled;
 };
 
+struct lse_render_settings {
+  // redraw only the regions of a window that changed since the last frame. the graphics backend must preserve the
+  // back buffer between frames.
+  bool partial_redraw;
+  // debug: highlight the regions redrawn in each frame
+  bool show_redraw_regions;
+  // submit consecutive draws that share a texture as one draw call, if the graphics backend supports it
+  bool batch_geometry;
+  lse_vsync_mode vsync;
+  // upper bound of frames per second or 0 to run at the display refresh rate. with vsync, the limit is rounded down
+  // to the refresh rate divided by a whole number, so every frame is on screen for the same number of refreshes.
+  int32_t fps_limit;
+  // bytes of image textures each window keeps resident, or 0 for no limit. over the budget, textures of images that
+  // have not been drawn recently are evicted and uploaded again from decoded pixels when they are next drawn.
+  int64_t image_cache_budget;
+  // bytes of released images the env keeps for reuse, or 0 to release images as soon as they are unused. a retained
+  // image is returned by the next acquire of its uri, from any window, without decoding the image again.
+  int64_t image_store_budget;
+};
+
+struct lse_frame_phase_stats {
+  // milliseconds spent in the phase per frame
+  float min;
+  float avg;
+  float p99;
+};
+
+struct lse_frame_stats {
+  // number of recent frames the stats were computed from
+  uint32_t frame_count;
+  // frames where no window had anything to draw. they are not included in the phase stats.
+  uint64_t idle_frame_count;
+  // indexed by lse_frame_phase
+  lse_frame_phase_stats phases[LSE_FRAME_PHASE_COUNT];
+};
+
+struct lse_render_stats {
+  // work submitted to the graphics backend, counted per frame or since the window was configured
+  uint64_t draw_calls;
+  uint64_t render_target_changes;
+  uint64_t textures_created;
+  uint64_t textures_destroyed;
+  uint64_t bytes_uploaded;
+  uint64_t color_mod_changes;
+  uint64_t alpha_mod_changes;
+  uint64_t clip_rect_changes;
+  uint64_t image_cache_evictions;
+  // resources alive at the time the stats were read. the same for per frame and cumulative stats.
+  int32_t image_cache_count;
+  int64_t image_cache_bytes;
+  int32_t render_object_count;
+};
+
+struct lse_image_cache_stats {
+  // image textures resident in the graphics backends of all windows
+  int32_t image_count;
+  int64_t resident_bytes;
+  // budget per window. see lse_render_settings.image_cache_budget.
+  int64_t budget_bytes;
+  // textures evicted since the windows were configured
+  uint64_t evictions;
+  // released images retained by the image store the windows share
+  int32_t retained_count;
+  int64_t retained_bytes;
+  // image acquires served without decoding (hits) and acquires that decoded an image (misses)
+  uint64_t hits;
+  uint64_t misses;
+  // retained images released to stay within lse_render_settings.image_store_budget
+  uint64_t retained_evictions;
+};
+
 struct lse_settings {
   lse_mock_settings mock_settings;
   lse_sdl_settings sdl_settings;
   lse_sdl_mixer_settings sdl_mixer_settings;
+  lse_render_settings render_settings;
 };
 
 struct lse_window_settings {
@@ -816,6 +938,18 @@ struct lse_window_settings {
   lse_window_fit fit;
 };
 
+struct lse_animation_settings {
+  // length of one iteration in ms
+  float duration;
+  // time between the first frame after the animation starts and the first iteration in ms
+  float delay;
+  // number of iterations or <= 0 to repeat until cancelled
+  int32_t iterations;
+  // play every other iteration in reverse
+  bool alternate;
+  lse_animation_easing easing;
+};
+
 struct lse_image_event {
   lse_image* image;
   lse_resource_state state;
@@ -842,6 +976,8 @@ typedef void (*lse_thread_pool_user_data_finalize)(void* user_data);
 typedef struct lse_thread_pool lse_thread_pool;
 typedef struct lse_thread_pool_task lse_thread_pool_task;
 
+// queue owns user_data from the call on: finalize runs exactly once, after complete, after a cancel or when the task
+// could not be queued. the returned task is only a handle for cancel; NULL means there is nothing to cancel.
 typedef lse_thread_pool_task* (*lse_thread_pool_queue)(
     lse_thread_pool*,
     const char*,
@@ -871,6 +1007,15 @@ LSE_API bool LSE_CDECL lse_env_is_error(lse_env* env);
 LSE_API bool LSE_CDECL lse_env_has_quit_request(lse_env* env);
 
 LSE_API void LSE_CDECL lse_env_update(lse_env* env);
+LSE_API void LSE_CDECL lse_env_get_frame_stats(lse_env* env, lse_frame_stats* stats);
+LSE_API void LSE_CDECL lse_env_get_image_cache_stats(lse_env* env, lse_image_cache_stats* stats);
+/**
+ * Milliseconds until lse_env_update() should be called for the next frame.
+ *
+ * The delay is scheduled from the last present. With vsync, the next update is started just early enough to finish
+ * before the next vertical blank, so the present does not block the caller for most of a refresh interval.
+ */
+LSE_API double LSE_CDECL lse_env_get_frame_delay(lse_env* env);
 
 LSE_API void LSE_CDECL
 lse_env_set_gamepad_status_callback(lse_env* env, lse_gamepad_status_callback callback, void* data);
@@ -989,6 +1134,13 @@ LSE_API bool LSE_CDECL lse_node_remove_child(lse_node* node, lse_node* child);
 LSE_API bool LSE_CDECL lse_node_set_src(lse_node* node, lse_string* uri);
 LSE_API lse_string* LSE_CDECL lse_node_get_src(lse_node* node);
 
+/**
+ * Set the size, in px, an image node decodes its image at. Large images are downsampled to this size when decoded, so
+ * they take less memory. Layout still uses the intrinsic size of the image. If 0 x 0 (the default), the image is
+ * decoded for the size of the node box.
+ */
+LSE_API void LSE_CDECL lse_node_set_decode_size(lse_node* node, int32_t width, int32_t height);
+
 LSE_API bool LSE_CDECL lse_node_set_text(lse_node* node, lse_string* text);
 LSE_API lse_string* LSE_CDECL lse_node_get_text(lse_node* node);
 
@@ -1003,7 +1155,53 @@ LSE_API int32_t LSE_CDECL lse_window_get_width(lse_window* window);
 LSE_API int32_t LSE_CDECL lse_window_get_height(lse_window* window);
 LSE_API int32_t LSE_CDECL lse_window_get_refresh_rate(lse_window* window);
 LSE_API uint32_t LSE_CDECL lse_window_get_flags(lse_window* window);
+LSE_API uint64_t LSE_CDECL lse_window_get_skipped_frame_count(lse_window* window);
+/**
+ * Number of draw calls submitted to the graphics backend in the last presented frame.
+ */
+LSE_API uint32_t LSE_CDECL lse_window_get_draw_call_count(lse_window* window);
+/**
+ * Number of nodes skipped in the last presented frame because they were outside of the window or a clipping ancestor.
+ */
+LSE_API uint32_t LSE_CDECL lse_window_get_culled_node_count(lse_window* window);
+/**
+ * Get graphics backend counters for the last presented frame or, if cumulative is true, since the window was
+ * configured.
+ */
+LSE_API void LSE_CDECL lse_window_get_render_stats(lse_window* window, bool cumulative, lse_render_stats* stats);
 LSE_API lse_node* LSE_CDECL lse_window_create_node_from_tag(lse_window* window, const char* tag);
+/**
+ * Start a batch of scene graph mutations.
+ *
+ * While a batch is open, append, insert and remove only mark the scene graph dirty. The inline layout and style
+ * resolve normally run by each mutation are deferred to lse_window_end_batch(). Batches can be nested; the deferred
+ * layout runs when the outermost batch ends.
+ */
+LSE_API void LSE_CDECL lse_window_begin_batch(lse_window* window);
+LSE_API void LSE_CDECL lse_window_end_batch(lse_window* window);
+/**
+ * Animate style properties of a node natively, without involving the caller on every frame.
+ *
+ * Each keyframe is a style holding the property values at the keyframe's offset (0 - 1) in an iteration. If offsets is
+ * NULL, keyframes are spaced evenly. Opacity, transform (single translate, scale or rotate) and color properties set
+ * in any keyframe are animated; other properties are ignored. A property missing at offset 0 animates from the value
+ * the node has when the animation starts. Starting an animation on a property that is already animating replaces the
+ * running animation.
+ *
+ * Animations are stepped at the start of each presented frame and write into the node's style. The last written value
+ * stays in the style when the animation finishes or is cancelled.
+ *
+ * Returns an animation id > 0 or 0 if nothing could be animated.
+ */
+LSE_API int32_t LSE_CDECL lse_window_animate(
+    lse_window* window,
+    lse_node* node,
+    lse_style** keyframes,
+    const float* offsets,
+    size_t keyframe_count,
+    const lse_animation_settings* settings);
+LSE_API bool LSE_CDECL lse_window_cancel_animation(lse_window* window, int32_t animation_id);
+LSE_API bool LSE_CDECL lse_window_is_animating(lse_window* window, int32_t animation_id);
 // LSE_API lse_node LSE_CDECL lse_env_create_box_node(lse_env env);
 // LSE_API lse_node LSE_CDECL lse_env_create_image_node(lse_env env);
 // LSE_API lse_node LSE_CDECL lse_env_create_text_node(lse_env env);
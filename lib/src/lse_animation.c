@@ -0,0 +1,530 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_animation.h"
+
+#define i_tag animation_tracks
+#define i_val lse_animation_track
+#define i_opt c_no_clone | c_no_cmp | c_is_fwd
+#include <stc/cvec.h>
+
+#include "lse_array.h"
+#include "lse_node.h"
+#include "lse_object.h"
+#include "lse_style.h"
+#include "lse_style_meta.h"
+#include "lse_util.h"
+#include <string.h>
+
+// newton iterations used to invert the x curve of a cubic bezier easing
+#define BEZIER_NEWTON_ITERATIONS 8
+#define BEZIER_EPSILON 1e-5f
+
+static bool is_animatable(lse_style_property property);
+static bool init_track(
+    lse_animation_track* track,
+    lse_style_property property,
+    lse_style** keyframes,
+    const float* offsets,
+    size_t keyframe_count);
+static bool read_keyframe(lse_animation_track* track, lse_style* style, lse_animation_keyframe* keyframe);
+static void fill_start_value(lse_animation_track* track);
+static bool step_track(lse_animation_track* track, double time);
+static void write_value(lse_animation_track* track, float progress);
+static void release_track(lse_animation_track* track);
+static void remove_tracks(lse_animator* animator, lse_node* node, lse_style_property property);
+static float get_offset(const float* offsets, size_t i, size_t count);
+static float ease(lse_animation_easing easing, float t);
+static float cubic_bezier(float x1, float y1, float x2, float y2, float x);
+static lse_style_value lerp_value(lse_style_value from, lse_style_value to, float t);
+static uint32_t lerp_color(uint32_t from, uint32_t to, float t);
+
+lse_animator lse_animator_init(void) {
+  return (lse_animator){
+    .tracks = cvec_animation_tracks_init(),
+  };
+}
+
+void lse_animator_drop(lse_animator* animator) {
+  if (!animator) {
+    return;
+  }
+
+  c_foreach(it, cvec_animation_tracks, animator->tracks) {
+    release_track(it.ref);
+  }
+
+  cvec_animation_tracks_drop(&animator->tracks);
+  animator->tracks = cvec_animation_tracks_init();
+}
+
+int32_t lse_animator_add(
+    lse_animator* animator,
+    lse_node* node,
+    lse_style** keyframes,
+    const float* offsets,
+    size_t keyframe_count,
+    const lse_animation_settings* settings) {
+  lse_animation_track track;
+  int32_t id;
+  bool added = false;
+
+  if (!node || lse_node_is_destroyed(node) || !keyframes || keyframe_count == 0
+      || keyframe_count > LSE_ANIMATION_MAX_KEYFRAMES || !settings || settings->duration < 0
+      || settings->delay < 0) {
+    return 0;
+  }
+
+  // offsets must not decrease
+  for (size_t i = 0; i < keyframe_count; i++) {
+    if (!keyframes[i]
+        || (i > 0 && get_offset(offsets, i, keyframe_count) < get_offset(offsets, i - 1, keyframe_count))) {
+      return 0;
+    }
+  }
+
+  id = animator->next_id < INT32_MAX ? animator->next_id + 1 : 1;
+
+  for (int32_t property = 0; lse_style_meta_is_style_property(property); property++) {
+    if (!is_animatable(property)) {
+      continue;
+    }
+
+    track = (lse_animation_track){
+      .id = id,
+      .settings = *settings,
+      .start_time = -1,
+    };
+
+    if (!init_track(&track, property, keyframes, offsets, keyframe_count)) {
+      continue;
+    }
+
+    // a new animation of a property takes over from the running one, starting from the last written value
+    remove_tracks(animator, node, property);
+
+    track.node = node;
+    lse_ref(node);
+
+    if (track.type == LSE_STYLE_PROPERTY_TYPE_TRANSFORM) {
+      track.transform = (lse_array*)lse_style_transform_new(&track.keyframes[0].value.transform, 1);
+    }
+
+    cvec_animation_tracks_push_back(&animator->tracks, track);
+    added = true;
+  }
+
+  if (!added) {
+    return 0;
+  }
+
+  animator->next_id = id;
+
+  return id;
+}
+
+bool lse_animator_cancel(lse_animator* animator, int32_t id) {
+  bool found = false;
+
+  for (size_t i = cvec_animation_tracks_size(animator->tracks); i > 0; i--) {
+    lse_animation_track* track = (lse_animation_track*)cvec_animation_tracks_at(&animator->tracks, i - 1);
+
+    if (track->id == id) {
+      release_track(track);
+      cvec_animation_tracks_erase_n(&animator->tracks, i - 1, 1);
+      found = true;
+    }
+  }
+
+  return found;
+}
+
+bool lse_animator_has_animation(lse_animator* animator, int32_t id) {
+  c_foreach(it, cvec_animation_tracks, animator->tracks) {
+    if (it.ref->id == id) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool lse_animator_step(lse_animator* animator, double time) {
+  // tracks are not added or removed by style writes, so indices are stable until a track finishes
+  for (size_t i = 0; i < cvec_animation_tracks_size(animator->tracks);) {
+    lse_animation_track* track = (lse_animation_track*)cvec_animation_tracks_at(&animator->tracks, i);
+
+    if (step_track(track, time)) {
+      i++;
+    } else {
+      release_track(track);
+      cvec_animation_tracks_erase_n(&animator->tracks, i, 1);
+    }
+  }
+
+  return cvec_animation_tracks_size(animator->tracks) > 0;
+}
+
+size_t lse_animator_get_track_count(lse_animator* animator) {
+  return cvec_animation_tracks_size(animator->tracks);
+}
+
+// @private
+static bool is_animatable(lse_style_property property) {
+  switch (lse_style_meta_get_property_type(property)) {
+    case LSE_STYLE_PROPERTY_TYPE_COLOR:
+    case LSE_STYLE_PROPERTY_TYPE_TRANSFORM:
+      return true;
+    default:
+      return property == LSE_SP_OPACITY;
+  }
+}
+
+// @private
+static bool init_track(
+    lse_animation_track* track,
+    lse_style_property property,
+    lse_style** keyframes,
+    const float* offsets,
+    size_t keyframe_count) {
+  lse_animation_keyframe* keyframe;
+
+  track->property = property;
+  track->type = lse_style_meta_get_property_type(property);
+  // reserve the first slot for an implicit start keyframe
+  track->keyframe_count = 1;
+
+  for (size_t i = 0; i < keyframe_count; i++) {
+    if (!lse_style_has_property(keyframes[i], property)) {
+      continue;
+    }
+
+    keyframe = &track->keyframes[track->keyframe_count];
+    keyframe->offset = get_offset(offsets, i, keyframe_count);
+
+    if (!read_keyframe(track, keyframes[i], keyframe)) {
+      return false;
+    }
+
+    track->keyframe_count++;
+  }
+
+  if (track->keyframe_count == 1) {
+    return false;
+  }
+
+  // keyframe at offset 0 is filled in from the node's current value when the track starts
+  if (track->keyframes[1].offset > 0) {
+    track->keyframes[0] = track->keyframes[1];
+    track->keyframes[0].offset = 0;
+    track->needs_start_value = true;
+  } else {
+    memmove(&track->keyframes[0], &track->keyframes[1], sizeof(lse_animation_keyframe) * (track->keyframe_count - 1));
+    track->keyframe_count--;
+  }
+
+  // hold the last value until the end of the iteration
+  if (track->keyframes[track->keyframe_count - 1].offset < 1) {
+    track->keyframes[track->keyframe_count] = track->keyframes[track->keyframe_count - 1];
+    track->keyframes[track->keyframe_count].offset = 1;
+    track->keyframe_count++;
+  }
+
+  return true;
+}
+
+// @private
+static bool read_keyframe(lse_animation_track* track, lse_style* style, lse_animation_keyframe* keyframe) {
+  const lse_animation_keyframe* first = track->keyframe_count > 1 ? &track->keyframes[1] : NULL;
+  lse_array* transform_list;
+
+  switch (track->type) {
+    case LSE_STYLE_PROPERTY_TYPE_NUMBER:
+      keyframe->value.numeric = *lse_style_get_numeric(style, track->property);
+      // values in different units would need layout information to interpolate
+      return keyframe->value.numeric.unit != LSE_STYLE_UNIT_UNDEFINED
+             && (!first || first->value.numeric.unit == keyframe->value.numeric.unit);
+    case LSE_STYLE_PROPERTY_TYPE_COLOR:
+      keyframe->value.color = lse_style_get_color(style, track->property);
+      return true;
+    case LSE_STYLE_PROPERTY_TYPE_TRANSFORM:
+      transform_list = (lse_array*)lse_style_get_object(style, track->property);
+
+      if (!transform_list || lse_array_get_length(transform_list) == 0) {
+        lse_style_transform_identity(&keyframe->value.transform);
+      } else if (lse_array_get_length(transform_list) == 1) {
+        keyframe->value.transform = *(lse_style_transform*)lse_array_at(transform_list, 0);
+      } else {
+        return false;
+      }
+
+      return !first
+             || (first->value.transform.op == keyframe->value.transform.op
+                 && first->value.transform.a.unit == keyframe->value.transform.a.unit
+                 && first->value.transform.b.unit == keyframe->value.transform.b.unit);
+    default:
+      return false;
+  }
+}
+
+// @private
+static void fill_start_value(lse_animation_track* track) {
+  lse_style* style = lse_node_get_style_or_empty(track->node);
+  lse_animation_keyframe* start = &track->keyframes[0];
+  const lse_style_value* numeric;
+  lse_array* transform_list;
+  const lse_style_transform* transform;
+
+  switch (track->type) {
+    case LSE_STYLE_PROPERTY_TYPE_NUMBER:
+      numeric = lse_style_get_numeric(style, track->property);
+
+      if (numeric->unit == start->value.numeric.unit) {
+        start->value.numeric = *numeric;
+      } else if (track->property == LSE_SP_OPACITY) {
+        start->value.numeric.value = lse_style_resolve_opacity(style);
+
+        if (start->value.numeric.unit == LSE_STYLE_UNIT_PERCENT) {
+          start->value.numeric.value *= 100.f;
+        }
+      }
+      break;
+    case LSE_STYLE_PROPERTY_TYPE_COLOR:
+      start->value.color = lse_style_get_color(style, track->property);
+      break;
+    case LSE_STYLE_PROPERTY_TYPE_TRANSFORM:
+      transform_list = (lse_array*)lse_style_get_object(style, track->property);
+      transform = (transform_list && lse_array_get_length(transform_list) == 1) ? lse_array_at(transform_list, 0)
+                                                                                : NULL;
+
+      if (transform && transform->op == start->value.transform.op && transform->a.unit == start->value.transform.a.unit
+          && transform->b.unit == start->value.transform.b.unit) {
+        start->value.transform = *transform;
+      } else {
+        // neutral value of the op, in the units of the first keyframe
+        start->value.transform.a.value = start->value.transform.b.value =
+            (start->value.transform.op == LSE_STYLE_TRANSFORM_SCALE) ? 1.f : 0.f;
+      }
+      break;
+    default:
+      break;
+  }
+
+  track->needs_start_value = false;
+}
+
+// @private
+static bool step_track(lse_animation_track* track, double time) {
+  const lse_animation_settings* settings = &track->settings;
+  double elapsed;
+  double iteration;
+  float progress;
+  bool finished;
+
+  if (lse_node_is_destroyed(track->node)) {
+    return false;
+  }
+
+  // time starts with the first frame the track is part of, so a late start request does not skip ahead
+  if (track->start_time < 0) {
+    track->start_time = time;
+  }
+
+  elapsed = time - track->start_time - settings->delay;
+
+  if (elapsed < 0) {
+    return true;
+  }
+
+  if (track->needs_start_value) {
+    fill_start_value(track);
+  }
+
+  if (settings->duration > 0) {
+    iteration = floor(elapsed / settings->duration);
+    progress = (float)((elapsed - iteration * settings->duration) / settings->duration);
+    finished = settings->iterations > 0 && iteration >= settings->iterations;
+  } else {
+    iteration = 0;
+    progress = 0;
+    finished = true;
+  }
+
+  // finish on the end of the last iteration
+  if (finished) {
+    iteration = settings->iterations > 0 ? settings->iterations - 1 : 0;
+    progress = 1;
+  }
+
+  if (settings->alternate && fmod(iteration, 2) >= 1) {
+    progress = 1 - progress;
+  }
+
+  write_value(track, ease(settings->easing, progress));
+
+  return !finished;
+}
+
+// @private
+static void write_value(lse_animation_track* track, float progress) {
+  const lse_animation_keyframe* from = &track->keyframes[0];
+  const lse_animation_keyframe* to = &track->keyframes[track->keyframe_count - 1];
+  lse_style* style = lse_node_get_style(track->node);
+  lse_style_transform* transform;
+  lse_style_value value;
+  float t;
+
+  for (int32_t i = 1; i < track->keyframe_count; i++) {
+    if (progress <= track->keyframes[i].offset) {
+      from = &track->keyframes[i - 1];
+      to = &track->keyframes[i];
+      break;
+    }
+  }
+
+  t = to->offset > from->offset ? lse_clamp_f((progress - from->offset) / (to->offset - from->offset), 0, 1) : 1;
+
+  switch (track->type) {
+    case LSE_STYLE_PROPERTY_TYPE_NUMBER:
+      value = lerp_value(from->value.numeric, to->value.numeric, t);
+      lse_style_set_numeric(style, track->property, &value);
+      break;
+    case LSE_STYLE_PROPERTY_TYPE_COLOR:
+      lse_style_set_color(style, track->property, lerp_color(from->value.color, to->value.color, t));
+      break;
+    case LSE_STYLE_PROPERTY_TYPE_TRANSFORM:
+      transform = lse_array_at(track->transform, 0);
+      transform->op = to->value.transform.op;
+      transform->a = lerp_value(from->value.transform.a, to->value.transform.a, t);
+      transform->b = lerp_value(from->value.transform.b, to->value.transform.b, t);
+
+      // the list is updated in place, so only the node needs to hear about the change
+      if (lse_style_get_object(style, track->property) == (lse_object*)track->transform) {
+        lse_node_on_style_property_change(track->node, track->property);
+      } else {
+        lse_ref(track->transform);
+        lse_style_set_object(style, track->property, (lse_object*)track->transform);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// @private
+static void release_track(lse_animation_track* track) {
+  lse_unref(track->transform);
+  track->transform = NULL;
+  lse_unref(track->node);
+  track->node = NULL;
+}
+
+// @private
+static void remove_tracks(lse_animator* animator, lse_node* node, lse_style_property property) {
+  for (size_t i = cvec_animation_tracks_size(animator->tracks); i > 0; i--) {
+    lse_animation_track* track = (lse_animation_track*)cvec_animation_tracks_at(&animator->tracks, i - 1);
+
+    if (track->node == node && track->property == property) {
+      release_track(track);
+      cvec_animation_tracks_erase_n(&animator->tracks, i - 1, 1);
+    }
+  }
+}
+
+// @private
+static float get_offset(const float* offsets, size_t i, size_t count) {
+  if (offsets) {
+    return lse_clamp_f(offsets[i], 0, 1);
+  }
+
+  // a lone keyframe is the end value of a transition from the current value
+  return count > 1 ? (float)i / (float)(count - 1) : 1;
+}
+
+// @private
+static float ease(lse_animation_easing easing, float t) {
+  // control points of the css timing functions of the same names
+  switch (easing) {
+    case LSE_ANIMATION_EASING_EASE:
+      return cubic_bezier(0.25f, 0.1f, 0.25f, 1.f, t);
+    case LSE_ANIMATION_EASING_EASE_IN:
+      return cubic_bezier(0.42f, 0.f, 1.f, 1.f, t);
+    case LSE_ANIMATION_EASING_EASE_OUT:
+      return cubic_bezier(0.f, 0.f, 0.58f, 1.f, t);
+    case LSE_ANIMATION_EASING_EASE_IN_OUT:
+      return cubic_bezier(0.42f, 0.f, 0.58f, 1.f, t);
+    default:
+      return t;
+  }
+}
+
+// @private
+static float cubic_bezier(float x1, float y1, float x2, float y2, float x) {
+  // polynomial coefficients of the curve, with end points fixed at (0,0) and (1,1)
+  float cx = 3.f * x1;
+  float bx = 3.f * (x2 - x1) - cx;
+  float ax = 1.f - cx - bx;
+  float cy = 3.f * y1;
+  float by = 3.f * (y2 - y1) - cy;
+  float ay = 1.f - cy - by;
+  float t = x;
+  float dx;
+  float slope;
+
+  if (x <= 0 || x >= 1) {
+    return x <= 0 ? 0 : 1;
+  }
+
+  // find t where the curve's x equals x
+  for (int32_t i = 0; i < BEZIER_NEWTON_ITERATIONS; i++) {
+    dx = ((ax * t + bx) * t + cx) * t - x;
+
+    if (fabsf(dx) < BEZIER_EPSILON) {
+      break;
+    }
+
+    slope = (3.f * ax * t + 2.f * bx) * t + cx;
+
+    if (fabsf(slope) < BEZIER_EPSILON) {
+      break;
+    }
+
+    t = lse_clamp_f(t - dx / slope, 0, 1);
+  }
+
+  return ((ay * t + by) * t + cy) * t;
+}
+
+// @private
+static lse_style_value lerp_value(lse_style_value from, lse_style_value to, float t) {
+  return (lse_style_value){
+    .unit = to.unit,
+    .value = from.value + (to.value - from.value) * t,
+  };
+}
+
+// @private
+static uint32_t lerp_color(uint32_t from, uint32_t to, float t) {
+  uint32_t result = 0;
+  float a;
+  float b;
+
+  // channel order does not matter, as both colors use the same format
+  for (uint32_t shift = 0; shift < 32; shift += 8) {
+    a = (float)((from >> shift) & 0xFF);
+    b = (float)((to >> shift) & 0xFF);
+    result |= ((uint32_t)lroundf(a + (b - a) * t) & 0xFF) << shift;
+  }
+
+  return result;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include "lse_types.h"
+
+#include <stc/forward.h>
+
+typedef struct lse_animation_keyframe lse_animation_keyframe;
+typedef struct lse_animation_track lse_animation_track;
+typedef struct lse_animator lse_animator;
+
+// keyframes per track, not counting the implicit keyframes added at offsets 0 and 1
+#define LSE_ANIMATION_MAX_KEYFRAMES 8
+
+struct lse_animation_keyframe {
+  float offset;
+
+  union {
+    lse_style_value numeric;
+    uint32_t color;
+    lse_style_transform transform;
+  } value;
+};
+
+/**
+ * Animation of one style property of one node.
+ */
+struct lse_animation_track {
+  int32_t id;
+  lse_node* node;
+  lse_style_property property;
+  lse_style_property_type type;
+  lse_animation_settings settings;
+  // time of the first step in ms or a negative value if the track has not been stepped yet
+  double start_time;
+  // single element transform list shared with the node style, so transform steps do not allocate
+  lse_array* transform;
+  // true until the first step fills in the keyframe at offset 0 from the node's current value
+  bool needs_start_value;
+  int32_t keyframe_count;
+  lse_animation_keyframe keyframes[LSE_ANIMATION_MAX_KEYFRAMES + 2];
+};
+
+forward_cvec(cvec_animation_tracks, lse_animation_track);
+
+/**
+ * Runs style property animations for the nodes of a window.
+ *
+ * Tracks are stepped once per frame with the frame time. Each step interpolates the keyframes and writes the result
+ * straight into the node's style, so a running animation costs no allocations and no calls into the bindings. The
+ * style change goes through the normal property change path, which turns opacity and transform into composite only
+ * updates.
+ */
+struct lse_animator {
+  int32_t next_id;
+  cvec_animation_tracks tracks;
+};
+
+lse_animator lse_animator_init(void);
+void lse_animator_drop(lse_animator* animator);
+
+/**
+ * Add tracks for the animatable properties set in keyframes. See lse_window_animate().
+ *
+ * Returns the animation id shared by the new tracks or 0 if no track was added.
+ */
+int32_t lse_animator_add(
+    lse_animator* animator,
+    lse_node* node,
+    lse_style** keyframes,
+    const float* offsets,
+    size_t keyframe_count,
+    const lse_animation_settings* settings);
+
+/**
+ * Remove the tracks of an animation. Property values written by the animation stay in the node style.
+ */
+bool lse_animator_cancel(lse_animator* animator, int32_t id);
+
+bool lse_animator_has_animation(lse_animator* animator, int32_t id);
+
+/**
+ * Advance all tracks to time (in ms) and remove finished tracks.
+ *
+ * Returns true if any tracks are still running.
+ */
+bool lse_animator_step(lse_animator* animator, double time);
+
+size_t lse_animator_get_track_count(lse_animator* animator);
@@ -25,10 +25,13 @@ typedef struct lse_box_node lse_box_node;
 struct lse_box_node {
   lse_node_base base;
   lse_image* background_image;
+  // the surface is a single background color fill, tinted at composite time
+  bool is_fill_surface;
 };
 
 static void set_background_image(lse_node* node, lse_string* uri);
 static void on_image_event(const lse_image_event* e, void* observer);
+static bool is_fill_only(lse_node* node);
 
 // @override
 static void constructor(lse_object* node, void* arg) {
@@ -68,6 +71,17 @@ static void on_composite(lse_node* node, lse_graphics* graphics) {
   lse_graphics_draw_render_object(graphics, base->surface, lse_style_get_color_t(style, LSE_SP_BACKGROUND_COLOR));
 }
 
+// @override
+static bool get_opaque_rect(lse_node* node, lse_graphics* graphics, lse_rect_f* rect) {
+  lse_node_base* base = lse_node_get_base(node);
+  lse_style* style = lse_node_get_style_or_empty(node);
+
+  // same color as on_composite
+  return base->surface
+         && lse_graphics_get_opaque_rect(
+             graphics, base->surface, lse_style_get_color_t(style, LSE_SP_BACKGROUND_COLOR), rect);
+}
+
 // @override
 static void on_paint(lse_node* node, lse_graphics* graphics) {
   lse_box_node* self = (lse_box_node*)node;
@@ -125,15 +139,27 @@ static void on_paint(lse_node* node, lse_graphics* graphics) {
   }
 
   base->surface = lse_graphics_end_queue(graphics, box.width, box.height, base->surface);
+  self->is_fill_surface = base->surface && is_fill_only(node);
 
   lse_node_request_composite(node);
 }
 
 // @override
 static void on_style_resolve(lse_node* node) {
-  if (lse_node_has_flag(node, LSE_NODE_FLAG_BOUNDS | LSE_NODE_FLAG_SHAPE | LSE_NODE_FLAG_COLOR)) {
+  lse_box_node* self = (lse_box_node*)node;
+
+  if (lse_node_has_flag(node, LSE_NODE_FLAG_BOUNDS | LSE_NODE_FLAG_SHAPE)) {
     lse_node_unset_flag(node, LSE_NODE_FLAG_BOUNDS | LSE_NODE_FLAG_SHAPE | LSE_NODE_FLAG_COLOR);
     lse_node_request_paint(node);
+  } else if (lse_node_has_flag(node, LSE_NODE_FLAG_COLOR)) {
+    lse_node_unset_flag(node, LSE_NODE_FLAG_COLOR);
+
+    // a fill surface picks up the new background color at composite time. anything else bakes colors into pixels.
+    if (self->is_fill_surface && is_fill_only(node)) {
+      lse_node_request_composite(node);
+    } else {
+      lse_node_request_paint(node);
+    }
   }
 }
 
@@ -176,7 +202,7 @@ static void set_background_image(lse_node* node, lse_string* uri) {
     if (lse_string_empty(uri)) {
       lse_node_base_image_release(node, self->background_image);
       self->background_image = NULL;
-    } else if (lse_string_cmp(lse_image_get_uri(self->background_image), uri) != 0) {
+    } else if (!lse_node_base_image_has_uri(node, self->background_image, uri)) {
       lse_node_base_image_release(node, self->background_image);
       lse_ref(uri);
       self->background_image = lse_node_base_image_acquire(node, uri, &on_image_event);
@@ -193,6 +219,16 @@ static void on_image_event(const lse_image_event* e, void* observer) {
   lse_node_request_style_resolve(observer, LSE_NODE_FLAG_BOUNDS);
 }
 
+static bool is_fill_only(lse_node* node) {
+  lse_box_node* self = (lse_box_node*)node;
+  lse_style* style = lse_node_get_style_or_empty(node);
+
+  // mirrors on_paint: true when the paint queue would hold a single background color fill rect
+  return lse_style_has_property(style, LSE_SP_BACKGROUND_COLOR) && !lse_style_has_property(style, LSE_SP_BORDER_RADIUS)
+         && !lse_image_can_render(self->background_image)
+         && !(lse_style_has_property(style, LSE_SP_BORDER_COLOR) && lse_style_has_border_layout(node));
+}
+
 // ////////////////////////////////////////////////////////////////////////////
 // Export type information for lse_object.c:register_types().
 // ////////////////////////////////////////////////////////////////////////////
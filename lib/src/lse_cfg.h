@@ -50,6 +50,14 @@
  */
 #define VAR_LSE_GAMECONTROLLER_DB "LSE_GAMECONTROLLER_DB"
 
+/*
+ * Chrome trace_event JSON output file name.
+ *
+ * If set and the library was built with LSE_CFG_TRACE, frame phases, paint calls, texture uploads and thread pool
+ * tasks are written to the file. The file can be loaded in Perfetto or chrome://tracing.
+ */
+#define VAR_LSE_TRACE_FILE "LSE_TRACE_FILE"
+
 // ////////////////////////////////////////////////////////////////////////////
 // environment variable defaults
 // ////////////////////////////////////////////////////////////////////////////
@@ -82,6 +90,86 @@
 #define DEFAULT_LSE_SDL_MIXER_LIBRARY "libSDL2_mixer-2.0.so.0"
 #endif
 
+// ////////////////////////////////////////////////////////////////////////////
+// cache defaults
+// ////////////////////////////////////////////////////////////////////////////
+
+/*
+ * LSE_CFG_GLYPH_CACHE_BUDGET
+ *
+ * Default number of bytes of rasterized glyph bitmaps each font keeps in memory. The budget can be changed per font
+ * with lse_font_set_glyph_cache_budget().
+ */
+#ifndef LSE_CFG_GLYPH_CACHE_BUDGET
+#define LSE_CFG_GLYPH_CACHE_BUDGET (512 * 1024)
+#endif
+
+/*
+ * LSE_CFG_IMAGE_CACHE_BUDGET
+ *
+ * Default number of bytes of image textures each window keeps resident. The budget can be changed with
+ * lse_render_settings.image_cache_budget.
+ */
+#ifndef LSE_CFG_IMAGE_CACHE_BUDGET
+#define LSE_CFG_IMAGE_CACHE_BUDGET (64 * 1024 * 1024)
+#endif
+
+/*
+ * LSE_CFG_IMAGE_STORE_BUDGET
+ *
+ * Default number of bytes of released images the env retains for reuse. The budget can be changed with
+ * lse_render_settings.image_store_budget.
+ */
+#ifndef LSE_CFG_IMAGE_STORE_BUDGET
+#define LSE_CFG_IMAGE_STORE_BUDGET (16 * 1024 * 1024)
+#endif
+
+// ////////////////////////////////////////////////////////////////////////////
+// frame pacing defaults
+// ////////////////////////////////////////////////////////////////////////////
+
+/*
+ * LSE_CFG_FRAME_RATE
+ *
+ * Frames per second used when the refresh rate of the display is unknown.
+ */
+#ifndef LSE_CFG_FRAME_RATE
+#define LSE_CFG_FRAME_RATE 60
+#endif
+
+/*
+ * LSE_CFG_FRAME_PACING_MARGIN
+ *
+ * Milliseconds of slack left between the estimated end of a frame and the vertical blank the frame is presented on.
+ * A larger margin misses fewer vertical blanks, but blocks longer in present.
+ */
+#ifndef LSE_CFG_FRAME_PACING_MARGIN
+#define LSE_CFG_FRAME_PACING_MARGIN 2.0
+#endif
+
+// ////////////////////////////////////////////////////////////////////////////
+// instrumentation defaults
+// ////////////////////////////////////////////////////////////////////////////
+
+/*
+ * LSE_CFG_FRAME_HISTORY
+ *
+ * Number of recent frames lse_env_get_frame_stats() computes phase timings from.
+ */
+#ifndef LSE_CFG_FRAME_HISTORY
+#define LSE_CFG_FRAME_HISTORY 120
+#endif
+
+/*
+ * LSE_CFG_TRACE
+ *
+ * Build with trace_event export (1) or without (0). When 0, trace points compile to nothing and VAR_LSE_TRACE_FILE
+ * is ignored.
+ */
+#ifndef LSE_CFG_TRACE
+#define LSE_CFG_TRACE 0
+#endif
+
 // Endianness API
 
 #define LSE_LITTLE_ENDIAN 0
@@ -16,9 +16,13 @@
 #include "lse_font_store.h"
 #include "lse_gamepad.h"
 #include "lse_graphics.h"
+#include "lse_image_store.h"
 #include "lse_keyboard.h"
+#include "lse_memory.h"
 #include "lse_object.h"
 #include "lse_string.h"
+#include "lse_trace.h"
+#include "lse_util.h"
 #include "lse_video.h"
 #include "lse_window.h"
 
@@ -59,6 +63,30 @@ static lse_gamepad* find_gamepad_by_instance_id(lse_env* env, int32_t instance_i
 static void lse_env_load_mappings_sync(lse_env* env);
 static void update_gamepad_mapping(lse_env* env, const char* uuid);
 
+#if LSE_CFG_TRACE
+typedef struct traced_task traced_task;
+
+// wraps the user callbacks of a thread pool task to time the queue, work and complete steps
+struct traced_task {
+  const char* name;
+  lse_thread_pool_work_callback work;
+  lse_thread_pool_complete_callback complete;
+  void* user_data;
+  lse_thread_pool_user_data_finalize finalize;
+  double queue_ms;
+  double work_start_ms;
+  double work_end_ms;
+};
+
+static lse_thread_pool_task* add_traced_thread_pool_task(
+    lse_env* env,
+    const char* resource_name,
+    lse_thread_pool_work_callback work_callback,
+    lse_thread_pool_complete_callback complete_callback,
+    void* user_data,
+    lse_thread_pool_user_data_finalize user_data_finalize);
+#endif
+
 static void constructor(lse_object* object, void* arg) {
   lse_env* env = (lse_env*)object;
 
@@ -67,6 +95,7 @@ static void constructor(lse_object* object, void* arg) {
   env->windows = cvec_windows_init();
   env->mappings = cmap_mappings_init();
   env->fonts = lse_new(lse_font_store, env);
+  env->images = lse_new(lse_image_store, env);
 
   lse_env_reset_event_callbacks(env);
 }
@@ -79,6 +108,7 @@ static void destructor(lse_object* object) {
   lse_unref(env->video);
   lse_unref(env->keyboard);
   lse_unref(env->fonts);
+  lse_unref(env->images);
   cvec_gamepads_drop(&env->gamepads);
   cvec_windows_drop(&env->windows);
   cmap_mappings_drop(&env->mappings);
@@ -112,6 +142,9 @@ LSE_API lse_status LSE_CDECL lse_env_configure(lse_env* env, const lse_settings*
 
   // TODO: add validation when more settings are added
 
+  env->render_settings = settings->render_settings;
+  env->frame_pacer = lse_frame_pacer_init(settings->render_settings.vsync, settings->render_settings.fps_limit);
+
   //
   // select video backend from settings
   //
@@ -183,6 +216,8 @@ LSE_API lse_status LSE_CDECL lse_env_configure(lse_env* env, const lse_settings*
   env->video = video;
   env->state = LSE_ENV_STATE_RUNNING;
 
+  LSE_TRACE_OPEN();
+
   return LSE_OK;
 
   //
@@ -208,8 +243,14 @@ LSE_API void LSE_CDECL lse_env_destroy(lse_env* env) {
     return;
   }
 
+#if LSE_CFG_TRACE
+  bool was_configured = lse_env_is_configured(env);
+#endif
+
   lse_font_store_destroy(env->fonts);
   cvec_windows_clear(&env->windows);
+  // after the windows, so their images are released before the store is destroyed
+  lse_image_store_destroy(env->images);
   cvec_gamepads_clear(&env->gamepads);
 
   if (env->keyboard) {
@@ -228,6 +269,13 @@ LSE_API void LSE_CDECL lse_env_destroy(lse_env* env) {
   lse_sdl_unload(&env->sdl);
 
   env->state = LSE_ENV_STATE_DONE;
+
+#if LSE_CFG_TRACE
+  // after the thread pool is freed, so cancelled tasks are not traced to a closed file
+  if (was_configured) {
+    LSE_TRACE_CLOSE();
+  }
+#endif
 }
 
 LSE_API bool LSE_CDECL lse_env_is_configured(lse_env* env) {
@@ -294,14 +342,75 @@ LSE_API void LSE_CDECL lse_env_reset_event_callbacks(lse_env* env) {
 }
 
 LSE_API void LSE_CDECL lse_env_update(lse_env* env) {
+  double frame_start = lse_get_time_ms();
+  double frame_end;
+  bool presented = false;
+
   // TODO: check running?
   if (!lse_video_process_events(env->video)) {
     env->was_quit_requested = true;
     return;
   }
 
+  lse_frame_timing_mark(&env->frame_timing, LSE_FRAME_PHASE_EVENTS, frame_start);
+
+  // layout, paint, composite, upload and present phases are recorded by the windows
   c_foreach(it, cvec_windows, env->windows) {
-    lse_window_present(*it.ref);
+    if (lse_window_present(*it.ref)) {
+      presented = true;
+    }
+  }
+
+  frame_end = lse_frame_timing_mark(&env->frame_timing, LSE_FRAME_PHASE_FRAME, frame_start);
+
+  if (lse_frame_pacer_end_frame(
+          &env->frame_pacer,
+          frame_start,
+          env->frame_timing.current[LSE_FRAME_PHASE_PRESENT],
+          presented,
+          frame_end)) {
+    // adaptive vsync changed
+    c_foreach(it, cvec_windows, env->windows) {
+      lse_window_set_vsync(*it.ref, env->frame_pacer.is_vsync_enabled);
+    }
+  }
+
+  if (presented) {
+    lse_frame_timing_end_frame(&env->frame_timing);
+  } else {
+    lse_frame_timing_skip_frame(&env->frame_timing);
+  }
+}
+
+LSE_API double LSE_CDECL lse_env_get_frame_delay(lse_env* env) {
+  return lse_frame_pacer_get_delay(&env->frame_pacer, lse_get_time_ms());
+}
+
+LSE_API void LSE_CDECL lse_env_get_frame_stats(lse_env* env, lse_frame_stats* stats) {
+  lse_frame_timing_get_stats(&env->frame_timing, stats);
+}
+
+LSE_API void LSE_CDECL lse_env_get_image_cache_stats(lse_env* env, lse_image_cache_stats* stats) {
+  lse_render_stats render_stats;
+  lse_image_store_stats store_stats;
+
+  lse_image_store_get_stats(env->images, &store_stats);
+
+  *stats = (lse_image_cache_stats){
+    .budget_bytes = env->render_settings.image_cache_budget,
+    .retained_count = store_stats.retained_count,
+    .retained_bytes = store_stats.retained_bytes,
+    .hits = store_stats.hits,
+    .misses = store_stats.misses,
+    .retained_evictions = store_stats.evictions,
+  };
+
+  c_foreach(it, cvec_windows, env->windows) {
+    lse_window_get_render_stats(*it.ref, true, &render_stats);
+
+    stats->image_count += render_stats.image_cache_count;
+    stats->resident_bytes += render_stats.image_cache_bytes;
+    stats->evictions += render_stats.image_cache_evictions;
   }
 }
 
@@ -643,6 +752,13 @@ void lse_env_on_gamepad_disconnected(lse_env* env, int32_t instance_id) {
   LSE_LOG_ERROR("no gamepad for id = %i", instance_id);
 }
 
+void lse_env_on_window_damaged(lse_env* env) {
+  // there is one window in practice, so the window id of the event is not matched
+  c_foreach(it, cvec_windows, env->windows) {
+    lse_window_invalidate(*it.ref);
+  }
+}
+
 // if loading a gamecontroller db is exposed publicly, gamepads and mappings will need to be updated.
 static void lse_env_load_mappings_sync(lse_env* env) {
   int32_t result;
@@ -738,9 +854,78 @@ lse_thread_pool_task* lse_env_add_thread_pool_task(
     lse_thread_pool_complete_callback complete_callback,
     void* user_data,
     lse_thread_pool_user_data_finalize user_data_finalize) {
+#if LSE_CFG_TRACE
+  if (lse_trace_is_enabled()) {
+    return add_traced_thread_pool_task(
+        env, resource_name, work_callback, complete_callback, user_data, user_data_finalize);
+  }
+#endif
+
   return env->pool_queue(env->pool, resource_name, work_callback, complete_callback, user_data, user_data_finalize);
 }
 
+#if LSE_CFG_TRACE
+
+// @private
+static void traced_task_work(void* user_data) {
+  traced_task* task = user_data;
+
+  // runs on a pool thread. only timestamps are recorded here; spans are written on the main thread in complete.
+  task->work_start_ms = lse_get_time_ms();
+  task->work(task->user_data);
+  task->work_end_ms = lse_get_time_ms();
+}
+
+// @private
+static void traced_task_complete(lse_env* env, void* user_data) {
+  traced_task* task = user_data;
+  uint64_t id = lse_trace_next_id();
+
+  LSE_TRACE_BEGIN(start);
+
+  lse_trace_async_span("task", "queue", id, task->queue_ms, task->work_start_ms);
+  lse_trace_async_span("task", task->name, id, task->work_start_ms, task->work_end_ms);
+  task->complete(env, task->user_data);
+  LSE_TRACE_END(start, "task", task->name);
+}
+
+// @private
+static void traced_task_finalize(void* user_data) {
+  traced_task* task = user_data;
+
+  if (task->user_data && task->finalize) {
+    task->finalize(task->user_data);
+  }
+
+  free(task);
+}
+
+// @private
+static lse_thread_pool_task* add_traced_thread_pool_task(
+    lse_env* env,
+    const char* resource_name,
+    lse_thread_pool_work_callback work_callback,
+    lse_thread_pool_complete_callback complete_callback,
+    void* user_data,
+    lse_thread_pool_user_data_finalize user_data_finalize) {
+  traced_task* task = lse_malloc(sizeof(traced_task));
+
+  *task = (traced_task){
+    .name = resource_name,
+    .work = work_callback,
+    .complete = complete_callback,
+    .user_data = user_data,
+    .finalize = user_data_finalize,
+    .queue_ms = lse_get_time_ms(),
+  };
+
+  // the pool owns the wrapper now. traced_task_finalize frees it, even when queueing fails, so it is not freed here.
+  return env->pool_queue(
+      env->pool, resource_name, &traced_task_work, &traced_task_complete, task, &traced_task_finalize);
+}
+
+#endif
+
 void lse_env_cancel_thread_pool_task(lse_env* env, lse_thread_pool_task* task) {
   if (env->pool_cancel) {
     env->pool_cancel(env->pool, task);
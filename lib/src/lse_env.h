@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include "lse_frame_pacer.h"
+#include "lse_frame_timing.h"
 #include "lse_sdl.h"
 #include "lse_types.h"
 #include <lse.h>
@@ -37,6 +39,11 @@ struct lse_env {
   lse_video* video;
   lse_keyboard* keyboard;
   lse_font_store* fonts;
+  // decoded images shared by all windows
+  lse_image_store* images;
+  lse_render_settings render_settings;
+  lse_frame_timing frame_timing;
+  lse_frame_pacer frame_pacer;
   cvec_gamepads gamepads;
   cvec_windows windows;
   cmap_mappings mappings;
@@ -60,6 +67,7 @@ struct lse_env {
 
 void lse_env_on_gamepad_connected(lse_env* env, int32_t index);
 void lse_env_on_gamepad_disconnected(lse_env* env, int32_t instance_id);
+void lse_env_on_window_damaged(lse_env* env);
 void cmap_mappings_entry_drop(cmap_mappings_entry* entry);
 void cvec_windows_value_drop(lse_window_ptr* window);
 void cvec_gamepads_value_drop(lse_gamepad_ptr* gamepad);
@@ -13,7 +13,9 @@
 
 #include "lse_font.h"
 
+#include "lse_cfg.h"
 #include "lse_event.h"
+#include "lse_memory.h"
 #include "lse_object.h"
 #include "lse_rect.h"
 #include "lse_style.h"
@@ -21,7 +23,58 @@
 #include <ctype.h>
 #include <freetype/freetype.h>
 #include <freetype/ftadvanc.h>
-#include <freetype/ftglyph.h>
+#include <string.h>
+
+typedef struct glyph_cache_entry glyph_cache_entry;
+typedef glyph_cache_entry* glyph_cache_entry_ptr;
+
+// rasterized glyph bitmap. entries are linked in most recently used order.
+struct glyph_cache_entry {
+  uint64_t key;
+  glyph_cache_entry* prev;
+  glyph_cache_entry* next;
+  int32_t x_offset;
+  int32_t y_offset;
+  int32_t width;
+  int32_t height;
+  uint8_t buffer[];
+};
+
+#define i_tag glyph_cache
+#define i_key uint64_t
+#define i_val glyph_cache_entry_ptr
+#define i_opt c_no_clone
+#include <stc/cmap.h>
+
+#define i_tag advance_cache
+#define i_key uint32_t
+#define i_val float
+#define i_opt c_no_clone
+#include <stc/cmap.h>
+
+#define i_tag kerning_cache
+#define i_key uint64_t
+#define i_val float
+#define i_opt c_no_clone
+#include <stc/cmap.h>
+
+// number of font sizes with cached metrics per font
+#define METRICS_CACHE_SIZE_COUNT 4
+// codepoints below this value are stored in a flat array, rather than the advance hash
+#define METRICS_CACHE_FLAT_SIZE 256
+// upper bound on cached kerning pairs per font size. when reached, the pairs are cleared.
+#define METRICS_CACHE_KERNING_LIMIT 4096
+#define METRICS_CACHE_UNSET (-1.f)
+
+typedef struct font_metrics font_metrics;
+
+// advance and kerning values for one font size
+struct font_metrics {
+  float font_size;
+  float flat_advances[METRICS_CACHE_FLAT_SIZE];
+  cmap_advance_cache advances;
+  cmap_kerning_cache kerning;
+};
 
 struct lse_font {
   lse_font_info info;
@@ -37,8 +90,36 @@ struct lse_font {
   float line_height;
 
   bool has_kerning;
+
+  cmap_glyph_cache glyph_cache;
+  glyph_cache_entry* glyph_cache_head;
+  glyph_cache_entry* glyph_cache_tail;
+  size_t glyph_cache_size;
+  size_t glyph_cache_budget;
+  uint64_t glyph_cache_hits;
+  uint64_t glyph_cache_misses;
+  uint64_t glyph_cache_evictions;
+
+  font_metrics* metrics_cache[METRICS_CACHE_SIZE_COUNT];
+  font_metrics* metrics;
+  int32_t metrics_cache_next;
+  bool metrics_cache_enabled;
+  uint64_t metrics_cache_hits;
+  uint64_t metrics_cache_misses;
 };
 
+static uint64_t glyph_cache_key(lse_font* font, uint32_t glyph_index);
+static glyph_cache_entry* glyph_cache_get(lse_font* font, uint64_t key);
+static glyph_cache_entry* glyph_cache_put(lse_font* font, uint64_t key, FT_GlyphSlot slot);
+static void glyph_cache_evict(lse_font* font, size_t budget, glyph_cache_entry* keep);
+static void glyph_cache_clear(lse_font* font);
+static void glyph_cache_unlink(lse_font* font, glyph_cache_entry* entry);
+static void glyph_cache_link_front(lse_font* font, glyph_cache_entry* entry);
+static float ft_get_advance(lse_font* font, uint32_t cp);
+static float ft_get_kerning(lse_font* font, uint32_t cp1, uint32_t cp2);
+static font_metrics* metrics_cache_use(lse_font* font, float font_size);
+static void metrics_cache_clear(lse_font* font);
+
 static void constructor(lse_object* object, void* arg) {
   lse_font* self = (lse_font*)object;
   lse_font_info* info = arg;
@@ -46,12 +127,18 @@ static void constructor(lse_object* object, void* arg) {
   self->info = *info;
   self->state = LSE_RESOURCE_STATE_INIT;
   self->observers = lse_font_observers_init();
+  self->glyph_cache = cmap_glyph_cache_init();
+  self->glyph_cache_budget = LSE_CFG_GLYPH_CACHE_BUDGET;
+  self->metrics_cache_enabled = true;
 }
 
 static void destructor(lse_object* object) {
   lse_font* self = (lse_font*)object;
 
   lse_font_observers_drop(&self->observers);
+  glyph_cache_clear(self);
+  cmap_glyph_cache_drop(&self->glyph_cache);
+  metrics_cache_clear(self);
 }
 
 void lse_font_destroy(lse_font* font) {
@@ -60,6 +147,8 @@ void lse_font_destroy(lse_font* font) {
   }
 
   lse_font_observers_clear(&font->observers);
+  glyph_cache_clear(font);
+  metrics_cache_clear(font);
 
   if (font->face) {
     FT_Done_Face(font->face);
@@ -169,12 +258,14 @@ bool lse_font_use_font_size(lse_font* font, float font_size) {
     font->font_size = font_size;
     font->ascent = LSE_FROM_FLOAT_266(font->face->size->metrics.ascender);
     font->line_height = LSE_FROM_FLOAT_266(font->face->size->metrics.height);
+    font->metrics = font->metrics_cache_enabled ? metrics_cache_use(font, font_size) : NULL;
 
     return true;
   } else {
     font->font_size = 0;
     font->ascent = 0;
     font->line_height = 0;
+    font->metrics = NULL;
 
     return false;
   }
@@ -193,26 +284,71 @@ float lse_font_get_line_height(lse_font* font) {
 }
 
 float lse_font_get_kerning(lse_font* font, uint32_t cp1, uint32_t cp2) {
-  FT_Vector kerning;
-  uint32_t char_index_1 = FT_Get_Char_Index(font->face, cp1);
-  uint32_t char_index_2 = FT_Get_Char_Index(font->face, cp2);
+  font_metrics* metrics = font->metrics;
+  const cmap_kerning_cache_value* value;
+  uint64_t key;
+  float kerning;
 
-  if (FT_Get_Kerning(font->face, char_index_1, char_index_2, FT_KERNING_DEFAULT, &kerning) == FT_Err_Ok) {
-    return LSE_FROM_FLOAT_266(kerning.x);
+  if (!font->has_kerning) {
+    return 0;
   }
 
-  return 0;
+  if (!metrics) {
+    return ft_get_kerning(font, cp1, cp2);
+  }
+
+  key = ((uint64_t)cp1 << 32) | cp2;
+  value = cmap_kerning_cache_get(&metrics->kerning, key);
+
+  if (value) {
+    font->metrics_cache_hits++;
+    return value->second;
+  }
+
+  font->metrics_cache_misses++;
+  kerning = ft_get_kerning(font, cp1, cp2);
+
+  if (cmap_kerning_cache_size(metrics->kerning) >= METRICS_CACHE_KERNING_LIMIT) {
+    cmap_kerning_cache_clear(&metrics->kerning);
+  }
+
+  cmap_kerning_cache_insert(&metrics->kerning, key, kerning);
+
+  return kerning;
 }
 
 float lse_font_get_advance(lse_font* font, uint32_t cp) {
-  FT_Fixed advance1616;
-  uint32_t char_index = FT_Get_Char_Index(font->face, cp);
+  font_metrics* metrics = font->metrics;
+  const cmap_advance_cache_value* value;
+  float advance;
 
-  if (FT_Get_Advance(font->face, char_index, FT_LOAD_NO_BITMAP, &advance1616) != FT_Err_Ok) {
-    return 0;
+  if (!metrics) {
+    return ft_get_advance(font, cp);
   }
 
-  return LSE_FROM_FLOAT_266((int32_t)advance1616 >> 10);
+  if (cp < METRICS_CACHE_FLAT_SIZE) {
+    if (metrics->flat_advances[cp] != METRICS_CACHE_UNSET) {
+      font->metrics_cache_hits++;
+      return metrics->flat_advances[cp];
+    }
+
+    font->metrics_cache_misses++;
+
+    return (metrics->flat_advances[cp] = ft_get_advance(font, cp));
+  }
+
+  value = cmap_advance_cache_get(&metrics->advances, cp);
+
+  if (value) {
+    font->metrics_cache_hits++;
+    return value->second;
+  }
+
+  font->metrics_cache_misses++;
+  advance = ft_get_advance(font, cp);
+  cmap_advance_cache_insert(&metrics->advances, cp, advance);
+
+  return advance;
 }
 
 float lse_font_get_advance_and_kerning(lse_font* font, uint32_t codepoint, uint32_t previous) {
@@ -224,39 +360,80 @@ bool lse_font_has_kerning(lse_font* font) {
   return font->has_kerning;
 }
 
-bool lse_font_get_glyph_surface(lse_font* font, uint32_t codepoint, lse_glyph_surface* surface) {
-  FT_Glyph glyph;
-  FT_BitmapGlyph bitmap_glyph;
+void lse_font_set_metrics_cache_enabled(lse_font* font, bool enabled) {
+  font->metrics_cache_enabled = enabled;
 
-  if (isspace((int32_t)codepoint)) {
-    return false;
+  if (!enabled) {
+    metrics_cache_clear(font);
+  } else if (!font->metrics && font->font_size > 0) {
+    font->metrics = metrics_cache_use(font, font->font_size);
   }
+}
 
-  if (FT_Load_Glyph(font->face, FT_Get_Char_Index(font->face, codepoint), FT_LOAD_RENDER) != FT_Err_Ok) {
-    return false;
-  }
+void lse_font_get_metrics_cache_stats(lse_font* font, lse_metrics_cache_stats* out) {
+  *out = (lse_metrics_cache_stats){
+    .hits = font->metrics_cache_hits,
+    .misses = font->metrics_cache_misses,
+  };
+}
 
-  if (FT_Get_Glyph(font->face->glyph, &glyph) != FT_Err_Ok) {
-    return false;
-  }
+bool lse_font_get_glyph_surface(lse_font* font, uint32_t codepoint, lse_glyph_surface* surface) {
+  uint32_t glyph_index;
+  uint64_t key;
+  glyph_cache_entry* entry;
 
-  if (glyph->format != FT_GLYPH_FORMAT_BITMAP) {
-    FT_Done_Glyph(glyph);
+  if (isspace((int32_t)codepoint) || !font->face) {
     return false;
   }
 
-  bitmap_glyph = (FT_BitmapGlyph)glyph;
+  glyph_index = FT_Get_Char_Index(font->face, codepoint);
+  key = glyph_cache_key(font, glyph_index);
+  entry = glyph_cache_get(font, key);
 
-  surface->x_offset = bitmap_glyph->left;
-  surface->y_offset = bitmap_glyph->top;
-  surface->surface.width = (int32_t)bitmap_glyph->bitmap.width;
-  surface->surface.height = (int32_t)bitmap_glyph->bitmap.rows;
-  surface->surface.pitch = (int32_t)bitmap_glyph->bitmap.pitch;
-  surface->surface.buffer = bitmap_glyph->bitmap.buffer;
+  if (entry) {
+    font->glyph_cache_hits++;
+  } else {
+    font->glyph_cache_misses++;
+
+    // render the glyph slot directly, rather than copying it to a FT_Glyph. the slot is owned by the face.
+    if (FT_Load_Glyph(font->face, glyph_index, FT_LOAD_RENDER) != FT_Err_Ok) {
+      return false;
+    }
+
+    if (font->face->glyph->format != FT_GLYPH_FORMAT_BITMAP ||
+        font->face->glyph->bitmap.pixel_mode != FT_PIXEL_MODE_GRAY) {
+      return false;
+    }
+
+    entry = glyph_cache_put(font, key, font->face->glyph);
+  }
+
+  surface->x_offset = entry->x_offset;
+  surface->y_offset = entry->y_offset;
+  surface->surface.width = entry->width;
+  surface->surface.height = entry->height;
+  surface->surface.pitch = entry->width;
+  surface->surface.buffer = entry->buffer;
 
   return true;
 }
 
+void lse_font_set_glyph_cache_budget(lse_font* font, size_t budget_bytes) {
+  font->glyph_cache_budget = budget_bytes;
+  glyph_cache_evict(font, budget_bytes, NULL);
+}
+
+void lse_font_get_glyph_cache_stats(lse_font* font, lse_glyph_cache_stats* out) {
+  *out = (lse_glyph_cache_stats){
+    .hits = font->glyph_cache_hits,
+    .misses = font->glyph_cache_misses,
+    .evictions = font->glyph_cache_evictions,
+    .glyph_count = cmap_glyph_cache_size(font->glyph_cache),
+    .resident_bytes = font->glyph_cache_size,
+    .budget_bytes = font->glyph_cache_budget,
+  };
+}
+
 bool lse_font_key_equals(lse_font* font, lse_string* family, lse_style_font_style style, lse_style_font_weight weight) {
   if (!font || !family) {
     return !font && !family;
@@ -267,6 +444,211 @@ bool lse_font_key_equals(lse_font* font, lse_string* family, lse_style_font_styl
   return (lse_string_case_cmp(key->family, family) == 0) && (key->style == style) && (key->weight == weight);
 }
 
+// @private
+static float ft_get_advance(lse_font* font, uint32_t cp) {
+  FT_Fixed advance1616;
+  uint32_t char_index = FT_Get_Char_Index(font->face, cp);
+
+  if (FT_Get_Advance(font->face, char_index, FT_LOAD_NO_BITMAP, &advance1616) != FT_Err_Ok) {
+    return 0;
+  }
+
+  return LSE_FROM_FLOAT_266((int32_t)advance1616 >> 10);
+}
+
+// @private
+static float ft_get_kerning(lse_font* font, uint32_t cp1, uint32_t cp2) {
+  FT_Vector kerning;
+  uint32_t char_index_1 = FT_Get_Char_Index(font->face, cp1);
+  uint32_t char_index_2 = FT_Get_Char_Index(font->face, cp2);
+
+  if (FT_Get_Kerning(font->face, char_index_1, char_index_2, FT_KERNING_DEFAULT, &kerning) == FT_Err_Ok) {
+    return LSE_FROM_FLOAT_266(kerning.x);
+  }
+
+  return 0;
+}
+
+// @private
+static font_metrics* metrics_cache_use(lse_font* font, float font_size) {
+  font_metrics* metrics;
+  int32_t i;
+
+  for (i = 0; i < METRICS_CACHE_SIZE_COUNT; i++) {
+    metrics = font->metrics_cache[i];
+
+    if (metrics && lse_equals_f(metrics->font_size, font_size)) {
+      return metrics;
+    }
+  }
+
+  // not cached, take the next slot. when all slots are in use, slots are recycled in round robin order.
+  metrics = font->metrics_cache[font->metrics_cache_next];
+
+  if (metrics) {
+    cmap_advance_cache_clear(&metrics->advances);
+    cmap_kerning_cache_clear(&metrics->kerning);
+  } else {
+    metrics = lse_malloc(sizeof(font_metrics));
+    metrics->advances = cmap_advance_cache_init();
+    metrics->kerning = cmap_kerning_cache_init();
+    font->metrics_cache[font->metrics_cache_next] = metrics;
+  }
+
+  font->metrics_cache_next = (font->metrics_cache_next + 1) % METRICS_CACHE_SIZE_COUNT;
+
+  metrics->font_size = font_size;
+
+  for (i = 0; i < METRICS_CACHE_FLAT_SIZE; i++) {
+    metrics->flat_advances[i] = METRICS_CACHE_UNSET;
+  }
+
+  return metrics;
+}
+
+// @private
+static void metrics_cache_clear(lse_font* font) {
+  font_metrics* metrics;
+
+  for (int32_t i = 0; i < METRICS_CACHE_SIZE_COUNT; i++) {
+    metrics = font->metrics_cache[i];
+
+    if (metrics) {
+      cmap_advance_cache_drop(&metrics->advances);
+      cmap_kerning_cache_drop(&metrics->kerning);
+      free(metrics);
+      font->metrics_cache[i] = NULL;
+    }
+  }
+
+  font->metrics = NULL;
+  font->metrics_cache_next = 0;
+}
+
+// @private
+static uint64_t glyph_cache_key(lse_font* font, uint32_t glyph_index) {
+  // font size in 26.6 fixed point, the same resolution FreeType uses for char size
+  return ((uint64_t)glyph_index << 32) | (uint32_t)(font->font_size * 64.f);
+}
+
+// @private
+static glyph_cache_entry* glyph_cache_get(lse_font* font, uint64_t key) {
+  const cmap_glyph_cache_value* value = cmap_glyph_cache_get(&font->glyph_cache, key);
+  glyph_cache_entry* entry;
+
+  if (!value) {
+    return NULL;
+  }
+
+  entry = value->second;
+
+  if (entry != font->glyph_cache_head) {
+    glyph_cache_unlink(font, entry);
+    glyph_cache_link_front(font, entry);
+  }
+
+  return entry;
+}
+
+// @private
+static glyph_cache_entry* glyph_cache_put(lse_font* font, uint64_t key, FT_GlyphSlot slot) {
+  FT_Bitmap* bitmap = &slot->bitmap;
+  int32_t width = (int32_t)bitmap->width;
+  int32_t height = (int32_t)bitmap->rows;
+  size_t size = (size_t)(width * height);
+  glyph_cache_entry* entry = lse_malloc(sizeof(glyph_cache_entry) + size);
+  const uint8_t* src = bitmap->buffer;
+  int32_t pitch = bitmap->pitch;
+
+  entry->key = key;
+  entry->prev = entry->next = NULL;
+  entry->x_offset = slot->bitmap_left;
+  entry->y_offset = slot->bitmap_top;
+  entry->width = width;
+  entry->height = height;
+
+  // negative pitch means the bitmap rows are stored bottom up
+  if (pitch < 0) {
+    src -= pitch * (height - 1);
+  }
+
+  for (int32_t y = 0; y < height; y++) {
+    memcpy(entry->buffer + (y * width), src, (size_t)width);
+    src += pitch;
+  }
+
+  cmap_glyph_cache_insert(&font->glyph_cache, key, entry);
+  glyph_cache_link_front(font, entry);
+  font->glyph_cache_size += size;
+
+  glyph_cache_evict(font, font->glyph_cache_budget, entry);
+
+  return entry;
+}
+
+// @private
+static void glyph_cache_evict(lse_font* font, size_t budget, glyph_cache_entry* keep) {
+  glyph_cache_entry* entry;
+
+  while (font->glyph_cache_size > budget && font->glyph_cache_tail && font->glyph_cache_tail != keep) {
+    entry = font->glyph_cache_tail;
+
+    glyph_cache_unlink(font, entry);
+    cmap_glyph_cache_erase(&font->glyph_cache, entry->key);
+    font->glyph_cache_size -= (size_t)(entry->width * entry->height);
+    font->glyph_cache_evictions++;
+
+    free(entry);
+  }
+}
+
+// @private
+static void glyph_cache_clear(lse_font* font) {
+  glyph_cache_entry* entry = font->glyph_cache_head;
+  glyph_cache_entry* next;
+
+  while (entry) {
+    next = entry->next;
+    free(entry);
+    entry = next;
+  }
+
+  cmap_glyph_cache_clear(&font->glyph_cache);
+  font->glyph_cache_head = font->glyph_cache_tail = NULL;
+  font->glyph_cache_size = 0;
+}
+
+// @private
+static void glyph_cache_unlink(lse_font* font, glyph_cache_entry* entry) {
+  if (entry->prev) {
+    entry->prev->next = entry->next;
+  } else {
+    font->glyph_cache_head = entry->next;
+  }
+
+  if (entry->next) {
+    entry->next->prev = entry->prev;
+  } else {
+    font->glyph_cache_tail = entry->prev;
+  }
+
+  entry->prev = entry->next = NULL;
+}
+
+// @private
+static void glyph_cache_link_front(lse_font* font, glyph_cache_entry* entry) {
+  entry->prev = NULL;
+  entry->next = font->glyph_cache_head;
+
+  if (font->glyph_cache_head) {
+    font->glyph_cache_head->prev = entry;
+  } else {
+    font->glyph_cache_tail = entry;
+  }
+
+  font->glyph_cache_head = entry;
+}
+
 // ////////////////////////////////////////////////////////////////////////////
 // Export type information for lse_object.c:register_types().
 // ////////////////////////////////////////////////////////////////////////////
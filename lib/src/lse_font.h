@@ -20,6 +20,8 @@
 
 struct FT_FaceRec_;
 typedef struct lse_font_info lse_font_info;
+typedef struct lse_glyph_cache_stats lse_glyph_cache_stats;
+typedef struct lse_metrics_cache_stats lse_metrics_cache_stats;
 
 struct lse_font_info {
   lse_string* family;
@@ -29,6 +31,20 @@ struct lse_font_info {
   int32_t index;
 };
 
+struct lse_glyph_cache_stats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  size_t glyph_count;
+  size_t resident_bytes;
+  size_t budget_bytes;
+};
+
+struct lse_metrics_cache_stats {
+  uint64_t hits;
+  uint64_t misses;
+};
+
 void lse_font_destroy(lse_font* font);
 
 void lse_font_set_ready(lse_font* font, struct FT_FaceRec_* face, uint8_t* face_memory, size_t face_memory_size);
@@ -45,6 +61,30 @@ float lse_font_get_kerning(lse_font* font, uint32_t cp1, uint32_t cp2);
 float lse_font_get_advance(lse_font* font, uint32_t cp);
 float lse_font_get_advance_and_kerning(lse_font* font, uint32_t codepoint, uint32_t previous);
 bool lse_font_has_kerning(lse_font* font);
+
+/**
+ * Advance and kerning values are cached per (font, font size), so text measurement does not go back to FreeType
+ * for codepoints that have been seen before. Enabled by default. Disabling is intended for benchmarking.
+ */
+void lse_font_set_metrics_cache_enabled(lse_font* font, bool enabled);
+void lse_font_get_metrics_cache_stats(lse_font* font, lse_metrics_cache_stats* out);
+
+/**
+ * Get the rasterized glyph bitmap (8-bit alpha) of a codepoint at the current font size.
+ *
+ * Bitmaps are cached per (glyph index, font size) and owned by the font. The returned surface buffer is valid until
+ * the next call to this function, as a call can evict older glyphs from the cache.
+ *
+ * @return true if the glyph has a bitmap; false for whitespace, missing glyphs and rasterizer errors
+ */
 bool lse_font_get_glyph_surface(lse_font* font, uint32_t codepoint, lse_glyph_surface* surface);
 
+/**
+ * Set the maximum number of bytes of glyph bitmaps the font keeps in memory.
+ *
+ * If the cache is over the new budget, least recently used glyphs are evicted immediately.
+ */
+void lse_font_set_glyph_cache_budget(lse_font* font, size_t budget_bytes);
+void lse_font_get_glyph_cache_stats(lse_font* font, lse_glyph_cache_stats* out);
+
 bool lse_font_key_equals(lse_font* font, lse_string* family, lse_style_font_style style, lse_style_font_weight weight);
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_frame_pacer.h"
+
+#include "lse_util.h"
+#include <math.h>
+
+// weight of a new frame cost in the estimate. the estimate rises quickly, so a heavier scene does not miss vertical
+// blanks for long, and falls slowly, so one light frame does not schedule the next frame too late.
+#define COST_RISE_WEIGHT 0.5
+#define COST_FALL_WEIGHT 0.05
+// consecutive long frames before adaptive mode turns vsync off
+#define ADAPTIVE_LONG_FRAMES 3
+// consecutive short frames before adaptive mode turns vsync back on
+#define ADAPTIVE_SHORT_FRAMES 30
+// slack when rounding the fps limit to a whole number of refreshes, so a limit equal to the refresh rate is one refresh
+#define REFRESH_ROUNDING_EPSILON 0.01
+
+static void update_frame_interval(lse_frame_pacer* pacer);
+static void update_adaptive_vsync(lse_frame_pacer* pacer, double cost);
+
+lse_frame_pacer lse_frame_pacer_init(lse_vsync_mode vsync_mode, int32_t fps_limit) {
+  lse_frame_pacer pacer = {
+    .vsync_mode = vsync_mode,
+    .fps_limit = fps_limit > 0 ? fps_limit : 0,
+    .refresh_interval = 1000.0 / LSE_CFG_FRAME_RATE,
+    .is_vsync_enabled = vsync_mode != LSE_VSYNC_MODE_OFF,
+  };
+
+  update_frame_interval(&pacer);
+
+  return pacer;
+}
+
+void lse_frame_pacer_set_display(
+    lse_frame_pacer* pacer,
+    int32_t refresh_rate,
+    bool is_vsync_enabled,
+    bool can_set_vsync) {
+  pacer->refresh_interval = 1000.0 / (refresh_rate > 0 ? refresh_rate : LSE_CFG_FRAME_RATE);
+  pacer->is_vsync_enabled = is_vsync_enabled;
+  pacer->long_frame_count = pacer->short_frame_count = 0;
+
+  if (pacer->vsync_mode == LSE_VSYNC_MODE_ADAPTIVE && !can_set_vsync) {
+    pacer->vsync_mode = is_vsync_enabled ? LSE_VSYNC_MODE_ON : LSE_VSYNC_MODE_OFF;
+  }
+
+  update_frame_interval(pacer);
+}
+
+bool lse_frame_pacer_end_frame(
+    lse_frame_pacer* pacer,
+    double frame_start,
+    double present_ms,
+    bool presented,
+    double now) {
+  double cost = lse_max(now - frame_start - present_ms, 0);
+  double weight = cost > pacer->cost_estimate ? COST_RISE_WEIGHT : COST_FALL_WEIGHT;
+  bool was_vsync_enabled = pacer->is_vsync_enabled;
+
+  if (presented) {
+    pacer->cost_estimate += (cost - pacer->cost_estimate) * weight;
+  }
+
+  if (presented && pacer->is_vsync_enabled) {
+    // present returned on a vertical blank: start the next frame just in time for the vertical blank it targets
+    pacer->next_frame = now + pacer->frame_interval - pacer->cost_estimate - LSE_CFG_FRAME_PACING_MARGIN;
+  } else {
+    pacer->next_frame = (pacer->next_frame > 0 ? pacer->next_frame : frame_start) + pacer->frame_interval;
+  }
+
+  if (pacer->next_frame < now) {
+    pacer->next_frame = now;
+  }
+
+  if (presented && pacer->vsync_mode == LSE_VSYNC_MODE_ADAPTIVE) {
+    update_adaptive_vsync(pacer, cost);
+  }
+
+  return was_vsync_enabled != pacer->is_vsync_enabled;
+}
+
+double lse_frame_pacer_get_delay(const lse_frame_pacer* pacer, double now) {
+  return pacer->next_frame > now ? pacer->next_frame - now : 0;
+}
+
+// @private
+static void update_frame_interval(lse_frame_pacer* pacer) {
+  double limit_interval = pacer->fps_limit > 0 ? 1000.0 / pacer->fps_limit : 0;
+
+  if (pacer->is_vsync_enabled) {
+    // a frame is shown for a whole number of refreshes, so round the limit to a refresh rate divisor
+    pacer->frame_interval = pacer->refresh_interval;
+
+    if (limit_interval > pacer->refresh_interval) {
+      pacer->frame_interval *= ceil(limit_interval / pacer->refresh_interval - REFRESH_ROUNDING_EPSILON);
+    }
+  } else {
+    pacer->frame_interval = limit_interval > 0 ? limit_interval : pacer->refresh_interval;
+  }
+}
+
+// @private
+static void update_adaptive_vsync(lse_frame_pacer* pacer, double cost) {
+  if (cost > pacer->frame_interval) {
+    pacer->long_frame_count++;
+    pacer->short_frame_count = 0;
+  } else if (cost + LSE_CFG_FRAME_PACING_MARGIN <= pacer->frame_interval) {
+    pacer->short_frame_count++;
+    pacer->long_frame_count = 0;
+  }
+
+  if (pacer->is_vsync_enabled && pacer->long_frame_count >= ADAPTIVE_LONG_FRAMES) {
+    pacer->is_vsync_enabled = false;
+  } else if (!pacer->is_vsync_enabled && pacer->short_frame_count >= ADAPTIVE_SHORT_FRAMES) {
+    pacer->is_vsync_enabled = true;
+  } else {
+    return;
+  }
+
+  pacer->long_frame_count = pacer->short_frame_count = 0;
+  update_frame_interval(pacer);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include "lse_cfg.h"
+#include "lse_types.h"
+
+typedef struct lse_frame_pacer lse_frame_pacer;
+
+/**
+ * Decides when the next frame starts.
+ *
+ * With vsync, a present returns on a vertical blank, so the time a present finished gives the phase of the display
+ * refresh. The next frame starts one frame interval after that, minus the estimated frame cost and a margin, so the
+ * frame is ready just before the vertical blank it is presented on. The caller sleeps until then instead of blocking
+ * in present. When vsync is off or nothing was presented, frames start on fixed deadlines one frame interval apart.
+ * A deadline that has passed moves to now, so a slow frame is not followed by a burst of catch up frames.
+ *
+ * In adaptive mode, vsync is turned off after a run of frames that do not fit in the frame interval and back on after
+ * a run of frames that do. The owner applies the change to the graphics backend.
+ */
+struct lse_frame_pacer {
+  lse_vsync_mode vsync_mode;
+  int32_t fps_limit;
+  // ms between display refreshes
+  double refresh_interval;
+  // ms between frames, after the fps limit has been applied
+  double frame_interval;
+  // smoothed ms a frame takes, not counting time blocked in present
+  double cost_estimate;
+  // lse_get_time_ms() time the next frame should start, or 0 to start it immediately
+  double next_frame;
+  // consecutive frames that did or did not fit in the frame interval, for adaptive vsync
+  int32_t long_frame_count;
+  int32_t short_frame_count;
+  bool is_vsync_enabled;
+};
+
+lse_frame_pacer lse_frame_pacer_init(lse_vsync_mode vsync_mode, int32_t fps_limit);
+
+/**
+ * Set the refresh rate (0 if unknown) and vsync state of the display frames are presented to.
+ *
+ * If the graphics backend cannot change vsync at runtime, adaptive mode falls back to the current vsync state.
+ */
+void lse_frame_pacer_set_display(
+    lse_frame_pacer* pacer,
+    int32_t refresh_rate,
+    bool is_vsync_enabled,
+    bool can_set_vsync);
+
+/**
+ * Schedule the next frame after a frame that started at frame_start and ended at now.
+ *
+ * present_ms is the time the frame spent in present and presented is false if the frame was skipped. Returns true if
+ * adaptive vsync changed is_vsync_enabled.
+ */
+bool lse_frame_pacer_end_frame(
+    lse_frame_pacer* pacer,
+    double frame_start,
+    double present_ms,
+    bool presented,
+    double now);
+
+/**
+ * Milliseconds from now until the next frame should start.
+ */
+double lse_frame_pacer_get_delay(const lse_frame_pacer* pacer, double now);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_frame_timing.h"
+
+#include "lse_trace.h"
+#include "lse_util.h"
+#include <stdlib.h>
+#include <string.h>
+
+static int compare_float(const void* a, const void* b);
+
+#if LSE_CFG_TRACE
+// trace span names, indexed by lse_frame_phase. per node type paint time is traced by individual on_paint spans.
+static const char* k_phase_trace_names[LSE_FRAME_PHASE_COUNT] = {
+  [LSE_FRAME_PHASE_FRAME] = "frame",
+  [LSE_FRAME_PHASE_EVENTS] = "events",
+  [LSE_FRAME_PHASE_LAYOUT] = "layout",
+  [LSE_FRAME_PHASE_RESOLVE] = "resolve",
+  [LSE_FRAME_PHASE_PAINT] = "paint",
+  [LSE_FRAME_PHASE_COMPOSITE] = "composite",
+  [LSE_FRAME_PHASE_UPLOAD] = "upload",
+  [LSE_FRAME_PHASE_PRESENT] = "present",
+};
+#endif
+
+double lse_frame_timing_mark(lse_frame_timing* timing, lse_frame_phase phase, double start) {
+  double now = lse_get_time_ms();
+
+  lse_frame_timing_add(timing, phase, now - start);
+
+#if LSE_CFG_TRACE
+  if (k_phase_trace_names[phase]) {
+    lse_trace_span("frame", k_phase_trace_names[phase], start, now, NULL);
+  }
+#endif
+
+  return now;
+}
+
+void lse_frame_timing_add(lse_frame_timing* timing, lse_frame_phase phase, double ms) {
+  timing->current[phase] += (float)ms;
+}
+
+void lse_frame_timing_end_frame(lse_frame_timing* timing) {
+  memcpy(timing->history[timing->next], timing->current, sizeof(timing->current));
+  memset(timing->current, 0, sizeof(timing->current));
+
+  timing->next = (timing->next + 1) % LSE_CFG_FRAME_HISTORY;
+
+  if (timing->count < LSE_CFG_FRAME_HISTORY) {
+    timing->count++;
+  }
+}
+
+void lse_frame_timing_skip_frame(lse_frame_timing* timing) {
+  memset(timing->current, 0, sizeof(timing->current));
+  timing->idle_count++;
+}
+
+void lse_frame_timing_get_stats(const lse_frame_timing* timing, lse_frame_stats* stats) {
+  float samples[LSE_CFG_FRAME_HISTORY];
+  uint32_t count = timing->count;
+
+  memset(stats, 0, sizeof(lse_frame_stats));
+  stats->frame_count = count;
+  stats->idle_frame_count = timing->idle_count;
+
+  if (count == 0) {
+    return;
+  }
+
+  for (int32_t phase = 0; phase < LSE_FRAME_PHASE_COUNT; phase++) {
+    double sum = 0;
+
+    // the ring buffer is only partially filled until count reaches the history size, but filled slots always start
+    // at 0, so the first count slots are the samples in either case
+    for (uint32_t i = 0; i < count; i++) {
+      samples[i] = timing->history[i][phase];
+      sum += samples[i];
+    }
+
+    qsort(samples, count, sizeof(float), &compare_float);
+
+    stats->phases[phase] = (lse_frame_phase_stats){
+      .min = samples[0],
+      .avg = (float)(sum / count),
+      // nearest rank
+      .p99 = samples[(count * 99 + 99) / 100 - 1],
+    };
+  }
+}
+
+// @private
+static int compare_float(const void* a, const void* b) {
+  float fa = *(const float*)a;
+  float fb = *(const float*)b;
+
+  return (fa > fb) - (fa < fb);
+}
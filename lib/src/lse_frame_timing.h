@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include "lse_cfg.h"
+#include "lse_types.h"
+
+typedef struct lse_frame_timing lse_frame_timing;
+
+/**
+ * Per phase timings of the most recent frames.
+ *
+ * Phases accumulate time into the current frame with mark or add. end_frame moves the current frame into a ring
+ * buffer of the last LSE_CFG_FRAME_HISTORY frames, where get_stats computes min, avg and p99 from. A zeroed struct is
+ * a valid, empty timing history.
+ *
+ * Frames that draw nothing end with skip_frame instead. They are counted, but kept out of the history, so idle time
+ * does not pull the stats of rendered frames towards zero.
+ */
+struct lse_frame_timing {
+  float history[LSE_CFG_FRAME_HISTORY][LSE_FRAME_PHASE_COUNT];
+  float current[LSE_FRAME_PHASE_COUNT];
+  // ring buffer slot the next frame is written to
+  uint32_t next;
+  uint32_t count;
+  // frames ended with skip_frame
+  uint64_t idle_count;
+};
+
+/**
+ * Add the time since start (from lse_get_time_ms) to a phase of the current frame.
+ *
+ * Returns the current time, so consecutive phases can be chained without reading the clock twice.
+ */
+double lse_frame_timing_mark(lse_frame_timing* timing, lse_frame_phase phase, double start);
+void lse_frame_timing_add(lse_frame_timing* timing, lse_frame_phase phase, double ms);
+void lse_frame_timing_end_frame(lse_frame_timing* timing);
+
+/**
+ * Discard the phase times of the current frame and count it as idle.
+ */
+void lse_frame_timing_skip_frame(lse_frame_timing* timing);
+void lse_frame_timing_get_stats(const lse_frame_timing* timing, lse_frame_stats* stats);
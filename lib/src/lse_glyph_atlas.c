@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_glyph_atlas.h"
+
+#define i_tag atlas_glyphs
+#define i_key uint32_t
+#define i_val lse_atlas_glyph
+#define i_opt c_no_clone | c_is_fwd
+#include <stc/cmap.h>
+
+#include "lse_object.h"
+#include "lse_util.h"
+
+// space between glyphs, so texture filtering does not bleed neighbouring glyphs into each other
+#define GLYPH_PADDING 1
+#define INITIAL_GLYPH_CAPACITY 128
+
+static bool next_page(lse_glyph_atlas* atlas);
+
+lse_glyph_atlas lse_glyph_atlas_init(lse_font* font, float font_size, int32_t page_size, int32_t max_pages) {
+  lse_ref(font);
+
+  return (lse_glyph_atlas){
+    .font = font,
+    .font_size = font_size,
+    .page_width = page_size,
+    .page_height = page_size,
+    .max_pages = max_pages,
+    .glyphs = cmap_atlas_glyphs_with_capacity(INITIAL_GLYPH_CAPACITY),
+  };
+}
+
+void lse_glyph_atlas_drop(lse_glyph_atlas* atlas) {
+  if (atlas) {
+    cmap_atlas_glyphs_drop(&atlas->glyphs);
+    lse_unref(atlas->font);
+    atlas->font = NULL;
+  }
+}
+
+bool lse_glyph_atlas_matches(lse_glyph_atlas* atlas, lse_font* font, float font_size) {
+  return atlas->font == font && lse_equals_f(atlas->font_size, font_size);
+}
+
+const lse_atlas_glyph* lse_glyph_atlas_find(lse_glyph_atlas* atlas, uint32_t codepoint) {
+  const cmap_atlas_glyphs_value* value = cmap_atlas_glyphs_get(&atlas->glyphs, codepoint);
+
+  return value ? &value->second : NULL;
+}
+
+const lse_atlas_glyph* lse_glyph_atlas_insert(
+    lse_glyph_atlas* atlas,
+    uint32_t codepoint,
+    int32_t width,
+    int32_t height,
+    int32_t x_offset,
+    int32_t y_offset) {
+  lse_atlas_glyph glyph = {
+    .page = LSE_GLYPH_ATLAS_NO_PAGE,
+    .x_offset = x_offset,
+    .y_offset = y_offset,
+  };
+  int32_t padded_width = width + GLYPH_PADDING;
+  int32_t padded_height = height + GLYPH_PADDING;
+
+  if (width <= 0 || height <= 0) {
+    goto DONE;
+  }
+
+  if (padded_width > atlas->page_width || padded_height > atlas->page_height) {
+    return NULL;
+  }
+
+  if (atlas->page_count == 0 && !next_page(atlas)) {
+    atlas->is_full = true;
+    return NULL;
+  }
+
+  // start a new shelf
+  if (atlas->shelf_x + padded_width > atlas->page_width) {
+    atlas->shelf_y += atlas->shelf_height;
+    atlas->shelf_x = 0;
+    atlas->shelf_height = 0;
+  }
+
+  // start a new page
+  if (atlas->shelf_y + padded_height > atlas->page_height && !next_page(atlas)) {
+    atlas->is_full = true;
+    return NULL;
+  }
+
+  glyph.page = atlas->page_count - 1;
+  glyph.rect = (lse_rect){ atlas->shelf_x, atlas->shelf_y, width, height };
+
+  atlas->shelf_x += padded_width;
+  atlas->shelf_height = lse_max(atlas->shelf_height, padded_height);
+
+DONE:
+  return &cmap_atlas_glyphs_insert_or_assign(&atlas->glyphs, codepoint, glyph).ref->second;
+}
+
+void lse_glyph_atlas_remove(lse_glyph_atlas* atlas, uint32_t codepoint) {
+  cmap_atlas_glyphs_erase(&atlas->glyphs, codepoint);
+}
+
+void lse_glyph_atlas_reset(lse_glyph_atlas* atlas) {
+  cmap_atlas_glyphs_clear(&atlas->glyphs);
+  atlas->page_count = 0;
+  atlas->shelf_x = 0;
+  atlas->shelf_y = 0;
+  atlas->shelf_height = 0;
+  atlas->is_full = false;
+}
+
+// @private
+static bool next_page(lse_glyph_atlas* atlas) {
+  if (atlas->page_count >= atlas->max_pages) {
+    return false;
+  }
+
+  atlas->page_count++;
+  atlas->shelf_x = 0;
+  atlas->shelf_y = 0;
+  atlas->shelf_height = 0;
+
+  return true;
+}
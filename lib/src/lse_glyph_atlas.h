@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include "lse_rect.h"
+#include "lse_types.h"
+
+#include <stc/forward.h>
+
+typedef struct lse_atlas_glyph lse_atlas_glyph;
+typedef struct lse_glyph_atlas lse_glyph_atlas;
+
+#define LSE_GLYPH_ATLAS_NO_PAGE (-1)
+
+struct lse_atlas_glyph {
+  // location of the glyph bitmap in the page
+  lse_rect rect;
+  // page index or LSE_GLYPH_ATLAS_NO_PAGE if the glyph has nothing to draw (whitespace or missing)
+  int32_t page;
+  int32_t x_offset;
+  int32_t y_offset;
+};
+
+forward_cmap(cmap_atlas_glyphs, uint32_t, lse_atlas_glyph);
+
+/**
+ * Glyph packing state for one (font, font size) pair.
+ *
+ * The atlas only does the bookkeeping: where each glyph bitmap lives (page + rect) and where the next glyph goes. The
+ * graphics backend owns the page textures and uploads glyph bitmaps to the rects handed out by insert. Pages are
+ * filled with a simple shelf packer. When a page is full, packing moves to a new page. Existing rects are never
+ * moved, so render objects can hold on to glyph locations until the atlas is reset or dropped.
+ */
+struct lse_glyph_atlas {
+  lse_font* font;
+  float font_size;
+  int32_t page_width;
+  int32_t page_height;
+  int32_t page_count;
+  int32_t max_pages;
+  int32_t shelf_x;
+  int32_t shelf_y;
+  int32_t shelf_height;
+  // a glyph did not fit after max_pages were used
+  bool is_full;
+  cmap_atlas_glyphs glyphs;
+};
+
+/**
+ * Create an empty atlas for a font at a font size (in px).
+ *
+ * The atlas holds a reference to font.
+ */
+lse_glyph_atlas lse_glyph_atlas_init(lse_font* font, float font_size, int32_t page_size, int32_t max_pages);
+void lse_glyph_atlas_drop(lse_glyph_atlas* atlas);
+
+bool lse_glyph_atlas_matches(lse_glyph_atlas* atlas, lse_font* font, float font_size);
+
+/**
+ * Find a previously inserted glyph. Returns NULL if the codepoint has not been inserted.
+ */
+const lse_atlas_glyph* lse_glyph_atlas_find(lse_glyph_atlas* atlas, uint32_t codepoint);
+
+/**
+ * Reserve space for a glyph bitmap.
+ *
+ * Zero sized glyphs are recorded with page = LSE_GLYPH_ATLAS_NO_PAGE, so subsequent lookups do not go back to the
+ * font. Glyphs larger than a page and glyphs that do not fit after max_pages have been used are not recorded and NULL
+ * is returned; the caller draws them some other way. The latter marks the atlas as full.
+ *
+ * The caller is responsible for uploading the glyph bitmap to the returned rect on the returned page.
+ */
+const lse_atlas_glyph* lse_glyph_atlas_insert(
+    lse_glyph_atlas* atlas,
+    uint32_t codepoint,
+    int32_t width,
+    int32_t height,
+    int32_t x_offset,
+    int32_t y_offset);
+
+/**
+ * Forget a single glyph, e.g. after its bitmap failed to upload. The packed space is not reclaimed until reset.
+ */
+void lse_glyph_atlas_remove(lse_glyph_atlas* atlas, uint32_t codepoint);
+
+/**
+ * Forget all glyphs and start packing from an empty first page. Rects handed out before the reset are invalid.
+ */
+void lse_glyph_atlas_reset(lse_glyph_atlas* atlas);
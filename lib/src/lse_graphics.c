@@ -13,6 +13,7 @@
 
 #include "lse_graphics.h"
 
+#include "lse_image.h"
 #include "lse_object.h"
 #include "lse_util.h"
 #include <assert.h>
@@ -109,6 +110,13 @@ void lse_graphics_base_push_state(lse_graphics* graphics) {
   state->has_clip_rect = false;
 }
 
+void lse_graphics_base_push_layer_state(lse_graphics* graphics) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  // a layer is drawn in its own coordinate space, so nothing is inherited from the current state
+  cstack_graphics_state_push(&base->state, k_empty_state);
+}
+
 void lse_graphics_base_pop_state(lse_graphics* graphics) {
   lse_graphics_base* base = lse_graphics_get_base(graphics);
 
@@ -164,6 +172,44 @@ const lse_rect* lse_graphics_base_get_clip_rect(lse_graphics* graphics) {
   return &cstack_graphics_state_top(&base->state)->clip_rect;
 }
 
+void lse_graphics_set_reload_image_callback(
+    lse_graphics* graphics,
+    lse_graphics_image_callback callback,
+    void* user_data) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  base->reload_image = callback;
+  base->reload_image_user_data = user_data;
+}
+
+void lse_graphics_base_reload_image(lse_graphics* graphics, lse_image* image) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  if (base->reload_image) {
+    base->reload_image(image, base->reload_image_user_data);
+  }
+}
+
+void lse_graphics_set_image_uploaded_callback(
+    lse_graphics* graphics,
+    lse_graphics_image_callback callback,
+    void* user_data) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  base->image_uploaded = callback;
+  base->image_uploaded_user_data = user_data;
+}
+
+void lse_graphics_base_image_uploaded(lse_graphics* graphics, lse_image* image) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  if (base->image_uploaded) {
+    base->image_uploaded(image, base->image_uploaded_user_data);
+  } else {
+    lse_image_release_pixels(image);
+  }
+}
+
 const lse_matrix* lse_graphics_base_get_matrix(lse_graphics* graphics) {
   lse_graphics_base* base = lse_graphics_get_base(graphics);
 
@@ -178,6 +224,35 @@ int32_t lse_graphics_get_height(lse_graphics* graphics) {
   return lse_graphics_get_base(graphics)->height;
 }
 
+float lse_graphics_get_opacity(lse_graphics* graphics) {
+  const lse_graphics_state* state = lse_graphics_base_get_state(graphics);
+
+  return state ? state->opacity : 1.f;
+}
+
+void lse_graphics_set_redraw_rect(lse_graphics* graphics, const lse_rect_f* viewport, const lse_rect_f* redraw_rect) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  base->viewport = *viewport;
+  base->redraw_rect = *redraw_rect;
+}
+
+void lse_graphics_begin_render_stats(lse_graphics* graphics) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  base->frame_stats = (lse_render_stats){
+    .image_cache_count = base->total_stats.image_cache_count,
+    .image_cache_bytes = base->total_stats.image_cache_bytes,
+    .render_object_count = base->total_stats.render_object_count,
+  };
+}
+
+const lse_render_stats* lse_graphics_get_render_stats(lse_graphics* graphics, bool cumulative) {
+  lse_graphics_base* base = lse_graphics_get_base(graphics);
+
+  return cumulative ? &base->total_stats : &base->frame_stats;
+}
+
 bool lse_graphics_begin_queue(lse_graphics* graphics) {
   lse_graphics_base* base = lse_graphics_get_base(graphics);
 
@@ -239,7 +314,11 @@ void lse_graphics_queue_draw_image(lse_graphics* graphics, lse_rect_f* rect, lse
       });
 }
 
-void lse_graphics_queue_draw_text(lse_graphics* graphics, lse_rect_f* rect, lse_text_style* style, lse_string* text) {
+void lse_graphics_queue_draw_text(
+    lse_graphics* graphics,
+    lse_rect_f* rect,
+    lse_text_style* style,
+    lse_text_layout* layout) {
   lse_graphics_base* base = lse_graphics_get_base(graphics);
 
   lse_render_queue_push(
@@ -248,6 +327,6 @@ void lse_graphics_queue_draw_text(lse_graphics* graphics, lse_rect_f* rect, lse_
           .type = LSE_RCT_DRAW_TEXT,
           .rect = rect,
           .text_style = style,
-          .text = text,
+          .text_layout = layout,
       });
 }
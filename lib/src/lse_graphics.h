@@ -38,10 +38,14 @@ struct lse_graphics_interface {
 
   void (*clear)(lse_graphics*, lse_color);
   void (*draw_render_object)(lse_graphics*, lse_render_object*, lse_color);
+  bool (*get_opaque_rect)(lse_graphics*, lse_render_object*, lse_color, lse_rect_f*);
   lse_render_object* (*destroy_render_object)(lse_graphics*, lse_render_object*);
 
   lse_render_object* (*end_queue)(lse_graphics*, int32_t, int32_t, lse_render_object*);
 
+  lse_render_object* (*begin_layer)(lse_graphics*, int32_t, int32_t, lse_render_object*);
+  void (*end_layer)(lse_graphics*);
+
   void (*push_state)(lse_graphics*);
   void (*pop_state)(lse_graphics*);
   const lse_matrix* (*get_matrix)(lse_graphics*);
@@ -50,6 +54,7 @@ struct lse_graphics_interface {
   void (*set_clip_rect)(lse_graphics*, lse_rect_f* rect);
 
   void (*remove_image)(lse_graphics*, lse_image*);
+  void (*set_vsync)(lse_graphics*, bool);
 };
 
 #define LSE_GRAPHICS_VTABLE()                                                                                          \
@@ -58,8 +63,11 @@ struct lse_graphics_interface {
     .destroy = destroy,                                                                                                \
     .is_destroyed = is_destroyed,                                                                                      \
     .draw_render_object = draw_render_object,                                                                          \
+    .get_opaque_rect = get_opaque_rect,                                                                                \
     .destroy_render_object = destroy_render_object,                                                                    \
     .end_queue = end_queue,                                                                                            \
+    .begin_layer = begin_layer,                                                                                        \
+    .end_layer = end_layer,                                                                                            \
     .begin = begin,                                                                                                    \
     .end = end,                                                                                                        \
     .clear = clear,                                                                                                    \
@@ -70,6 +78,7 @@ struct lse_graphics_interface {
     .set_matrix = set_matrix,                                                                                          \
     .set_opacity = set_opacity,                                                                                        \
     .set_clip_rect = set_clip_rect,                                                                                    \
+    .set_vsync = set_vsync,                                                                                            \
   };
 
 //
@@ -79,6 +88,8 @@ struct lse_graphics_interface {
 typedef struct lse_graphics_state lse_graphics_state;
 typedef struct lse_graphics_base lse_graphics_base;
 
+typedef void (*lse_graphics_image_callback)(lse_image* image, void* user_data);
+
 forward_cstack(cstack_graphics_state, lse_graphics_state);
 
 struct lse_graphics_state {
@@ -94,7 +105,27 @@ struct lse_graphics_base {
   nctx ctx;
   int32_t width;
   int32_t height;
+  // refresh rate of the display the graphics presents to or 0 if unknown
+  int32_t refresh_rate;
+  // presents wait for the vertical blank
+  bool is_vsync_enabled;
+  // vsync can be changed after configure with lse_graphics_set_vsync()
+  bool can_set_vsync;
   lse_render_queue render_queue;
+  // asks the owner of an image to decode it again, when a texture is needed after the pixels were released
+  lse_graphics_image_callback reload_image;
+  void* reload_image_user_data;
+  // tells the owner of an image that its pixels were uploaded to a texture
+  lse_graphics_image_callback image_uploaded;
+  void* image_uploaded_user_data;
+  // window area of the frame and the part of it the frame redraws. outside of the redraw rect, the screen still shows
+  // what earlier frames drew.
+  lse_rect_f viewport;
+  lse_rect_f redraw_rect;
+  // counters since lse_graphics_begin_render_stats()
+  lse_render_stats frame_stats;
+  // counters since the graphics was created
+  lse_render_stats total_stats;
 };
 
 //
@@ -120,15 +151,88 @@ struct lse_graphics_base {
 #define lse_graphics_set_opacity(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), set_opacity, __VA_ARGS__)
 #define lse_graphics_set_clip_rect(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), set_clip_rect, __VA_ARGS__)
 #define lse_graphics_draw_render_object(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), draw_render_object, __VA_ARGS__)
+/**
+ * Turn waiting for the vertical blank on or off. Ignored if the backend cannot change vsync after configure.
+ */
+#define lse_graphics_set_vsync(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), set_vsync, __VA_ARGS__)
+/**
+ * Check if drawing render_object with color in the current state would cover an area with fully opaque pixels.
+ *
+ * On success, rect is set to the covered area in render object space. The compositor uses this to skip content that
+ * would be painted over.
+ */
+#define lse_graphics_get_opaque_rect(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), get_opaque_rect, __VA_ARGS__)
 #define lse_graphics_get_render_object_offset(INSTANCE, ...)                                                           \
   LSE_GRAPHICS_A((INSTANCE), get_render_object_offset, __VA_ARGS__)
 #define lse_graphics_destroy_render_object(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), destroy_render_object, __VA_ARGS__)
 #define lse_graphics_end_queue(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), end_queue, __VA_ARGS__)
 
+/**
+ * Redirect drawing to an offscreen render object of width x height.
+ *
+ * render_object is the layer from the last call, or NULL. It is reused when possible. Drawing starts from a
+ * transparent texture and a fresh state (identity matrix, full opacity, no clip). Returns NULL if the layer could not
+ * be created; render_object is destroyed in that case and drawing stays on the current target.
+ */
+#define lse_graphics_begin_layer(INSTANCE, ...) LSE_GRAPHICS_A((INSTANCE), begin_layer, __VA_ARGS__)
+/**
+ * Finish a layer started by a successful lse_graphics_begin_layer() and restore the previous target and state.
+ */
+#define lse_graphics_end_layer(INSTANCE) LSE_GRAPHICS_V((INSTANCE), end_layer)
+
 void lse_graphics_reset_state(lse_graphics* graphics);
 int32_t lse_graphics_get_width(lse_graphics* graphics);
 int32_t lse_graphics_get_height(lse_graphics* graphics);
 
+/**
+ * Opacity of the current state, accumulated from every set_opacity since the last reset or layer.
+ */
+float lse_graphics_get_opacity(lse_graphics* graphics);
+
+/**
+ * Set the window area of the current frame and the part of it that is redrawn.
+ *
+ * With partial redraw, content outside of redraw_rect stays on screen from earlier frames. The backend keeps the
+ * resources that content was drawn with.
+ */
+void lse_graphics_set_redraw_rect(lse_graphics* graphics, const lse_rect_f* viewport, const lse_rect_f* redraw_rect);
+
+/**
+ * Start counting the render stats of a new frame.
+ *
+ * Frame counters are reset. Gauges (image cache and render object counts) carry over, as they describe resources that
+ * outlive a frame.
+ */
+void lse_graphics_begin_render_stats(lse_graphics* graphics);
+const lse_render_stats* lse_graphics_get_render_stats(lse_graphics* graphics, bool cumulative);
+
+/**
+ * Add N to a field of the frame and cumulative render stats. Gauges are decremented with a negative N.
+ */
+#define lse_graphics_add_render_stat(GRAPHICS, FIELD, N)                                                               \
+  do {                                                                                                                 \
+    lse_graphics_get_base(GRAPHICS)->frame_stats.FIELD += (N);                                                         \
+    lse_graphics_get_base(GRAPHICS)->total_stats.FIELD += (N);                                                         \
+  } while (0)
+
+/**
+ * Set the function the graphics calls when an image has to be drawn, but neither its texture nor its pixels are
+ * resident. The owner of the image is expected to decode the image again and move it back to the READY state.
+ */
+void lse_graphics_set_reload_image_callback(
+    lse_graphics* graphics,
+    lse_graphics_image_callback callback,
+    void* user_data);
+
+/**
+ * Set the function the graphics calls after the pixels of an image have been uploaded to a texture. The owner of the
+ * image decides whether the pixels are still needed. Without a callback, the pixels are released after upload.
+ */
+void lse_graphics_set_image_uploaded_callback(
+    lse_graphics* graphics,
+    lse_graphics_image_callback callback,
+    void* user_data);
+
 bool lse_graphics_begin_queue(lse_graphics* graphics);
 void lse_graphics_queue_stroke_rect(
     lse_graphics* graphics,
@@ -145,7 +249,11 @@ void lse_graphics_queue_rounded_rect(
     lse_color stroke_color);
 void lse_graphics_queue_draw_image(lse_graphics* graphics, lse_rect_f* rect, lse_image* image, lse_rect* src_rect);
 // TODO: add text
-void lse_graphics_queue_draw_text(lse_graphics* graphics, lse_rect_f* rect, lse_text_style* style, lse_string* text);
+void lse_graphics_queue_draw_text(
+    lse_graphics* graphics,
+    lse_rect_f* rect,
+    lse_text_style* style,
+    lse_text_layout* layout);
 
 //
 // protected base class api
@@ -158,6 +266,7 @@ bool lse_graphics_base_is_destroyed(lse_graphics* graphics);
 void lse_graphics_base_end(lse_graphics* graphics);
 void lse_graphics_base_push_state(lse_graphics* graphics);
 void lse_graphics_base_pop_state(lse_graphics* graphics);
+void lse_graphics_base_push_layer_state(lse_graphics* graphics);
 const lse_graphics_state* lse_graphics_base_get_state(lse_graphics* graphics);
 const lse_matrix* lse_graphics_base_get_matrix(lse_graphics* graphics);
 void lse_graphics_base_set_matrix(lse_graphics* graphics, lse_matrix* matrix);
@@ -165,6 +274,16 @@ void lse_graphics_base_set_opacity(lse_graphics* graphics, float opacity);
 void lse_graphics_base_set_clip_rect(lse_graphics* graphics, lse_rect_f* rect);
 const lse_rect* lse_graphics_base_get_clip_rect(lse_graphics* graphics);
 
+/**
+ * Request pixels for an image through the reload image callback.
+ */
+void lse_graphics_base_reload_image(lse_graphics* graphics, lse_image* image);
+
+/**
+ * Notify the owner of an image that its pixels are resident in a texture, through the image uploaded callback.
+ */
+void lse_graphics_base_image_uploaded(lse_graphics* graphics, lse_image* image);
+
 /**
  * Get the base data pointer of the object.
  *
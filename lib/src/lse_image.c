@@ -20,11 +20,21 @@
 struct lse_image {
   lse_resource_state state;
   lse_string* uri;
+  // size of pixels
   int32_t width;
   int32_t height;
+  // size of the source image, if the pixels were decoded at a smaller size
+  int32_t intrinsic_width;
+  int32_t intrinsic_height;
+  // display size the image was requested for, or 0 x 0 for full size
+  int32_t decode_width;
+  int32_t decode_height;
   lse_color* pixels;
   lse_image_pixels_free pixels_free;
   lse_color_format format;
+  bool is_opaque;
+  // vector image, decoded at any size without losing detail
+  bool is_scalable;
   lse_image_observers observers;
 };
 
@@ -58,13 +68,15 @@ void lse_image_set_ready(
     lse_image_pixels_free pixels_free,
     int32_t width,
     int32_t height,
-    lse_color_format format) {
+    lse_color_format format,
+    bool is_opaque) {
   image->state = LSE_RESOURCE_STATE_READY;
   image->pixels = pixels;
   image->pixels_free = pixels_free;
   image->width = width;
   image->height = height;
   image->format = format;
+  image->is_opaque = is_opaque;
 
   lse_image_observers_dispatch_event(
       &image->observers,
@@ -74,6 +86,20 @@ void lse_image_set_ready(
       });
 }
 
+void lse_image_set_intrinsic_size(lse_image* image, int32_t width, int32_t height) {
+  image->intrinsic_width = width;
+  image->intrinsic_height = height;
+}
+
+void lse_image_set_decode_size(lse_image* image, int32_t width, int32_t height) {
+  image->decode_width = width;
+  image->decode_height = height;
+}
+
+void lse_image_set_scalable(lse_image* image, bool is_scalable) {
+  image->is_scalable = is_scalable;
+}
+
 void lse_image_set_error(lse_image* image) {
   image->state = LSE_RESOURCE_STATE_ERROR;
 
@@ -99,11 +125,11 @@ LSE_API lse_string* LSE_CDECL lse_image_get_uri(lse_image* image) {
 }
 
 LSE_API int32_t LSE_CDECL lse_image_get_width(lse_image* image) {
-  return image->width;
+  return image->intrinsic_width > 0 ? image->intrinsic_width : image->width;
 }
 
 LSE_API int32_t LSE_CDECL lse_image_get_height(lse_image* image) {
-  return image->height;
+  return image->intrinsic_height > 0 ? image->intrinsic_height : image->height;
 }
 
 LSE_API int32_t LSE_CDECL lse_image_get_format(lse_image* image) {
@@ -127,6 +153,22 @@ lse_color* lse_image_get_pixels(lse_image* image) {
   return image->pixels;
 }
 
+int32_t lse_image_get_pixel_width(lse_image* image) {
+  return image->width;
+}
+
+int32_t lse_image_get_pixel_height(lse_image* image) {
+  return image->height;
+}
+
+int32_t lse_image_get_decode_width(lse_image* image) {
+  return image->decode_width;
+}
+
+int32_t lse_image_get_decode_height(lse_image* image) {
+  return image->decode_height;
+}
+
 void lse_image_release_pixels(lse_image* image) {
   if (image->pixels) {
     image->pixels_free(image->pixels);
@@ -143,6 +185,14 @@ bool lse_image_is_ready(lse_image* image) {
   return (image && lse_image_get_state(image) == LSE_RESOURCE_STATE_READY);
 }
 
+bool lse_image_is_opaque(lse_image* image) {
+  return lse_image_is_ready(image) && image->is_opaque;
+}
+
+bool lse_image_is_scalable(lse_image* image) {
+  return image->is_scalable;
+}
+
 
 // ////////////////////////////////////////////////////////////////////////////
 // Export type information for lse_object.c:register_types().
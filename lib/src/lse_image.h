@@ -26,6 +26,8 @@ void lse_image_set_loading(lse_image* image);
 
 /**
  * Set image data and move image to the READY state.
+ *
+ * is_opaque is true when every pixel has an alpha of 255, allowing the renderer to draw the image without blending.
  */
 void lse_image_set_ready(
     lse_image* image,
@@ -33,7 +35,27 @@ void lse_image_set_ready(
     lse_image_pixels_free pixels_free,
     int32_t width,
     int32_t height,
-    lse_color_format format);
+    lse_color_format format,
+    bool is_opaque);
+
+/**
+ * Set the size of the source image, when the pixels passed to lse_image_set_ready() were decoded at a smaller size.
+ *
+ * Layout, object-fit and draw source rects use the intrinsic size. Without an intrinsic size, the pixel size is used.
+ */
+void lse_image_set_intrinsic_size(lse_image* image, int32_t width, int32_t height);
+
+/**
+ * Set the display size the image is decoded for. 0 x 0 (the default) decodes the image at full size.
+ *
+ * The image store sets the decode size, a size bucket rather than an exact display size, when the image is created.
+ */
+void lse_image_set_decode_size(lse_image* image, int32_t width, int32_t height);
+
+/**
+ * Mark the image as a vector image, which can be decoded at any size without losing detail.
+ */
+void lse_image_set_scalable(lse_image* image, bool is_scalable);
 
 /**
  * Move image to the ERROR state.
@@ -44,8 +66,18 @@ void lse_image_destroy(lse_image* image);
 
 lse_color* lse_image_get_pixels(lse_image* image);
 
+int32_t lse_image_get_pixel_width(lse_image* image);
+int32_t lse_image_get_pixel_height(lse_image* image);
+
+int32_t lse_image_get_decode_width(lse_image* image);
+int32_t lse_image_get_decode_height(lse_image* image);
+
 void lse_image_release_pixels(lse_image* image);
 
 bool lse_image_is_ready(lse_image* image);
 
 bool lse_image_can_render(lse_image* image);
+
+bool lse_image_is_opaque(lse_image* image);
+
+bool lse_image_is_scalable(lse_image* image);
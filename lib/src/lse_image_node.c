@@ -13,8 +13,11 @@
 
 #include "lse_node.h"
 
+#include <math.h>
+
 #include "lse_graphics.h"
 #include "lse_image.h"
+#include "lse_image_store.h"
 #include "lse_object.h"
 #include "lse_style.h"
 #include "lse_window.h"
@@ -24,11 +27,24 @@ typedef struct lse_image_node lse_image_node;
 struct lse_image_node {
   lse_node_base base;
   lse_image* image;
+  // image decoded at the size the node now needs, swapped in for image when it is ready
+  lse_image* next_image;
+  // src set before the node was laid out. acquired on the first paint, so the first decode is at the display size.
+  lse_string* pending_src;
+  // explicit decode size, or 0 x 0 to decode for the node's box
+  int32_t decode_width;
+  int32_t decode_height;
 };
 
 static YGSize
 measure(YGNodeRef nodeRef, float width, YGMeasureMode width_mode, float height, YGMeasureMode height_mode);
 static void on_image_event(const lse_image_event* e, void* observer);
+static void get_display_size(lse_node* node, const lse_rect_f* box, int32_t* width, int32_t* height);
+static bool has_display_size(lse_node* node, const lse_rect_f* box);
+static void acquire_pending_src(lse_node* node, const lse_rect_f* box);
+static void update_decode_size(lse_node* node, const lse_rect_f* box);
+static void swap_next_image(lse_node* node);
+static bool has_decode_size(lse_image* image, int32_t width, int32_t height);
 
 // @override
 static void constructor(lse_object* obj, void* arg) {
@@ -46,6 +62,8 @@ static void destructor(lse_object* node) {
   lse_image_node* self = (lse_image_node*)node;
 
   assert(self->image == NULL);
+  assert(self->next_image == NULL);
+  assert(self->pending_src == NULL);
   lse_node_base_destructor((lse_node*)node);
 }
 
@@ -58,6 +76,9 @@ static void destroy(lse_node* node) {
   lse_image_node* self = (lse_image_node*)node;
 
   self->image = lse_node_base_image_release(node, self->image);
+  self->next_image = lse_node_base_image_release(node, self->next_image);
+  lse_unref(self->pending_src);
+  self->pending_src = NULL;
   lse_node_base_destroy(node);
 }
 
@@ -76,6 +97,15 @@ static void on_composite(lse_node* node, lse_graphics* graphics) {
       LSE_COLOR_MAKE(255, 255, 255, 255));
 }
 
+// @override
+static bool get_opaque_rect(lse_node* node, lse_graphics* graphics, lse_rect_f* rect) {
+  lse_node_base* base = lse_node_get_base(node);
+
+  // same color as on_composite
+  return base->surface
+         && lse_graphics_get_opaque_rect(graphics, base->surface, LSE_COLOR_MAKE(255, 255, 255, 255), rect);
+}
+
 // @override
 static void on_paint(lse_node* node, lse_graphics* graphics) {
   lse_image_node* self = (lse_image_node*)node;
@@ -97,6 +127,9 @@ static void on_paint(lse_node* node, lse_graphics* graphics) {
     lse_graphics_queue_fill_rect(graphics, &box, lse_style_get_color_t(style, LSE_SP_BACKGROUND_COLOR));
   }
 
+  acquire_pending_src(node, &box);
+  update_decode_size(node, &box);
+
   if (lse_image_can_render(self->image)) {
     lse_style_compute_object_fit(style, context, &box, self->image, &image_rect);
 
@@ -167,17 +200,42 @@ measure(YGNodeRef nodeRef, float width, YGMeasureMode width_mode, float height,
 LSE_API bool LSE_CDECL lse_node_set_src(lse_node* node, lse_string* uri) {
   lse_image_node* image_node = (lse_image_node*)node;
   lse_image* image = image_node->image;
+  lse_rect_f box = lse_node_get_box_at(node, 0, 0);
+  int32_t display_width;
+  int32_t display_height;
 
   if (image) {
-    if (lse_string_cmp(uri, lse_image_get_uri(image))) {
+    if (lse_node_base_image_has_uri(node, image, uri)) {
       lse_unref(uri);
       return true;
     } else {
-      lse_node_base_image_release(node, image);
+      image_node->image = lse_node_base_image_release(node, image);
     }
   }
 
-  image_node->image = lse_node_base_image_acquire(node, uri, &on_image_event);
+  if (image_node->pending_src) {
+    if (uri && lse_string_cmp(image_node->pending_src, uri) == 0) {
+      lse_unref(uri);
+      return true;
+    }
+
+    lse_unref(image_node->pending_src);
+    image_node->pending_src = NULL;
+  }
+
+  image_node->next_image = lse_node_base_image_release(node, image_node->next_image);
+
+  if (uri && !has_display_size(node, &box)) {
+    // before the first layout, the box is empty. decoding now would decode at full size and again at the bucket of
+    // the box, so the acquire waits for the paint after layout.
+    image_node->pending_src = uri;
+    lse_node_request_style_resolve(node, LSE_NODE_FLAG_BOUNDS);
+    return true;
+  }
+
+  get_display_size(node, &box, &display_width, &display_height);
+  image_node->image =
+      lse_node_base_image_acquire_at_size(node, uri, display_width, display_height, &on_image_event);
 
   return image_node->image != NULL;
 }
@@ -187,11 +245,148 @@ LSE_API lse_string* LSE_CDECL lse_node_get_src(lse_node* node) {
   lse_image_node* image_node = (lse_image_node*)node;
   lse_image* image = image_node->image;
 
-  return image ? lse_image_get_uri(image) : NULL;
+  return image ? lse_image_get_uri(image) : image_node->pending_src;
 }
 
+// @public
+LSE_API void LSE_CDECL lse_node_set_decode_size(lse_node* node, int32_t width, int32_t height) {
+  lse_image_node* image_node = (lse_image_node*)node;
+
+  image_node->decode_width = lse_max(width, 0);
+  image_node->decode_height = lse_max(height, 0);
+
+  // the image is swapped for the new decode size on the next paint
+  lse_node_request_style_resolve(node, LSE_NODE_FLAG_BOUNDS);
+}
+
+// @private
+static void get_display_size(lse_node* node, const lse_rect_f* box, int32_t* width, int32_t* height) {
+  lse_image_node* self = (lse_image_node*)node;
+
+  if (self->decode_width > 0 && self->decode_height > 0) {
+    *width = self->decode_width;
+    *height = self->decode_height;
+  } else if (lse_style_get_enum(lse_node_get_style_or_empty(node), LSE_SP_OBJECT_FIT) == LSE_STYLE_OBJECT_FIT_NONE) {
+    // drawn at intrinsic size, which is the full size decode
+    *width = *height = 0;
+  } else {
+    // an image decoded to cover the box has enough pixels for every other object-fit
+    *width = (int32_t)ceilf(box->width);
+    *height = (int32_t)ceilf(box->height);
+  }
+}
+
+// @private
+static bool has_display_size(lse_node* node, const lse_rect_f* box) {
+  lse_image_node* self = (lse_image_node*)node;
+
+  return (self->decode_width > 0 && self->decode_height > 0)
+         || lse_style_get_enum(lse_node_get_style_or_empty(node), LSE_SP_OBJECT_FIT) == LSE_STYLE_OBJECT_FIT_NONE
+         || !lse_rect_f_is_empty(box);
+}
+
+// @private
+static void acquire_pending_src(lse_node* node, const lse_rect_f* box) {
+  lse_image_node* self = (lse_image_node*)node;
+  int32_t display_width;
+  int32_t display_height;
+
+  if (!self->pending_src) {
+    return;
+  }
+
+  // an empty box after layout is sized by the image, which is decoded at full size to measure it
+  get_display_size(node, box, &display_width, &display_height);
+  // acquire takes ownership of the uri
+  self->image =
+      lse_node_base_image_acquire_at_size(node, self->pending_src, display_width, display_height, &on_image_event);
+  self->pending_src = NULL;
+}
+
+// @private
+static void update_decode_size(lse_node* node, const lse_rect_f* box) {
+  lse_image_node* self = (lse_image_node*)node;
+  lse_image* image = self->image;
+  lse_string* uri;
+  int32_t display_width;
+  int32_t display_height;
+  int32_t width;
+  int32_t height;
+
+  // the intrinsic size is needed to pick a bucket, so wait for the first decode
+  if (!image || lse_image_get_state(image) != LSE_RESOURCE_STATE_READY) {
+    return;
+  }
+
+  uri = lse_image_get_uri(image);
+  get_display_size(node, box, &display_width, &display_height);
+  // an svg is rasterized at any bucket, including ones larger than its intrinsic size, so it stays sharp when scaled up
+  lse_image_store_get_decode_bucket(
+      display_width,
+      display_height,
+      lse_image_is_scalable(image) ? 0 : lse_image_get_width(image),
+      lse_image_is_scalable(image) ? 0 : lse_image_get_height(image),
+      &width,
+      &height);
+
+  if (has_decode_size(image, width, height)) {
+    // the box is back in the bucket of the current image
+    self->next_image = lse_node_base_image_release(node, self->next_image);
+    return;
+  }
+
+  // already loading or failed to load; a failed size is not retried until the box moves to another bucket
+  if (self->next_image && width == lse_image_get_decode_width(self->next_image)
+      && height == lse_image_get_decode_height(self->next_image)) {
+    return;
+  }
+
+  self->next_image = lse_node_base_image_release(node, self->next_image);
+  // acquire takes ownership of the uri
+  lse_ref(uri);
+  self->next_image = lse_node_base_image_acquire_at_size(node, uri, width, height, &on_image_event);
+
+  if (self->next_image && lse_image_get_state(self->next_image) == LSE_RESOURCE_STATE_READY) {
+    swap_next_image(node);
+  }
+}
+
+// @private
+static bool has_decode_size(lse_image* image, int32_t width, int32_t height) {
+  if (width == 0 && height == 0) {
+    // an image that was small enough to not be downsampled at its decode size is already full size
+    return lse_image_get_pixel_width(image) == lse_image_get_width(image)
+           && lse_image_get_pixel_height(image) == lse_image_get_height(image);
+  }
+
+  return width == lse_image_get_decode_width(image) && height == lse_image_get_decode_height(image);
+}
+
+// @private
+static void swap_next_image(lse_node* node) {
+  lse_image_node* self = (lse_image_node*)node;
+
+  lse_node_base_image_release(node, self->image);
+  self->image = self->next_image;
+  self->next_image = NULL;
+}
+
+// @private
 static void on_image_event(const lse_image_event* e, void* observer) {
+  lse_image_node* self = observer;
+
+  if (e->image == self->next_image) {
+    // the current image stays on screen until the new decode size is ready
+    if (e->state != LSE_RESOURCE_STATE_READY) {
+      return;
+    }
+
+    swap_next_image(observer);
+  }
+
   YGNodeMarkDirty(lse_node_get_base(observer)->yg_node);
+  // an image decoded again after texture eviction has the same size, so layout alone does not repaint the node
+  lse_node_request_style_resolve(observer, LSE_NODE_FLAG_BOUNDS);
   // TODO: send message to scripting layer (support for onload event)
 }
 
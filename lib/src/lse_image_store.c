@@ -22,6 +22,7 @@
 #include "lse_util.h"
 #include <assert.h>
 #include <math.h>
+#include <string.h>
 #include <stb_image.h>
 
 // stdio must come before nanosvg
@@ -31,8 +32,25 @@
 #include <nanosvgrast.h>
 // clang-format on
 
-static image_resource image_resource_init(lse_string* uri);
+typedef struct svg_document svg_document;
+typedef struct svg_resource svg_resource;
+
+// parsed svg, shared by the rasterize tasks of every decode size of a uri
+struct svg_document {
+  NSVGimage* svg;
+  // the store entry plus each load context rasterizing the document
+  int32_t ref_count;
+};
+
+struct svg_resource {
+  // normalized uri
+  lse_string* uri;
+  svg_document* document;
+};
+
+static image_resource image_resource_init(lse_string* key, lse_string* uri);
 static void image_resource_drop(image_resource* resource);
+static void svg_resource_drop(svg_resource* resource);
 
 #define i_tag images
 #define i_key lse_string_ptr
@@ -47,6 +65,19 @@ static void image_resource_drop(image_resource* resource);
 #define i_opt c_no_cmp | c_no_clone
 #include <stc/cmap.h>
 
+#define i_tag svgs
+#define i_key lse_string_ptr
+#define i_keyraw crawstr
+#define i_keyto lse_string_keyto
+#define i_keyfrom assert
+#define i_hash crawstr_hash
+#define i_cmp crawstr_cmp
+#define i_eq crawstr_eq
+#define i_val svg_resource
+#define i_valdrop svg_resource_drop
+#define i_opt c_no_cmp | c_no_clone
+#include <stc/cmap.h>
+
 //
 // types
 //
@@ -56,10 +87,20 @@ typedef struct load_image_context load_image_context;
 struct lse_image_store {
   lse_env* env;
   cmap_images images;
+  // parsed svgs of the uris in images, so other decode sizes are rasterized without loading the file again
+  cmap_svgs svgs;
   lse_image_observers observers;
+  // images without usages, kept for the next acquire of the same uri
+  int32_t retained_count;
+  int64_t retained_bytes;
+  uint64_t release_order;
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
 };
 
 struct load_image_context {
+  lse_image_store* store;
   lse_image* image;
 
   lse_string* uri;
@@ -68,7 +109,22 @@ struct load_image_context {
   int32_t width;
   int32_t height;
   lse_color_format format;
+  bool is_opaque;
+  // size of the source image, when the pixels were decoded at a smaller size
+  int32_t intrinsic_width;
+  int32_t intrinsic_height;
+  // requested display size, or 0 x 0 for full size
+  int32_t decode_width;
+  int32_t decode_height;
+  // vector image, rasterized at the decode size
+  bool is_scalable;
+  // parsed svg of the uri, rasterized instead of loading the uri
+  svg_document* document;
+  // svg parsed by the worker, handed to the store when the load completes
+  NSVGimage* parsed_svg;
   lse_status status;
+  // decoding again an image whose pixels were released
+  bool is_reload;
 };
 
 //
@@ -76,7 +132,15 @@ struct load_image_context {
 //
 
 #define NUM_CHANNELS 4
+#define DATA_URI_PREFIX "data:"
 #define SVG_DATA_URI_PREFIX "data:image/svg+xml,"
+#define MAX_PATH_LENGTH 4096
+// smallest decode size bucket, so tiny boxes do not get their own store entries
+#define MIN_DECODE_BUCKET 16
+// largest svg raster dimension, so a huge box does not allocate more pixels than a texture can hold
+#define MAX_SVG_RASTER_SIZE 4096
+// released decode sizes of one uri kept in the store. older variants are evicted, even when under budget.
+#define MAX_RETAINED_VARIANTS 2
 const char* LOAD_IMAGE_TASK_NAME = "load image task";
 static const char* k_svg_headers[] = { "<?", "<!", "<svg" };
 
@@ -84,9 +148,40 @@ static const char* k_svg_headers[] = { "<?", "<!", "<svg" };
 // private functions
 //
 
+static const char* normalize_uri(const char* uri, char* buffer, size_t buffer_size);
+static lse_string* make_sized_key(const char* uri, int32_t width, int32_t height);
+static cmap_images_value* find_image(lse_image_store* store, lse_image* image);
+static int32_t get_decode_bucket(int32_t size);
+static bool get_scaled_size(
+    int32_t width,
+    int32_t height,
+    int32_t decode_width,
+    int32_t decode_height,
+    int32_t* scaled_width,
+    int32_t* scaled_height);
+static float get_cover_size(
+    int32_t width,
+    int32_t height,
+    int32_t decode_width,
+    int32_t decode_height,
+    int32_t* scaled_width,
+    int32_t* scaled_height);
+static lse_status downsample_pixels(load_image_context* context, int32_t width, int32_t height);
+static void resample_row(const uint8_t* src, int32_t src_width, float scale, float* row, int32_t width);
+static void erase_image(lse_image_store* store, cmap_images_value* value);
+static void evict_retained_images(lse_image_store* store, int64_t budget);
+static void evict_retained_variants(lse_image_store* store, lse_image* image);
+static void retain_svg(lse_image_store* store, lse_string* uri, NSVGimage* svg);
+static void erase_unused_svg(lse_image_store* store, lse_string* uri);
+static svg_document* svg_document_ref(svg_document* document);
+static void svg_document_unref(svg_document* document);
+static bool is_uri_of(lse_image* image, const char* uri);
+static image_consumer* find_consumer(image_resource* resource, void* consumer);
+static void release_uploaded_pixels(image_resource* resource);
+static int64_t get_image_bytes(lse_image* image);
 static void load_image_worker(void* user_data);
 static void load_image_complete(lse_env* env, void* user_data);
-static load_image_context* load_image_context_init(lse_image* image);
+static load_image_context* load_image_context_init(lse_image_store* store, lse_image* image);
 static void load_image_context_free(void* user_data);
 static lse_status stb_load_image(FILE* fp, load_image_context*);
 static lse_status svg_load_image(NSVGimage* svg, load_image_context* context);
@@ -95,6 +190,7 @@ static lse_status svg_load_image_from_memory(const char* xml, load_image_context
 static bool is_stb(FILE* fp);
 static bool is_svg(FILE* fp);
 static void stb_pixels_free(lse_color* pixels);
+static bool has_opaque_pixels(const lse_color* pixels, int32_t count);
 static void svg_pixels_free(lse_color* pixels);
 
 // @override
@@ -105,6 +201,7 @@ static void constructor(lse_object* object, void* arg) {
   lse_ref(self->env);
 
   self->images = cmap_images_init();
+  self->svgs = cmap_svgs_init();
   self->observers = lse_image_observers_init();
 }
 
@@ -118,6 +215,7 @@ static void destructor(lse_object* object) {
 
   lse_unref(self->env);
   cmap_images_drop(&self->images);
+  cmap_svgs_drop(&self->svgs);
 
   lse_image_observers_drop(&self->observers);
 }
@@ -146,7 +244,10 @@ void lse_image_store_destroy(lse_image_store* store) {
   }
 
   cmap_images_clear(&store->images);
+  cmap_svgs_clear(&store->svgs);
   lse_image_observers_clear(&store->observers);
+  store->retained_count = 0;
+  store->retained_bytes = 0;
 
   lse_unref(store->env);
   store->env = NULL;
@@ -173,36 +274,82 @@ void lse_image_store_detach(lse_image_store* store) {
 
 // @public
 lse_image* lse_image_store_get_image(lse_image_store* store, const char* uri) {
-  const cmap_images_value* value = cmap_images_get(&store->images, lse_ensure_string(uri));
+  char buffer[MAX_PATH_LENGTH];
+  const cmap_images_value* value = cmap_images_get(&store->images, normalize_uri(uri, buffer, sizeof(buffer)));
 
   return value ? value->second.image : NULL;
 }
 
 // @public
 lse_image* lse_image_store_acquire_image(lse_image_store* store, lse_string* uri, bool async) {
+  return lse_image_store_acquire_image_at_size(store, uri, 0, 0, async);
+}
+
+// @public
+lse_image* lse_image_store_acquire_image_at_size(
+    lse_image_store* store,
+    lse_string* uri,
+    int32_t display_width,
+    int32_t display_height,
+    bool async) {
   if (lse_image_store_is_destroyed(store)) {
     return NULL;
   }
 
+  char buffer[MAX_PATH_LENGTH];
+  const char* path = normalize_uri(lse_string_as_cstring(uri), buffer, sizeof(buffer));
+  int32_t decode_width;
+  int32_t decode_height;
+  lse_string* key = NULL;
   lse_image* image;
   load_image_context* context;
-  cmap_images_value* value = cmap_images_get_mut(&store->images, lse_string_as_cstring(uri));
+  cmap_images_value* value;
+
+  lse_image_store_get_decode_bucket(display_width, display_height, 0, 0, &decode_width, &decode_height);
+
+  // each decode size bucket of a uri is a separate entry
+  if (decode_width > 0) {
+    key = make_sized_key(path, decode_width, decode_height);
+  }
+
+  value = cmap_images_get_mut(&store->images, key ? lse_string_as_cstring(key) : path);
 
   if (value) {
     image = value->second.image;
 
+    // revive a retained image
+    if (value->second.usages == 0) {
+      store->retained_count--;
+      store->retained_bytes -= get_image_bytes(image);
+    }
+
     value->second.usages++;
+    store->hits++;
     lse_ref(image);
 
+    lse_unref(key);
     lse_unref(uri);
 
     return image;
   }
 
-  image = cmap_images_insert(&store->images, uri, image_resource_init(uri)).ref->second.image;
+  // the image is loaded by its normalized uri
+  if (path == buffer) {
+    lse_unref(uri);
+    uri = lse_string_new(path);
+  }
+
+  if (!key) {
+    key = uri;
+    lse_ref(key);
+  }
+
+  image = cmap_images_insert(&store->images, key, image_resource_init(key, uri)).ref->second.image;
+  lse_image_set_decode_size(image, decode_width, decode_height);
   lse_image_set_loading(image);
+  store->misses++;
 
-  context = load_image_context_init(image);
+  context = load_image_context_init(store, image);
 
   if (async) {
     lse_env_add_thread_pool_task(
@@ -218,21 +365,25 @@ lse_image* lse_image_store_acquire_image(lse_image_store* store, lse_string* uri
 // @public
 lse_image* lse_image_store_release_image(lse_image_store* store, lse_image* image) {
   if (image) {
-    cmap_images_value* value = cmap_images_get_mut(&store->images, lse_string_as_cstring(lse_image_get_uri(image)));
+    cmap_images_value* value = find_image(store, image);
 
     if (value && value->second.image == image) {
       assert(value->second.image == image);
       assert(value->second.usages > 0);
 
       if (--value->second.usages <= 0) {
-        lse_env_cancel_thread_pool_task(store->env, value->second.task);
-        lse_image_observers_dispatch_event(
-            &store->observers,
-            &(lse_image_event){
-                .image = value->second.image,
-                .state = LSE_RESOURCE_STATE_DONE,
-            });
-        cmap_images_erase_entry(&store->images, value);
+        int64_t budget = store->env->render_settings.image_store_budget;
+        int64_t bytes = get_image_bytes(image);
+
+        if (lse_image_is_ready(image) && bytes <= budget) {
+          value->second.release_order = ++store->release_order;
+          store->retained_count++;
+          store->retained_bytes += bytes;
+          evict_retained_variants(store, image);
+          evict_retained_images(store, budget);
+        } else {
+          erase_image(store, value);
+        }
       }
     }
 
@@ -242,6 +393,129 @@ lse_image* lse_image_store_release_image(lse_image_store* store, lse_image* imag
   return NULL;
 }
 
+// @public
+void lse_image_store_reload_image(lse_image_store* store, lse_image* image, bool async) {
+  load_image_context* context;
+  cmap_images_value* value;
+
+  if (lse_image_store_is_destroyed(store) || !lse_image_is_ready(image) || lse_image_get_pixels(image)) {
+    return;
+  }
+
+  value = find_image(store, image);
+
+  // windows drawing the same image share one decode
+  if (!value || value->second.image != image || value->second.is_reloading) {
+    return;
+  }
+
+  value->second.is_reloading = true;
+  context = load_image_context_init(store, image);
+  context->is_reload = true;
+
+  if (async) {
+    lse_env_add_thread_pool_task(
+        store->env, LOAD_IMAGE_TASK_NAME, &load_image_worker, &load_image_complete, context, &load_image_context_free);
+  } else {
+    load_image_worker(context);
+    load_image_complete(store->env, context);
+    load_image_context_free(context);
+  }
+}
+
+bool lse_image_store_has_uri(lse_image_store* store, lse_image* image, const char* uri) {
+  char buffer[MAX_PATH_LENGTH];
+
+  return image
+         && strcmp(lse_string_as_cstring(lse_image_get_uri(image)), normalize_uri(uri, buffer, sizeof(buffer))) == 0;
+}
+
+void lse_image_store_get_decode_bucket(
+    int32_t display_width,
+    int32_t display_height,
+    int32_t intrinsic_width,
+    int32_t intrinsic_height,
+    int32_t* width,
+    int32_t* height) {
+  int32_t scaled_width;
+  int32_t scaled_height;
+
+  *width = get_decode_bucket(display_width);
+  *height = get_decode_bucket(display_height);
+
+  // both dimensions are needed to pick a scale. if the source is known to be no larger than the bucket, decoding at
+  // the bucket size is the same as decoding at full size.
+  if (*width == 0 || *height == 0
+      || (intrinsic_width > 0 && intrinsic_height > 0
+          && !get_scaled_size(intrinsic_width, intrinsic_height, *width, *height, &scaled_width, &scaled_height))) {
+    *width = *height = 0;
+  }
+}
+
+void lse_image_store_add_consumer(lse_image_store* store, lse_image* image, void* consumer) {
+  cmap_images_value* value = image && !lse_image_store_is_destroyed(store) ? find_image(store, image) : NULL;
+  image_consumer* entry;
+
+  if (!value) {
+    return;
+  }
+
+  entry = find_consumer(&value->second, consumer);
+
+  if (!entry) {
+    value->second.consumers = lse_realloc(
+        value->second.consumers, (size_t)(value->second.consumer_count + 1) * sizeof(image_consumer));
+    entry = &value->second.consumers[value->second.consumer_count++];
+    *entry = (image_consumer){ .consumer = consumer };
+  }
+
+  entry->usages++;
+}
+
+void lse_image_store_remove_consumer(lse_image_store* store, lse_image* image, void* consumer) {
+  cmap_images_value* value = image && !lse_image_store_is_destroyed(store) ? find_image(store, image) : NULL;
+  image_consumer* entry = value ? find_consumer(&value->second, consumer) : NULL;
+
+  if (!entry || --entry->usages > 0) {
+    return;
+  }
+
+  *entry = value->second.consumers[--value->second.consumer_count];
+
+  // the consumer that left may have been the last one waiting for the pixels
+  if (value->second.consumer_count > 0) {
+    release_uploaded_pixels(&value->second);
+  }
+}
+
+void lse_image_store_on_image_uploaded(lse_image_store* store, lse_image* image, void* consumer) {
+  cmap_images_value* value = lse_image_store_is_destroyed(store) ? NULL : find_image(store, image);
+  image_consumer* entry = value ? find_consumer(&value->second, consumer) : NULL;
+
+  if (!value) {
+    lse_image_release_pixels(image);
+    return;
+  }
+
+  if (entry) {
+    entry->has_uploaded = true;
+  }
+
+  // other windows keep the pixels until they upload them too, so the image is decoded once for all of them
+  release_uploaded_pixels(&value->second);
+}
+
+void lse_image_store_get_stats(lse_image_store* store, lse_image_store_stats* stats) {
+  *stats = (lse_image_store_stats){
+    .hits = store->hits,
+    .misses = store->misses,
+    .evictions = store->evictions,
+    .retained_count = store->retained_count,
+    .retained_bytes = store->retained_bytes,
+    .svg_count = (int32_t)cmap_svgs_size(store->svgs),
+  };
+}
+
 void lse_image_store_add_observer(lse_image_store* store, void* observer, lse_image_event_callback callback) {
   lse_image_observers_add(&store->observers, observer, callback);
 }
@@ -251,8 +525,269 @@ void lse_image_store_remove_observer(lse_image_store* store, void* observer) {
 }
 
 // @private
-static load_image_context* load_image_context_init(lse_image* image) {
+static const char* normalize_uri(const char* uri, char* buffer, size_t buffer_size) {
+  uri = lse_ensure_string(uri);
+
+  // data uris are not paths. if the path cannot be normalized, the uri is used as is.
+  if (strncmp(uri, DATA_URI_PREFIX, strlen(DATA_URI_PREFIX)) == 0 || !lse_normalize_path(uri, buffer, buffer_size)) {
+    return uri;
+  }
+
+  return strcmp(uri, buffer) == 0 ? uri : buffer;
+}
+
+// @private
+static lse_string* make_sized_key(const char* uri, int32_t width, int32_t height) {
+  // room for "@" + two 32-bit ints + "x" + terminator
+  size_t size = strlen(uri) + 32;
+  char* buffer = lse_malloc(size);
+  lse_string* key;
+
+  snprintf(buffer, size, "%s@%ix%i", uri, width, height);
+  key = lse_string_new(buffer);
+  free(buffer);
+
+  return key;
+}
+
+// @private
+static cmap_images_value* find_image(lse_image_store* store, lse_image* image) {
+  const char* uri = lse_string_as_cstring(lse_image_get_uri(image));
+  lse_string* key;
+  cmap_images_value* value;
+
+  if (lse_image_get_decode_width(image) == 0) {
+    value = cmap_images_get_mut(&store->images, uri);
+  } else {
+    key = make_sized_key(uri, lse_image_get_decode_width(image), lse_image_get_decode_height(image));
+    value = cmap_images_get_mut(&store->images, lse_string_as_cstring(key));
+    lse_unref(key);
+  }
+
+  return value && value->second.image == image ? value : NULL;
+}
+
+// @private
+static int32_t get_decode_bucket(int32_t size) {
+  int32_t bucket = MIN_DECODE_BUCKET;
+
+  if (size <= 0) {
+    return 0;
+  }
+
+  while (bucket < size && bucket < INT32_MAX / 2) {
+    bucket <<= 1;
+  }
+
+  return bucket;
+}
+
+// @private
+static bool get_scaled_size(
+    int32_t width,
+    int32_t height,
+    int32_t decode_width,
+    int32_t decode_height,
+    int32_t* scaled_width,
+    int32_t* scaled_height) {
+  if (decode_width <= 0 || decode_height <= 0) {
+    return false;
+  }
+
+  return get_cover_size(width, height, decode_width, decode_height, scaled_width, scaled_height) < 1.f;
+}
+
+// @private
+static float get_cover_size(
+    int32_t width,
+    int32_t height,
+    int32_t decode_width,
+    int32_t decode_height,
+    int32_t* scaled_width,
+    int32_t* scaled_height) {
+  float scale_x = (float)decode_width / (float)width;
+  float scale_y = (float)decode_height / (float)height;
+
+  // the larger scale, so the decoded image covers the decode size in both dimensions with any object-fit. the
+  // dimension that sets the scale is exact, so float rounding cannot add a pixel.
+  if (scale_x >= scale_y) {
+    *scaled_width = decode_width;
+    *scaled_height = lse_max((int32_t)ceilf((float)height * scale_x), 1);
+    return scale_x;
+  } else {
+    *scaled_width = lse_max((int32_t)ceilf((float)width * scale_y), 1);
+    *scaled_height = decode_height;
+    return scale_y;
+  }
+}
+
+// @private
+static void erase_image(lse_image_store* store, cmap_images_value* value) {
+  lse_string* uri = lse_image_get_uri(value->second.image);
+
+  // the uri is owned by the image being erased
+  lse_ref(uri);
+
+  lse_env_cancel_thread_pool_task(store->env, value->second.task);
+  lse_image_observers_dispatch_event(
+      &store->observers,
+      &(lse_image_event){
+          .image = value->second.image,
+          .state = LSE_RESOURCE_STATE_DONE,
+      });
+  cmap_images_erase_entry(&store->images, value);
+  erase_unused_svg(store, uri);
+
+  lse_unref(uri);
+}
+
+// @private
+static void evict_retained_images(lse_image_store* store, int64_t budget) {
+  cmap_images_value* oldest;
+
+  while (store->retained_bytes > budget) {
+    oldest = NULL;
+
+    // retained images are few, so the least recently released image is found with a scan rather than kept in a list
+    c_foreach(it, cmap_images, store->images) {
+      if (it.ref->second.usages == 0 && (!oldest || it.ref->second.release_order < oldest->second.release_order)) {
+        oldest = it.ref;
+      }
+    }
+
+    if (!oldest) {
+      break;
+    }
+
+    store->retained_count--;
+    store->retained_bytes -= get_image_bytes(oldest->second.image);
+    store->evictions++;
+    erase_image(store, oldest);
+  }
+}
+
+// @private
+static void evict_retained_variants(lse_image_store* store, lse_image* image) {
+  const char* uri = lse_string_as_cstring(lse_image_get_uri(image));
+  cmap_images_value* oldest;
+  int32_t count;
+
+  do {
+    oldest = NULL;
+    count = 0;
+
+    c_foreach(it, cmap_images, store->images) {
+      if (it.ref->second.usages == 0 && is_uri_of(it.ref->second.image, uri)) {
+        count++;
+
+        if (!oldest || it.ref->second.release_order < oldest->second.release_order) {
+          oldest = it.ref;
+        }
+      }
+    }
+
+    if (count <= MAX_RETAINED_VARIANTS) {
+      break;
+    }
+
+    store->retained_count--;
+    store->retained_bytes -= get_image_bytes(oldest->second.image);
+    store->evictions++;
+    erase_image(store, oldest);
+  } while (true);
+}
+
+// @private
+static void retain_svg(lse_image_store* store, lse_string* uri, NSVGimage* svg) {
+  svg_document* document;
+
+  if (cmap_svgs_contains(&store->svgs, lse_string_as_cstring(uri))) {
+    nsvgDelete(svg);
+    return;
+  }
+
+  document = lse_malloc(sizeof(svg_document));
+  *document = (svg_document){ .svg = svg, .ref_count = 1 };
+
+  lse_ref(uri);
+  cmap_svgs_insert(&store->svgs, uri, (svg_resource){ .uri = uri, .document = document });
+}
+
+// @private
+static void erase_unused_svg(lse_image_store* store, lse_string* uri) {
+  const char* key = lse_string_as_cstring(uri);
+  cmap_svgs_value* value = cmap_svgs_get_mut(&store->svgs, key);
+
+  if (!value) {
+    return;
+  }
+
+  // another decode size of the uri may still be rasterized from the document
+  c_foreach(it, cmap_images, store->images) {
+    if (is_uri_of(it.ref->second.image, key)) {
+      return;
+    }
+  }
+
+  cmap_svgs_erase_entry(&store->svgs, value);
+}
+
+// @private
+static bool is_uri_of(lse_image* image, const char* uri) {
+  return strcmp(lse_string_as_cstring(lse_image_get_uri(image)), uri) == 0;
+}
+
+// @private
+static svg_document* svg_document_ref(svg_document* document) {
+  if (document) {
+    document->ref_count++;
+  }
+
+  return document;
+}
+
+// @private
+static image_consumer* find_consumer(image_resource* resource, void* consumer) {
+  for (int32_t i = 0; i < resource->consumer_count; i++) {
+    if (resource->consumers[i].consumer == consumer) {
+      return &resource->consumers[i];
+    }
+  }
+
+  return NULL;
+}
+
+// @private
+static void release_uploaded_pixels(image_resource* resource) {
+  for (int32_t i = 0; i < resource->consumer_count; i++) {
+    if (!resource->consumers[i].has_uploaded) {
+      return;
+    }
+  }
+
+  lse_image_release_pixels(resource->image);
+}
+
+// @private
+static void svg_document_unref(svg_document* document) {
+  if (document && --document->ref_count == 0) {
+    nsvgDelete(document->svg);
+    free(document);
+  }
+}
+
+// @private
+static int64_t get_image_bytes(lse_image* image) {
+  return (int64_t)lse_image_get_pixel_width(image) * lse_image_get_pixel_height(image) * NUM_CHANNELS;
+}
+
+// @private
+static load_image_context* load_image_context_init(lse_image_store* store, lse_image* image) {
   load_image_context* context = lse_calloc(1, sizeof(load_image_context));
+  const cmap_svgs_value* svg;
+
+  context->store = store;
+  lse_ref(context->store);
 
   context->image = image;
   lse_ref(context->image);
@@ -260,6 +795,16 @@ static load_image_context* load_image_context_init(lse_image* image) {
   context->uri = lse_image_get_uri(image);
   lse_ref(context->uri);
 
+  context->decode_width = lse_image_get_decode_width(image);
+  context->decode_height = lse_image_get_decode_height(image);
+
+  svg = cmap_svgs_get(&store->svgs, lse_string_as_cstring(context->uri));
+
+  if (svg) {
+    // ref counts are only touched on the main thread. the worker reads the document while the context holds it.
+    context->document = svg_document_ref(svg->second.document);
+  }
+
   return context;
 }
 
@@ -268,8 +813,15 @@ static void load_image_context_free(void* user_data) {
   load_image_context* context = user_data;
 
   if (context) {
+    lse_unref(context->store);
     lse_unref(context->image);
     lse_unref(context->uri);
+    svg_document_unref(context->document);
+
+    if (context->parsed_svg) {
+      nsvgDelete(context->parsed_svg);
+    }
+
     free(context);
   }
 }
@@ -281,6 +833,12 @@ static void load_image_worker(void* user_data) {
   FILE* fp;
   size_t len = strlen(SVG_DATA_URI_PREFIX);
 
+  // another decode size of the svg was loaded, so only rasterize
+  if (context->document) {
+    context->status = svg_load_image(context->document->svg, context);
+    return;
+  }
+
   // special case plain text svg data uris.
   // TODO: need to support base64 and raster file formats in the future.
   if (strncmp(uri, SVG_DATA_URI_PREFIX, len) == 0) {
@@ -309,14 +867,44 @@ static void load_image_worker(void* user_data) {
 // @private
 static void load_image_complete(lse_env* env, void* user_data) {
   load_image_context* context = user_data;
+  cmap_images_value* value;
 
   LSE_LOG_INFO("image load complete");
 
   // TODO: handle was_cancelled
 
+  if (context->parsed_svg && !lse_image_store_is_destroyed(context->store)) {
+    retain_svg(context->store, context->uri, context->parsed_svg);
+    context->parsed_svg = NULL;
+  }
+
+  if (context->is_reload && !lse_image_store_is_destroyed(context->store)) {
+    value = find_image(context->store, context->image);
+
+    if (value) {
+      value->second.is_reloading = false;
+    }
+  }
+
+  // the image was released or got its pixels back while decoding
+  if (context->is_reload && (!lse_image_is_ready(context->image) || lse_image_get_pixels(context->image))) {
+    if (context->status == LSE_OK) {
+      context->pixels_free(context->pixels);
+    }
+    return;
+  }
+
   if (context->status == LSE_OK) {
+    lse_image_set_intrinsic_size(context->image, context->intrinsic_width, context->intrinsic_height);
+    lse_image_set_scalable(context->image, context->is_scalable);
     lse_image_set_ready(
-        context->image, context->pixels, context->pixels_free, context->width, context->height, context->format);
+        context->image,
+        context->pixels,
+        context->pixels_free,
+        context->width,
+        context->height,
+        context->format,
+        context->is_opaque);
   } else {
     lse_image_set_error(context->image);
   }
@@ -337,15 +925,123 @@ static lse_status stb_load_image(FILE* fp, load_image_context* context) {
 
   context->pixels = (lse_color*)bytes;
   context->pixels_free = stb_pixels_free;
+  context->width = context->intrinsic_width = width;
+  context->height = context->intrinsic_height = height;
+  // grey and rgb files have no alpha channel. files with alpha are checked here, off the main thread.
+  context->is_opaque = channels == 1 || channels == 3 || has_opaque_pixels(context->pixels, width * height);
+
+  if (get_scaled_size(width, height, context->decode_width, context->decode_height, &width, &height)) {
+    return downsample_pixels(context, width, height);
+  }
+
+  return LSE_OK;
+}
+
+// @private
+static lse_status downsample_pixels(load_image_context* context, int32_t width, int32_t height) {
+  const uint8_t* src = (const uint8_t*)context->pixels;
+  int32_t src_width = context->width;
+  int32_t src_height = context->height;
+  float scale_x = (float)src_width / (float)width;
+  float scale_y = (float)src_height / (float)height;
+  float* row = lse_malloc((size_t)width * NUM_CHANNELS * sizeof(float));
+  float* sum = lse_malloc((size_t)width * NUM_CHANNELS * sizeof(float));
+  uint8_t* dst = lse_malloc((size_t)width * height * NUM_CHANNELS);
+  uint8_t* out;
+  int32_t last_row = -1;
+  int32_t i;
+  float y0;
+  float y1;
+  float weight;
+  float alpha;
+
+  if (!row || !sum || !dst) {
+    free(row);
+    free(sum);
+    free(dst);
+    return LSE_ERR_OUT_OF_MEMORY;
+  }
+
+  // area average (box filter) of premultiplied colors, so every source pixel contributes by the area it covers and
+  // transparent pixels do not darken their neighbours
+  for (int32_t y = 0; y < height; y++) {
+    y0 = (float)y * scale_y;
+    y1 = y0 + scale_y;
+    memset(sum, 0, (size_t)width * NUM_CHANNELS * sizeof(float));
+
+    for (int32_t r = (int32_t)y0; (float)r < y1 && r < src_height; r++) {
+      weight = fminf((float)(r + 1), y1) - fmaxf((float)r, y0);
+
+      // a source row straddling two output rows is resampled once
+      if (r != last_row) {
+        resample_row(src + (size_t)r * src_width * NUM_CHANNELS, src_width, scale_x, row, width);
+        last_row = r;
+      }
+
+      for (i = 0; i < width * NUM_CHANNELS; i++) {
+        sum[i] += row[i] * weight;
+      }
+    }
+
+    out = dst + (size_t)y * width * NUM_CHANNELS;
+
+    for (int32_t x = 0; x < width; x++) {
+      i = x * NUM_CHANNELS;
+      alpha = sum[i + 3] / scale_y;
+
+      for (int32_t c = 0; c < 3; c++) {
+        out[i + c] = alpha > 0 ? (uint8_t)fminf(sum[i + c] / scale_y * 255.f / alpha + 0.5f, 255.f) : 0;
+      }
+
+      out[i + 3] = (uint8_t)fminf(alpha + 0.5f, 255.f);
+    }
+  }
+
+  free(row);
+  free(sum);
+
+  context->pixels_free(context->pixels);
+  context->pixels = (lse_color*)dst;
+  context->pixels_free = svg_pixels_free;
   context->width = width;
   context->height = height;
 
   return LSE_OK;
 }
 
+// @private
+static void resample_row(const uint8_t* src, int32_t src_width, float scale, float* row, int32_t width) {
+  const uint8_t* pixel;
+  float x0;
+  float x1;
+  float weight;
+  float alpha;
+  float* out;
+
+  for (int32_t x = 0; x < width; x++) {
+    x0 = (float)x * scale;
+    x1 = x0 + scale;
+    out = row + x * NUM_CHANNELS;
+    out[0] = out[1] = out[2] = out[3] = 0;
+
+    for (int32_t c = (int32_t)x0; (float)c < x1 && c < src_width; c++) {
+      weight = (fminf((float)(c + 1), x1) - fmaxf((float)c, x0)) / scale;
+      pixel = src + c * NUM_CHANNELS;
+      alpha = pixel[3] * weight;
+
+      out[0] += pixel[0] * alpha / 255.f;
+      out[1] += pixel[1] * alpha / 255.f;
+      out[2] += pixel[2] * alpha / 255.f;
+      out[3] += alpha;
+    }
+  }
+}
+
 // @private
 static lse_status svg_load_image_from_file(FILE* fp, load_image_context* context) {
-  return svg_load_image(nsvgParseFromFilePtr(fp, "px", 96), context);
+  context->parsed_svg = nsvgParseFromFilePtr(fp, "px", 96);
+
+  return svg_load_image(context->parsed_svg, context);
 }
 
 // @private
@@ -359,7 +1055,8 @@ static lse_status svg_load_image_from_memory(const char* xml, load_image_context
   memcpy(scratch, xml, len);
   scratch[len] = '\0';
 
-  status = svg_load_image(nsvgParse(scratch, "px", 96), context);
+  context->parsed_svg = nsvgParse(scratch, "px", 96);
+  status = svg_load_image(context->parsed_svg, context);
 
   free(scratch);
 
@@ -373,20 +1070,39 @@ static lse_status svg_load_image(NSVGimage* svg, load_image_context* context) {
   uint8_t* bytes;
   int32_t width;
   int32_t height;
+  float scale;
+  float scale_x = 1;
+  float scale_y = 1;
 
   if (!svg) {
     status = LSE_ERR_RES_SVG_PARSE;
     goto SVG_LOAD_IMAGE_DONE;
   }
 
-  width = (int32_t)ceilf(svg->width);
-  height = (int32_t)ceilf(svg->height);
+  width = context->intrinsic_width = (int32_t)ceilf(svg->width);
+  height = context->intrinsic_height = (int32_t)ceilf(svg->height);
 
   if (width < 1 || height < 1) {
     status = LSE_ERR_RES_SVG_PARSE;
     goto SVG_LOAD_IMAGE_DONE;
   }
 
+  // vectors are rasterized directly at the decode size, up or down, rather than resampled
+  if (context->decode_width > 0 && context->decode_height > 0) {
+    get_cover_size(width, height, context->decode_width, context->decode_height, &width, &height);
+
+    if (width > MAX_SVG_RASTER_SIZE || height > MAX_SVG_RASTER_SIZE) {
+      scale = (float)MAX_SVG_RASTER_SIZE / (float)lse_max(width, height);
+      width = lse_max((int32_t)((float)width * scale), 1);
+      height = lse_max((int32_t)((float)height * scale), 1);
+    }
+
+    scale_x = (float)width / svg->width;
+    scale_y = (float)height / svg->height;
+  }
+
+  context->is_scalable = true;
+
   bytes = lse_malloc(width * height * NUM_CHANNELS);
 
   rasterizer = nsvgCreateRasterizer();
@@ -396,7 +1112,7 @@ static lse_status svg_load_image(NSVGimage* svg, load_image_context* context) {
     goto SVG_LOAD_IMAGE_DONE;
   }
 
-  nsvgRasterizeFull(rasterizer, svg, 0, 0, 1, 1, bytes, width, height, width * NUM_CHANNELS);
+  nsvgRasterizeFull(rasterizer, svg, 0, 0, scale_x, scale_y, bytes, width, height, width * NUM_CHANNELS);
 
   context->pixels = (lse_color*)bytes;
   context->pixels_free = svg_pixels_free;
@@ -409,10 +1125,6 @@ SVG_LOAD_IMAGE_DONE:
     nsvgDeleteRasterizer(rasterizer);
   }
 
-  if (svg) {
-    nsvgDelete(svg);
-  }
-
   return status;
 }
 
@@ -439,8 +1151,9 @@ static bool is_svg(FILE* fp) {
 }
 
 // @private
-static image_resource image_resource_init(lse_string* uri) {
+static image_resource image_resource_init(lse_string* key, lse_string* uri) {
   return (image_resource){
+    .key = key,
     .image = lse_new(lse_image, uri),
     .usages = 1,
     .task = NULL,
@@ -449,8 +1162,16 @@ static image_resource image_resource_init(lse_string* uri) {
 
 // @private
 static void image_resource_drop(image_resource* resource) {
+  free(resource->consumers);
   lse_image_destroy(resource->image);
   lse_unref(resource->image);
+  lse_unref(resource->key);
+}
+
+// @private
+static void svg_resource_drop(svg_resource* resource) {
+  lse_unref(resource->uri);
+  svg_document_unref(resource->document);
 }
 
 // @private
@@ -463,6 +1184,20 @@ static void svg_pixels_free(lse_color* pixels) {
   free(pixels);
 }
 
+// @private
+static bool has_opaque_pixels(const lse_color* pixels, int32_t count) {
+  // pixels are RGBA bytes, so alpha is the last byte of each pixel regardless of the lse_color layout
+  const uint8_t* bytes = (const uint8_t*)pixels;
+
+  for (int32_t i = 0; i < count; i++) {
+    if (bytes[(i * NUM_CHANNELS) + 3] != 255) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 // ////////////////////////////////////////////////////////////////////////////
 // Export type information for lse_object.c:register_types().
 // ////////////////////////////////////////////////////////////////////////////
@@ -18,17 +18,115 @@
 #define LSE_IMAGE_STORE_ASYNC true
 #define LSE_IMAGE_STORE_SYNC false
 
+typedef struct lse_image_store_stats lse_image_store_stats;
+
+struct lse_image_store_stats {
+  // acquires served by an image already in the store, including retained images
+  uint64_t hits;
+  // acquires that started a decode
+  uint64_t misses;
+  // retained images released for good to stay within the budget
+  uint64_t evictions;
+  int32_t retained_count;
+  int64_t retained_bytes;
+  // parsed svgs kept for rasterizing other decode sizes
+  int32_t svg_count;
+};
+
+/**
+ * Get an image for a uri, adding a usage.
+ *
+ * The env owns one store, shared by all windows. File uris are keyed by their normalized absolute path, so
+ * "./a.png" and "a.png" are the same image, and the image uri is the normalized path. Data uris are keyed as is.
+ *
+ * If the uri is not in the store, the image is decoded, on the thread pool if async. An image that is loading, in use
+ * or retained after its last release is returned as is, so concurrent acquires of a uri share one decode.
+ */
 lse_image* lse_image_store_acquire_image(lse_image_store* store, lse_string* uri, bool async);
+
+/**
+ * Get an image for a uri, decoded for display at display_width x display_height px.
+ *
+ * The display size is rounded up to a decode size bucket (see lse_image_store_get_decode_bucket()), and each bucket of
+ * a uri is a separate image. On the worker thread, the decoded image is downsampled with an area filter to the
+ * smallest size that covers the bucket, keeping the aspect ratio. Raster images are never upscaled. SVGs are
+ * rasterized at the size that covers the bucket, up or down, from a parsed document the store keeps while any decode
+ * size of the uri is in the store. The image keeps its intrinsic size, so layout does not depend on the decode size. A
+ * 0 display size decodes the image at full size.
+ *
+ * Only a few released decode sizes of a uri are retained; older ones are removed even when under budget.
+ */
+lse_image* lse_image_store_acquire_image_at_size(
+    lse_image_store* store,
+    lse_string* uri,
+    int32_t display_width,
+    int32_t display_height,
+    bool async);
+
+/**
+ * Remove a usage of an image.
+ *
+ * When the last usage is removed, a READY image is retained, so acquiring the uri again does not decode the image
+ * again. Retained images keep their graphics textures. Least recently released images are removed from the store when
+ * the retained images are over render_settings.image_store_budget bytes.
+ */
 lse_image* lse_image_store_release_image(lse_image_store* store, lse_image* image);
 
 lse_image* lse_image_store_get_image(lse_image_store* store, const char* uri);
 
+/**
+ * Check if image was acquired for uri, at any decode size.
+ */
+bool lse_image_store_has_uri(lse_image_store* store, lse_image* image, const char* uri);
+
+/**
+ * Get the decode size bucket for a display size in px.
+ *
+ * Each dimension is rounded up to a power of two, so small changes to the display size map to the same image. If the
+ * intrinsic size is known (non-zero) and decoding at the bucket would not downsample, or a display dimension is 0, the
+ * bucket is 0 x 0, which means full size.
+ */
+void lse_image_store_get_decode_bucket(
+    int32_t display_width,
+    int32_t display_height,
+    int32_t intrinsic_width,
+    int32_t intrinsic_height,
+    int32_t* width,
+    int32_t* height);
+
+/**
+ * Decode a READY image again, after its pixels were released.
+ *
+ * The pixels may be released after they are uploaded to a texture. If the texture is evicted, the pixels are decoded
+ * again from the image uri. Requests made while a decode is in flight are ignored. When decoding completes, the image
+ * observers receive another READY event.
+ */
+void lse_image_store_reload_image(lse_image_store* store, lse_image* image, bool async);
+
+/**
+ * Record that a consumer (a window) draws an image. Calls are counted and balanced by
+ * lse_image_store_remove_consumer(), which must be called before the image is released.
+ */
+void lse_image_store_add_consumer(lse_image_store* store, lse_image* image, void* consumer);
+void lse_image_store_remove_consumer(lse_image_store* store, lse_image* image, void* consumer);
+
+/**
+ * Called by a consumer after it uploads the pixels of an image to a texture.
+ *
+ * The store owns the decoded pixels and textures belong to the windows. Pixels are released once every consumer of the
+ * image has uploaded them, or right away if the image has no consumers. A consumer that needs the pixels again later
+ * gets them through lse_image_store_reload_image().
+ */
+void lse_image_store_on_image_uploaded(lse_image_store* store, lse_image* image, void* consumer);
+
 void lse_image_store_destroy(lse_image_store* store);
 bool lse_image_store_is_destroyed(lse_image_store* store);
 
 lse_status lse_image_store_attach(lse_image_store* store);
 void lse_image_store_detach(lse_image_store* store);
 
+void lse_image_store_get_stats(lse_image_store* store, lse_image_store_stats* stats);
+
 void lse_image_store_add_observer(lse_image_store* store, void* observer, lse_image_event_callback callback);
 void lse_image_store_remove_observer(lse_image_store* store, void* observer);
 
@@ -38,9 +136,25 @@ void lse_image_store_remove_observer(lse_image_store* store, void* observer);
 //
 
 typedef struct image_resource image_resource;
+typedef struct image_consumer image_consumer;
+
+struct image_consumer {
+  void* consumer;
+  int32_t usages;
+  bool has_uploaded;
+};
 
 struct image_resource {
+  // normalized uri, plus the decode size bucket for images not decoded at full size
+  lse_string* key;
   lse_image* image;
   int32_t usages;
   lse_thread_pool_task* task;
+  // a decode of the released pixels is in flight
+  bool is_reloading;
+  // order of the last release, for evicting the least recently released image. only meaningful when usages is 0.
+  uint64_t release_order;
+  // windows drawing the image. the pixels are released once each of them has a texture.
+  image_consumer* consumers;
+  int32_t consumer_count;
 };
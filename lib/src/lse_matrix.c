@@ -12,6 +12,8 @@
  */
 
 #include "lse_matrix.h"
+
+#include "lse_rect.h"
 #include <math.h>
 
 #define PI_F 3.14159265f
@@ -76,6 +78,31 @@ lse_matrix* lse_matrix_multiply(const lse_matrix* lhs, const lse_matrix* rhs, ls
   return out;
 }
 
+lse_rect_f lse_matrix_transform_bounds(const lse_matrix* m, const lse_rect_f* rect) {
+  const float xs[] = { rect->x, rect->x + rect->width };
+  const float ys[] = { rect->y, rect->y + rect->height };
+  float min_x = INFINITY;
+  float min_y = INFINITY;
+  float max_x = -INFINITY;
+  float max_y = -INFINITY;
+  float tx;
+  float ty;
+
+  for (int32_t i = 0; i < 2; i++) {
+    for (int32_t j = 0; j < 2; j++) {
+      tx = m->a * xs[i] + m->b * ys[j] + m->x;
+      ty = m->c * xs[i] + m->d * ys[j] + m->y;
+
+      min_x = fminf(min_x, tx);
+      min_y = fminf(min_y, ty);
+      max_x = fmaxf(max_x, tx);
+      max_y = fmaxf(max_y, ty);
+    }
+  }
+
+  return (lse_rect_f){ min_x, min_y, max_x - min_x, max_y - min_y };
+}
+
 void lse_matrix_multiply_point(
     const lse_matrix* m,
     float point_x,
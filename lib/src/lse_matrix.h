@@ -13,6 +13,8 @@
 
 #pragma once
 
+#include "lse_types.h"
+
 typedef struct lse_matrix {
   float a, b, x; // row 1
   float c, d, y; // row 2
@@ -32,6 +34,10 @@ float lse_matrix_get_scale_y(const lse_matrix* m);
 float lse_matrix_get_translate_x(const lse_matrix* m);
 float lse_matrix_get_translate_y(const lse_matrix* m);
 lse_matrix* lse_matrix_multiply(const lse_matrix* a, const lse_matrix* b, lse_matrix* out);
+/**
+ * Axis aligned bounding box of rect after it has been transformed by m.
+ */
+lse_rect_f lse_matrix_transform_bounds(const lse_matrix* m, const lse_rect_f* rect);
 void lse_matrix_multiply_point(
     const lse_matrix* m,
     float point_x,
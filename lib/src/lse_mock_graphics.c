@@ -13,15 +13,28 @@
 
 #include "lse_graphics.h"
 
+#include "lse_env.h"
+#include "lse_memory.h"
 #include "lse_object.h"
+#include "lse_video.h"
+#include <stdlib.h>
 
 typedef struct lse_mock_graphics lse_mock_graphics;
+typedef struct mock_render_object mock_render_object;
 
 struct lse_mock_graphics {
   lse_graphics_base base;
   bool is_configured;
 };
 
+// the mock does not draw anything. render objects only exist, so render object stats match a real backend.
+struct mock_render_object {
+  int32_t width;
+  int32_t height;
+};
+
+static lse_render_object* mock_render_object_new(lse_graphics* graphics, int32_t width, int32_t height);
+
 // @override
 static void constructor(lse_object* object, void* arg) {
   lse_graphics* self = (lse_graphics*)object;
@@ -39,6 +52,8 @@ static void destructor(lse_object* object) {
 // @override
 static lse_status configure(lse_graphics* graphics, void* arg) {
   lse_mock_graphics* self = (lse_mock_graphics*)graphics;
+  lse_env* env = self->base.env;
+  lse_display_mode display_mode;
 
   if (lse_graphics_is_destroyed(graphics)) {
     return LSE_ERR_EOL;
@@ -48,6 +63,12 @@ static lse_status configure(lse_graphics* graphics, void* arg) {
     return LSE_ERR_ALREADY_CONFIGURED;
   }
 
+  if (lse_video_get_current_display_mode(env->video, 0, &display_mode)) {
+    self->base.refresh_rate = display_mode.refresh_rate;
+  }
+
+  self->base.is_vsync_enabled = (env->render_settings.vsync != LSE_VSYNC_MODE_OFF);
+  self->base.can_set_vsync = true;
   self->is_configured = true;
 
   return LSE_OK;
@@ -104,31 +125,84 @@ static void set_opacity(lse_graphics* graphics, float opacity) {
 // @override
 static void set_clip_rect(lse_graphics* graphics, lse_rect_f* rect) {
   lse_graphics_base_set_clip_rect(graphics, rect);
+  lse_graphics_add_render_stat(graphics, clip_rect_changes, 1);
 }
 
 // @override
 static void clear(lse_graphics* graphics, lse_color color) {
+  lse_graphics_add_render_stat(graphics, draw_calls, 1);
 }
 
 // @override
 static void remove_image(lse_graphics* graphics, lse_image* image) {
 }
 
+// @override
+static void set_vsync(lse_graphics* graphics, bool enabled) {
+  lse_graphics_get_base(graphics)->is_vsync_enabled = enabled;
+}
+
 // @override
 static void draw_render_object(lse_graphics* graphics, lse_render_object* render_object, lse_color color) {
+  if (render_object) {
+    lse_graphics_add_render_stat(graphics, color_mod_changes, 1);
+    lse_graphics_add_render_stat(graphics, alpha_mod_changes, 1);
+    lse_graphics_add_render_stat(graphics, draw_calls, 1);
+  }
+}
+
+// @override
+static bool
+get_opaque_rect(lse_graphics* graphics, lse_render_object* render_object, lse_color color, lse_rect_f* rect) {
+  return false;
 }
 
 // @override
 static lse_render_object* destroy_render_object(lse_graphics* graphics, lse_render_object* render_object) {
+  if (render_object) {
+    free(render_object);
+    lse_graphics_add_render_stat(graphics, render_object_count, -1);
+  }
+
   return NULL;
 }
 
 // @override
 static lse_render_object*
 end_queue(lse_graphics* graphics, int32_t width, int32_t height, lse_render_object* render_object) {
+  if (lse_render_queue_size(&lse_graphics_get_base(graphics)->render_queue) == 0) {
+    return destroy_render_object(graphics, render_object);
+  }
+
+  if (!render_object) {
+    return mock_render_object_new(graphics, width, height);
+  }
+
+  *(mock_render_object*)render_object = (mock_render_object){ width, height };
+
+  return render_object;
+}
+
+// @override
+static lse_render_object*
+begin_layer(lse_graphics* graphics, int32_t width, int32_t height, lse_render_object* render_object) {
   return NULL;
 }
 
+// @override
+static void end_layer(lse_graphics* graphics) {
+}
+
+// @private
+static lse_render_object* mock_render_object_new(lse_graphics* graphics, int32_t width, int32_t height) {
+  mock_render_object* mro = lse_malloc(sizeof(mock_render_object));
+
+  *mro = (mock_render_object){ width, height };
+  lse_graphics_add_render_stat(graphics, render_object_count, 1);
+
+  return (lse_render_object*)mro;
+}
+
 // ////////////////////////////////////////////////////////////////////////////
 // Export type information for lse_object.c:register_types().
 // ////////////////////////////////////////////////////////////////////////////
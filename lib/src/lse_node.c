@@ -93,6 +93,50 @@ static void insert_child_at(YGNodeRef parent, YGNodeRef child, uint32_t index) {
   lse_object_ref(YGNodeGetContext(child));
 }
 
+static void mark_ancestors(lse_node* node, uint32_t flag) {
+  lse_node* parent = lse_node_get_parent(node);
+
+  // stop at the first ancestor already marked; everything above it was marked by an earlier request
+  while (parent && !lse_node_has_flag(parent, flag)) {
+    lse_node_set_flag(parent, flag);
+    parent = lse_node_get_parent(parent);
+  }
+}
+
+static void mark_ancestors_of_inserted(lse_node* child) {
+  // the new child has to be drawn into the layers of its new ancestors. the child is marked, too, so the area of a
+  // subtree that is added back without changes is damaged again.
+  lse_node_set_flag(child, LSE_NODE_FLAG_COMPOSITE);
+  mark_ancestors(child, LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+
+  // pending work in a subtree that was built off-graph becomes visible to the new ancestors
+  if (lse_node_has_flag(child, LSE_NODE_FLAG_RESOLVE | LSE_NODE_FLAG_DESCENDANT_RESOLVE)) {
+    mark_ancestors(child, LSE_NODE_FLAG_DESCENDANT_RESOLVE);
+  }
+
+  if (lse_node_has_flag(child, LSE_NODE_FLAG_PAINT | LSE_NODE_FLAG_DESCENDANT_PAINT)) {
+    mark_ancestors(child, LSE_NODE_FLAG_DESCENDANT_PAINT);
+  }
+}
+
+static bool update_paint_layout(lse_node* node) {
+  lse_node_base* base = lse_node_get_base(node);
+  lse_size size = { YGNodeLayoutGetWidth(base->yg_node), YGNodeLayoutGetHeight(base->yg_node) };
+  lse_border_rect border = lse_style_get_border_edges(node);
+
+  if (lse_equals_f(size.width, base->layout_size.width) && lse_equals_f(size.height, base->layout_size.height)
+      && lse_equals_f(border.top, base->layout_border.top) && lse_equals_f(border.right, base->layout_border.right)
+      && lse_equals_f(border.bottom, base->layout_border.bottom)
+      && lse_equals_f(border.left, base->layout_border.left)) {
+    return false;
+  }
+
+  base->layout_size = size;
+  base->layout_border = border;
+
+  return true;
+}
+
 void lse_node_base_constructor(lse_node* node, lse_window* window) {
   lse_node_base* base = lse_node_get_base(node);
 
@@ -127,8 +171,11 @@ bool lse_node_base_style_property_change(lse_node* node, lse_style_property prop
       //      // TODO: addChild(), removeChild()
       //      // TODO: check if captured in paint
       //      // TODO: transform could cause a re-paint
-      //      lse_node_request_composite(node);
-      //      break;
+      lse_node_request_group_composite(node);
+      break;
+    case LSE_SP_WILL_CHANGE:
+      lse_node_request_composite(node);
+      break;
       // layout properties
     case LSE_SP_ALIGN_ITEMS:
       YGStyleSetEnum(AlignItems, YGAlign, base, prop);
@@ -281,6 +328,9 @@ void lse_node_base_destroy(lse_node* node) {
   lse_window_destroy_render_object(base->window, base->surface);
   base->surface = NULL;
 
+  lse_window_destroy_render_object(base->window, base->layer);
+  base->layer = NULL;
+
   lse_unref(base->window);
   base->window = NULL;
 
@@ -315,15 +365,26 @@ bool lse_node_is_destroyed(lse_node* node) {
 }
 
 lse_image* lse_node_base_image_acquire(lse_node* node, lse_string* uri, lse_image_event_callback callback) {
+  return lse_node_base_image_acquire_at_size(node, uri, 0, 0, callback);
+}
+
+lse_image* lse_node_base_image_acquire_at_size(
+    lse_node* node,
+    lse_string* uri,
+    int32_t display_width,
+    int32_t display_height,
+    lse_image_event_callback callback) {
   lse_node_base* base = lse_node_get_base(node);
   lse_image_store* store = lse_window_get_image_store(base->window);
   lse_resource_state state;
-  lse_image* image = lse_image_store_acquire_image(store, uri, LSE_IMAGE_STORE_ASYNC);
+  lse_image* image =
+      lse_image_store_acquire_image_at_size(store, uri, display_width, display_height, LSE_IMAGE_STORE_ASYNC);
 
   if (!image) {
     return NULL;
   }
 
+  lse_image_store_add_consumer(store, image, base->window);
   lse_image_add_observer(image, node, callback);
 
   state = lse_image_get_state(image);
@@ -347,6 +408,7 @@ lse_image* lse_node_base_image_release(lse_node* node, lse_image* image) {
     lse_image_store* store = lse_window_get_image_store(base->window);
 
     lse_image_remove_observer(image, node);
+    lse_image_store_remove_consumer(store, image, base->window);
     lse_image_store_release_image(store, image);
 
     // TODO: not the right check
@@ -360,6 +422,12 @@ lse_image* lse_node_base_image_release(lse_node* node, lse_image* image) {
   return NULL;
 }
 
+bool lse_node_base_image_has_uri(lse_node* node, lse_image* image, lse_string* uri) {
+  lse_image_store* store = lse_window_get_image_store(lse_node_get_base(node)->window);
+
+  return lse_image_store_has_uri(store, image, lse_string_as_cstring(uri));
+}
+
 void lse_node_traverse_pre_order(lse_node* node, void (*func)(lse_node*)) {
   YGNodeRef yg_node = lse_node_get_base(node)->yg_node;
   uint32_t count = YGNodeGetChildCount(yg_node);
@@ -432,6 +500,7 @@ LSE_API bool LSE_CDECL lse_node_append(lse_node* node, lse_node* child) {
   }
 
   insert_child_at(base->yg_node, child_base->yg_node, YGNodeGetChildCount(base->yg_node));
+  mark_ancestors_of_inserted(child);
 
   lse_root_node_inline_layout(lse_window_get_root(base->window));
 
@@ -452,6 +521,7 @@ LSE_API bool LSE_CDECL lse_node_insert_before(lse_node* node, lse_node* child, l
   uint32_t before_index = get_index(node_base->yg_node, before_base->yg_node);
 
   insert_child_at(node_base->yg_node, child_base->yg_node, before_index);
+  mark_ancestors_of_inserted(child);
 
   lse_root_node_inline_layout(lse_window_get_root(node_base->window));
 
@@ -467,6 +537,12 @@ LSE_API bool LSE_CDECL lse_node_remove_child(lse_node* node, lse_node* child) {
     return false;
   }
 
+  // the area the child covered needs to be redrawn without it
+  lse_root_node_add_subtree_damage(lse_window_get_root(node_base->window), child);
+  lse_node_request_composite(lse_window_get_root(node_base->window));
+  // layers the child was drawn into need to be redrawn without it
+  mark_ancestors(child, LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+
   YGNodeRemoveChild(node_base->yg_node, child_base->yg_node);
 
   // Remove reference for the child.
@@ -489,7 +565,12 @@ LSE_API lse_style* LSE_CDECL lse_node_get_style_or_empty(lse_node* node) {
 void lse_node_on_yoga_layout_event(YGNodeConstRef yg_node, int32_t layout_type) {
   lse_node* node = YGNodeGetContext((YGNodeRef)yg_node);
 
-  lse_node_request_style_resolve(node, LSE_NODE_FLAG_BOUNDS);
+  // surfaces are painted at (0,0), so a position only change can reuse the surface at composite time
+  if (update_paint_layout(node)) {
+    lse_node_request_style_resolve(node, LSE_NODE_FLAG_BOUNDS);
+  } else {
+    lse_node_request_group_composite(node);
+  }
 }
 
 bool lse_node_is_leaf(lse_node* node) {
@@ -510,15 +591,22 @@ void lse_node_unset_flag(lse_node* node, uint32_t flag) {
 
 void lse_node_request_paint(lse_node* node) {
   lse_node_set_flag(node, LSE_NODE_FLAG_PAINT);
-  lse_node_set_flag(lse_window_get_root(lse_node_get_base(node)->window), LSE_NODE_FLAG_PAINT);
+  mark_ancestors(node, LSE_NODE_FLAG_DESCENDANT_PAINT);
 }
 
 void lse_node_request_style_resolve(lse_node* node, uint32_t flag) {
   lse_node_set_flag(node, flag | LSE_NODE_FLAG_RESOLVE);
-  lse_node_set_flag(lse_window_get_root(lse_node_get_base(node)->window), LSE_NODE_FLAG_RESOLVE);
+  mark_ancestors(node, LSE_NODE_FLAG_DESCENDANT_RESOLVE);
 }
 
 void lse_node_request_composite(lse_node* node) {
-  //  lse_node_set_flag(node, LSE_NODE_FLAG_COMPOSITE);
+  lse_node_set_flag(node, LSE_NODE_FLAG_COMPOSITE);
+  mark_ancestors(node, LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+  lse_node_set_flag(lse_window_get_root(lse_node_get_base(node)->window), LSE_NODE_FLAG_COMPOSITE);
+}
+
+void lse_node_request_group_composite(lse_node* node) {
+  lse_node_set_flag(node, LSE_NODE_FLAG_GROUP);
+  mark_ancestors(node, LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
   lse_node_set_flag(lse_window_get_root(lse_node_get_base(node)->window), LSE_NODE_FLAG_COMPOSITE);
 }
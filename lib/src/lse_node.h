@@ -28,6 +28,7 @@ typedef struct lse_node_interface lse_node_interface;
 struct lse_node_interface {
   void (*destroy)(lse_node*);
   void (*on_composite)(lse_node*, lse_graphics*);
+  bool (*get_opaque_rect)(lse_node*, lse_graphics*, lse_rect_f*);
   void (*on_paint)(lse_node*, lse_graphics*);
   void (*on_style_resolve)(lse_node*);
   void (*on_style_property_change)(lse_node*, lse_style_property);
@@ -37,6 +38,7 @@ struct lse_node_interface {
   static lse_node_interface vtable = {                                                                                 \
     .destroy = destroy,                                                                                                \
     .on_composite = on_composite,                                                                                      \
+    .get_opaque_rect = get_opaque_rect,                                                                                \
     .on_paint = on_paint,                                                                                              \
     .on_style_resolve = on_style_resolve,                                                                              \
     .on_style_property_change = on_style_property_change,                                                              \
@@ -58,6 +60,15 @@ typedef enum lse_node_flag {
   LSE_NODE_FLAG_COLOR = 1 << 6,
   LSE_NODE_FLAG_TEXT = 1 << 7,
   LSE_NODE_FLAG_FONT = 1 << 8,
+
+  // set on every ancestor of a node with RESOLVE or PAINT set, so scene graph walks can skip clean subtrees
+  LSE_NODE_FLAG_DESCENDANT_RESOLVE = 1 << 9,
+  LSE_NODE_FLAG_DESCENDANT_PAINT = 1 << 10,
+  // set on every ancestor of a node with COMPOSITE or GROUP set, so a layer knows when its cached content is stale
+  LSE_NODE_FLAG_DESCENDANT_COMPOSITE = 1 << 11,
+
+  // placement of the node's subtree (position, transform or opacity) changed, but not its content
+  LSE_NODE_FLAG_GROUP = 1 << 12,
 } lse_node_flag;
 
 struct lse_node_base {
@@ -68,6 +79,17 @@ struct lse_node_base {
 
   uint32_t flags;
   lse_render_object* surface;
+  // axis aligned bounds in window space, as of the last partial redraw
+  lse_rect_f window_bounds;
+  // paint relevant layout (size and border widths), as of the last layout event
+  lse_size layout_size;
+  lse_border_rect layout_border;
+  // subtree rendered to an offscreen texture, drawn as a single quad at composite time
+  lse_render_object* layer;
+  // layer texture area in node space
+  lse_rect_f layer_bounds;
+  // consecutive composited frames with GROUP set, used to promote animated subtrees to layers
+  uint8_t group_frames;
 };
 
 //
@@ -81,6 +103,10 @@ struct lse_node_base {
 
 #define lse_node_destroy(INSTANCE) LSE_NODE_V((lse_node*)(INSTANCE), destroy)
 #define lse_node_on_composite(INSTANCE, ...) LSE_NODE_A((lse_node*)(INSTANCE), on_composite, __VA_ARGS__)
+/**
+ * Get the area, in node space, that on_composite would cover with fully opaque pixels. Returns false if there is none.
+ */
+#define lse_node_get_opaque_rect(INSTANCE, ...) LSE_NODE_A((lse_node*)(INSTANCE), get_opaque_rect, __VA_ARGS__)
 #define lse_node_on_paint(INSTANCE, ...) LSE_NODE_A((lse_node*)(INSTANCE), on_paint, __VA_ARGS__)
 #define lse_node_on_style_resolve(INSTANCE) LSE_NODE_V((lse_node*)(INSTANCE), on_style_resolve)
 #define lse_node_on_style_property_change(INSTANCE, ...)                                                               \
@@ -102,14 +128,37 @@ void lse_node_base_destroy(lse_node* node);
 bool lse_node_base_style_property_change(lse_node* node, lse_style_property prop);
 
 lse_image* lse_node_base_image_acquire(lse_node* node, lse_string* uri, lse_image_event_callback callback);
+
+/**
+ * Acquire an image decoded for display at display_width x display_height px. See
+ * lse_image_store_acquire_image_at_size().
+ */
+lse_image* lse_node_base_image_acquire_at_size(
+    lse_node* node,
+    lse_string* uri,
+    int32_t display_width,
+    int32_t display_height,
+    lse_image_event_callback callback);
 lse_image* lse_node_base_image_release(lse_node* node, lse_image* image);
 
+/**
+ * Check if uri refers to an image, at any decode size. Image uris are normalized by the image store, so uri is compared
+ * in the same form.
+ */
+bool lse_node_base_image_has_uri(lse_node* node, lse_image* image, lse_string* uri);
+
 // TODO: layout_type does not need to be passed
 void lse_node_on_yoga_layout_event(YGNodeConstRef yg_node, int32_t layout_type);
 
 void lse_node_request_paint(lse_node* node);
 void lse_node_request_style_resolve(lse_node* node, uint32_t flag);
 void lse_node_request_composite(lse_node* node);
+/**
+ * Request a composite for a change that moves, transforms or fades the node's subtree without changing its content.
+ *
+ * Unlike lse_node_request_composite(), the node's layer (if it has one) stays valid.
+ */
+void lse_node_request_group_composite(lse_node* node);
 
 bool lse_node_is_leaf(lse_node* node);
 bool lse_node_has_flag(lse_node* node, uint32_t flag);
@@ -121,6 +170,28 @@ void lse_node_unset_flag(lse_node* node, uint32_t flag);
 //
 
 void lse_root_node_update(lse_node* node, lse_graphics* graphics, float width, float height);
+/**
+ * Checks if the scene graph has pending layout, style resolve, paint or composite work. If not, a frame would
+ * produce the same image as the last presented frame.
+ */
+bool lse_root_node_is_dirty(lse_node* node);
+/**
+ * Mark a window space region for redraw. Only used when partial redraw is enabled.
+ */
+void lse_root_node_add_damage(lse_node* node, const lse_rect_f* rect);
+/**
+ * Mark the last drawn bounds of node and its descendants for redraw. Called when node leaves the scene graph.
+ */
+void lse_root_node_add_subtree_damage(lse_node* node, lse_node* subtree);
+/**
+ * Redraw the whole window in the next update and drop the layer textures of the scene graph. Called when the renderer
+ * lost the contents of the window or of its render targets.
+ */
+void lse_root_node_invalidate(lse_node* node);
+/**
+ * Number of nodes skipped by visibility culling in the last update.
+ */
+uint32_t lse_root_node_get_culled_node_count(lse_node* node);
 void lse_root_node_inline_layout(lse_node* node);
 
 //
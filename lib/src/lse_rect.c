@@ -72,3 +72,87 @@ lse_rect lse_rect_intersect(const lse_rect* a, const lse_rect* b) {
     (by2 < ay2) ? by2 - y : ay2 - y,
   };
 }
+
+bool lse_rect_f_is_empty(const lse_rect_f* rect) {
+  return !rect || rect->width <= 0 || rect->height <= 0;
+}
+
+bool lse_rect_f_equals(const lse_rect_f* a, const lse_rect_f* b) {
+  return lse_equals_f(a->x, b->x) && lse_equals_f(a->y, b->y) && lse_equals_f(a->width, b->width)
+         && lse_equals_f(a->height, b->height);
+}
+
+bool lse_rect_f_intersects(const lse_rect_f* a, const lse_rect_f* b) {
+  return !lse_rect_f_is_empty(a) && !lse_rect_f_is_empty(b) && a->x < b->x + b->width && b->x < a->x + a->width
+         && a->y < b->y + b->height && b->y < a->y + a->height;
+}
+
+bool lse_rect_f_contains(const lse_rect_f* a, const lse_rect_f* b) {
+  return !lse_rect_f_is_empty(a) && !lse_rect_f_is_empty(b) && b->x >= a->x && b->y >= a->y
+         && b->x + b->width <= a->x + a->width && b->y + b->height <= a->y + a->height;
+}
+
+lse_rect_f lse_rect_f_intersect(const lse_rect_f* a, const lse_rect_f* b) {
+  float x;
+  float y;
+
+  if (!lse_rect_f_intersects(a, b)) {
+    return (lse_rect_f){ 0 };
+  }
+
+  x = lse_max(a->x, b->x);
+  y = lse_max(a->y, b->y);
+
+  return (lse_rect_f){
+    x,
+    y,
+    lse_min(a->x + a->width, b->x + b->width) - x,
+    lse_min(a->y + a->height, b->y + b->height) - y,
+  };
+}
+
+lse_rect_f lse_rect_f_union(const lse_rect_f* a, const lse_rect_f* b) {
+  float x;
+  float y;
+
+  if (lse_rect_f_is_empty(a)) {
+    return lse_rect_f_is_empty(b) ? (lse_rect_f){ 0 } : *b;
+  } else if (lse_rect_f_is_empty(b)) {
+    return *a;
+  }
+
+  x = fminf(a->x, b->x);
+  y = fminf(a->y, b->y);
+
+  return (lse_rect_f){
+    x,
+    y,
+    fmaxf(a->x + a->width, b->x + b->width) - x,
+    fmaxf(a->y + a->height, b->y + b->height) - y,
+  };
+}
+
+lse_rect_f lse_rect_f_round_out(const lse_rect_f* rect) {
+  float x = floorf(rect->x);
+  float y = floorf(rect->y);
+
+  return (lse_rect_f){
+    x,
+    y,
+    ceilf(rect->x + rect->width) - x,
+    ceilf(rect->y + rect->height) - y,
+  };
+}
+
+lse_rect_f lse_rect_f_round_in(const lse_rect_f* rect) {
+  float x = ceilf(rect->x);
+  float y = ceilf(rect->y);
+  float right = floorf(rect->x + rect->width);
+  float bottom = floorf(rect->y + rect->height);
+
+  if (right <= x || bottom <= y) {
+    return (lse_rect_f){ 0 };
+  }
+
+  return (lse_rect_f){ x, y, right - x, bottom - y };
+}
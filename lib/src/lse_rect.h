@@ -78,3 +78,31 @@ void lse_clip_image_rect(
 bool lse_rect_is_empty(const lse_rect* rect);
 
 lse_rect lse_rect_intersect(const lse_rect* a, const lse_rect* b);
+
+bool lse_rect_f_is_empty(const lse_rect_f* rect);
+bool lse_rect_f_equals(const lse_rect_f* a, const lse_rect_f* b);
+bool lse_rect_f_intersects(const lse_rect_f* a, const lse_rect_f* b);
+/**
+ * Checks if b lies entirely inside of a. Empty rects are never contained.
+ */
+bool lse_rect_f_contains(const lse_rect_f* a, const lse_rect_f* b);
+
+/**
+ * Overlapping area of a and b. Returns an empty rect if a and b do not intersect.
+ */
+lse_rect_f lse_rect_f_intersect(const lse_rect_f* a, const lse_rect_f* b);
+
+/**
+ * Smallest rect containing a and b. Empty rects are ignored.
+ */
+lse_rect_f lse_rect_f_union(const lse_rect_f* a, const lse_rect_f* b);
+
+/**
+ * Expand rect outwards to whole pixels.
+ */
+lse_rect_f lse_rect_f_round_out(const lse_rect_f* rect);
+
+/**
+ * Shrink rect inwards to whole pixels. Returns an empty rect if no whole pixel is covered.
+ */
+lse_rect_f lse_rect_f_round_in(const lse_rect_f* rect);
@@ -41,8 +41,8 @@ struct lse_render_command {
   lse_border_radius* corners;
   lse_border_rect* edges;
   float stroke_width;
-  lse_string* text;
   lse_text_style* text_style;
+  lse_text_layout* text_layout;
 };
 
 forward_cvec(cvec_render_commands, lse_render_command);
@@ -13,20 +13,58 @@
 
 #include "lse_node.h"
 
+#include "lse_env.h"
 #include "lse_graphics.h"
 #include "lse_object.h"
 #include "lse_style.h"
+#include "lse_trace.h"
 #include "lse_window.h"
 
 typedef struct lse_root_node lse_root_node;
 
 struct lse_root_node {
   lse_node_base base;
+
+  // window space region to redraw in the next partial redraw
+  lse_rect_f damage;
+  // region highlighted by the redraw region overlay in the last frame
+  lse_rect_f overlay_rect;
+  lse_render_object* overlay;
+  // nodes skipped by visibility culling in the last frame
+  uint32_t culled_node_count;
+  // texture memory of the layers drawn so far in the current frame
+  int64_t layer_bytes;
 };
 
-static void run_layout(lse_node* node, float width, float height);
-static void run_paint(lse_node* node, lse_graphics* graphics);
-static void run_composite(lse_node* node, lse_graphics* graphics);
+// translucent magenta
+#define REDRAW_OVERLAY_COLOR LSE_COLOR_MAKE(255, 0, 255, 96)
+// consecutive frames with transform, opacity or position changes before a subtree is promoted to a layer
+#define LAYER_PROMOTE_FRAMES 3
+// largest layer texture, as a multiple of the window size
+#define LAYER_MAX_WINDOW_SCALE 2
+// texture memory shared by all layers of a window. subtrees that do not fit are drawn node by node.
+#define LAYER_MAX_BYTES (64 * 1024 * 1024)
+
+static void run_layout(lse_node* node, float width, float height, lse_frame_timing* timing);
+static void run_paint(lse_node* node, lse_graphics* graphics, lse_frame_timing* timing);
+static lse_frame_phase get_paint_phase(lse_node* node);
+static void run_composite(lse_node* node, lse_graphics* graphics, const lse_rect_f* visible_rect, bool in_layer);
+static void composite_subtree(lse_node* node, lse_graphics* graphics, const lse_rect_f* visible_rect, bool in_layer);
+static void cull_subtree(lse_node* node, lse_graphics* graphics);
+static int32_t find_occluding_child(lse_node* node, lse_graphics* graphics, const lse_rect_f* visible_rect);
+static lse_rect_f get_target_bounds(lse_graphics* graphics, const lse_rect_f* box);
+static bool update_layer(lse_node* node, lse_graphics* graphics, const lse_rect_f* box, bool clip);
+static bool should_use_layer(lse_node* node, lse_style* style);
+static bool is_translation(const lse_matrix* matrix);
+static int64_t get_layer_bytes(const lse_rect_f* bounds);
+static void release_layer(lse_node* node, lse_graphics* graphics);
+static lse_rect_f get_subtree_bounds(lse_node* node, const lse_matrix* matrix);
+static void
+run_partial_composite(lse_node* node, lse_graphics* graphics, const lse_rect_f* viewport, bool show_redraw_regions);
+static void collect_damage(lse_node* node, const lse_matrix* parent_matrix, bool force, lse_rect_f* damage);
+static lse_matrix get_node_matrix(lse_node* node, const lse_matrix* parent_matrix, const lse_rect_f* box);
+static void draw_redraw_overlay(lse_node* node, lse_graphics* graphics, const lse_rect_f* rect);
+static void drop_layer(lse_node* node);
 static void resolve(lse_node* node);
 
 // @override
@@ -41,7 +79,12 @@ static void destructor(lse_object* object) {
 
 // @override
 static void destroy(lse_node* node) {
+  lse_root_node* self = (lse_root_node*)node;
+
   if (!lse_node_is_destroyed(node)) {
+    lse_window_destroy_render_object(self->base.window, self->overlay);
+    self->overlay = NULL;
+
     lse_node_base_destroy(node);
   }
 }
@@ -61,6 +104,12 @@ static void on_composite(lse_node* node, lse_graphics* graphics) {
   lse_graphics_clear(graphics, lse_style_get_color_t(style, LSE_SP_BACKGROUND_COLOR));
 }
 
+// @override
+static bool get_opaque_rect(lse_node* node, lse_graphics* graphics, lse_rect_f* rect) {
+  // the root is never a sibling of another node
+  return false;
+}
+
 // @override
 static void on_style_property_change(lse_node* node, lse_style_property property) {
   lse_root_node* self = (lse_root_node*)node;
@@ -69,6 +118,8 @@ static void on_style_property_change(lse_node* node, lse_style_property property
     case LSE_SP_BACKGROUND_COLOR:
     case LSE_SP_OPACITY:
       lse_node_request_composite(node);
+      lse_root_node_add_damage(node, &(lse_rect_f){ 0, 0, (float)lse_window_get_width(self->base.window),
+                                                    (float)lse_window_get_height(self->base.window) });
       break;
     case LSE_SP_FONT_SIZE:
       lse_window_dispatch_root_font_size_change(
@@ -84,12 +135,79 @@ static void on_style_property_change(lse_node* node, lse_style_property property
 
 // @public
 void lse_root_node_update(lse_node* node, lse_graphics* graphics, float width, float height) {
-  run_layout(node, width, height);
+  lse_root_node* self = (lse_root_node*)node;
+  lse_env* env = lse_window_get_env(self->base.window);
+  const lse_render_settings* settings = &env->render_settings;
+  lse_rect_f viewport = { 0, 0, width, height };
+  double start;
+
+  run_layout(node, width, height, &env->frame_timing);
 
-  run_paint(node, graphics);
+  start = lse_get_time_ms();
+  run_paint(node, graphics, &env->frame_timing);
+  start = lse_frame_timing_mark(&env->frame_timing, LSE_FRAME_PHASE_PAINT, start);
+
+  // cleared before compositing, so composite requests made during the pass schedule another frame
+  lse_node_unset_flag(node, LSE_NODE_FLAG_COMPOSITE);
 
   lse_graphics_reset_state(graphics);
-  run_composite(node, graphics);
+  self->culled_node_count = 0;
+  self->layer_bytes = 0;
+
+  if (settings->partial_redraw) {
+    run_partial_composite(node, graphics, &viewport, settings->show_redraw_regions);
+  } else {
+    lse_graphics_set_redraw_rect(graphics, &viewport, &viewport);
+    run_composite(node, graphics, &viewport, false);
+  }
+
+  lse_frame_timing_mark(&env->frame_timing, LSE_FRAME_PHASE_COMPOSITE, start);
+}
+
+// @public
+uint32_t lse_root_node_get_culled_node_count(lse_node* node) {
+  return ((lse_root_node*)node)->culled_node_count;
+}
+
+// @public
+void lse_root_node_add_damage(lse_node* node, const lse_rect_f* rect) {
+  lse_root_node* self = (lse_root_node*)node;
+
+  self->damage = lse_rect_f_union(&self->damage, rect);
+}
+
+// @public
+void lse_root_node_add_subtree_damage(lse_node* node, lse_node* subtree) {
+  lse_node_base* base = lse_node_get_base(subtree);
+  uint32_t count = lse_node_get_child_count(subtree);
+
+  lse_root_node_add_damage(node, &base->window_bounds);
+
+  // forget the bounds, so the subtree is damaged again if it is added back to the scene graph
+  base->window_bounds = (lse_rect_f){ 0 };
+
+  for (uint32_t i = 0; i < count; i++) {
+    lse_root_node_add_subtree_damage(node, lse_node_get_child_at(subtree, i));
+  }
+}
+
+// @public
+void lse_root_node_invalidate(lse_node* node) {
+  lse_root_node* self = (lse_root_node*)node;
+
+  lse_node_traverse_pre_order(node, &drop_layer);
+  lse_node_request_composite(node);
+  lse_root_node_add_damage(node, &(lse_rect_f){ 0, 0, (float)lse_window_get_width(self->base.window),
+                                                (float)lse_window_get_height(self->base.window) });
+}
+
+// @public
+bool lse_root_node_is_dirty(lse_node* node) {
+  return lse_node_has_flag(
+             node,
+             LSE_NODE_FLAG_RESOLVE | LSE_NODE_FLAG_DESCENDANT_RESOLVE | LSE_NODE_FLAG_PAINT
+                 | LSE_NODE_FLAG_DESCENDANT_PAINT | LSE_NODE_FLAG_COMPOSITE)
+         || YGNodeIsDirty(lse_node_get_base(node)->yg_node);
 }
 
 // @public
@@ -97,6 +215,11 @@ void lse_root_node_inline_layout(lse_node* node) {
   lse_root_node* self = (lse_root_node*)node;
   YGNodeRef yg_node = self->base.yg_node;
 
+  // deferred to lse_window_end_batch()
+  if (lse_window_is_batching(self->base.window)) {
+    return;
+  }
+
   // run layout, if necessary
   if (YGNodeIsDirty(yg_node)) {
     YGNodeCalculateLayout(
@@ -107,7 +230,7 @@ void lse_root_node_inline_layout(lse_node* node) {
   }
 
   // flush existing style_resolve events and ones generated by the above layout calc
-  if (lse_node_has_flag(node, LSE_NODE_FLAG_RESOLVE)) {
+  if (lse_node_has_flag(node, LSE_NODE_FLAG_RESOLVE | LSE_NODE_FLAG_DESCENDANT_RESOLVE)) {
     resolve(node);
   }
 
@@ -131,6 +254,13 @@ static void resolve(lse_node* node) {
     lse_node_on_style_resolve(node);
   }
 
+  // unset before visiting children, so resolve requests made by descendants during the walk mark the path again
+  if (!lse_node_has_flag(node, LSE_NODE_FLAG_DESCENDANT_RESOLVE)) {
+    return;
+  }
+
+  lse_node_unset_flag(node, LSE_NODE_FLAG_DESCENDANT_RESOLVE);
+
   uint32_t count = lse_node_get_child_count(node);
 
   for (uint32_t i = 0; i < count; i++) {
@@ -139,70 +269,480 @@ static void resolve(lse_node* node) {
 }
 
 // @private
-static void run_layout(lse_node* node, float width, float height) {
+static void run_layout(lse_node* node, float width, float height, lse_frame_timing* timing) {
   YGNodeRef yg_node = lse_node_get_base(node)->yg_node;
+  double start = lse_get_time_ms();
 
   if (YGNodeIsDirty(yg_node)) {
     YGNodeCalculateLayout(yg_node, width, height, YGDirectionLTR);
   }
 
-  if (lse_node_has_flag(node, LSE_NODE_FLAG_RESOLVE)) {
+  start = lse_frame_timing_mark(timing, LSE_FRAME_PHASE_LAYOUT, start);
+
+  if (lse_node_has_flag(node, LSE_NODE_FLAG_RESOLVE | LSE_NODE_FLAG_DESCENDANT_RESOLVE)) {
     resolve(node);
   }
+
+  lse_frame_timing_mark(timing, LSE_FRAME_PHASE_RESOLVE, start);
 }
 
 // @private
-static void run_paint(lse_node* node, lse_graphics* graphics) {
-  if (!lse_node_is_leaf(node)) {
+static void run_paint(lse_node* node, lse_graphics* graphics, lse_frame_timing* timing) {
+  if (lse_node_has_flag(node, LSE_NODE_FLAG_DESCENDANT_PAINT)) {
     uint32_t i;
     uint32_t count = lse_node_get_child_count(node);
 
+    lse_node_unset_flag(node, LSE_NODE_FLAG_DESCENDANT_PAINT);
+
     for (i = 0; i < count; i++) {
-      run_paint(lse_node_get_child_at(node, i), graphics);
+      run_paint(lse_node_get_child_at(node, i), graphics, timing);
     }
   }
 
   if (lse_node_has_flag(node, LSE_NODE_FLAG_PAINT)) {
+    lse_frame_phase phase = get_paint_phase(node);
+    double start = lse_get_time_ms();
+
     lse_node_unset_flag(node, LSE_NODE_FLAG_PAINT);
     lse_node_on_paint(node, graphics);
+    LSE_TRACE_END_ARGS(
+        start,
+        "paint",
+        "on_paint",
+        "\"type\":\"%s\",\"id\":%i",
+        lse_object_get_type_name((lse_object*)node),
+        lse_node_get_base(node)->id);
+
+    if (phase != LSE_FRAME_PHASE_PAINT) {
+      lse_frame_timing_mark(timing, phase, start);
+    }
+  }
+}
+
+// @private
+static lse_frame_phase get_paint_phase(lse_node* node) {
+  switch (lse_object_get_type((lse_object*)node)) {
+    case lse_box_node_type:
+      return LSE_FRAME_PHASE_PAINT_BOX;
+    case lse_image_node_type:
+      return LSE_FRAME_PHASE_PAINT_IMAGE;
+    case lse_text_node_type:
+      return LSE_FRAME_PHASE_PAINT_TEXT;
+    default:
+      // root node painting only counts towards the paint total
+      return LSE_FRAME_PHASE_PAINT;
   }
 }
 
 // @private
-static void run_composite(lse_node* node, lse_graphics* graphics) {
+static void
+run_partial_composite(lse_node* node, lse_graphics* graphics, const lse_rect_f* viewport, bool show_redraw_regions) {
+  lse_root_node* self = (lse_root_node*)node;
+  lse_rect_f damage = self->damage;
+  lse_rect_f redraw_rect;
+  lse_rect_f visible_rect;
+
+  self->damage = (lse_rect_f){ 0 };
+
+  collect_damage(node, &k_identity, false, &damage);
+
+  damage = lse_rect_f_round_out(&damage);
+  // the overlay from the last frame is erased by redrawing what is underneath it
+  redraw_rect = lse_rect_f_union(&damage, &self->overlay_rect);
+  visible_rect = lse_rect_f_intersect(&redraw_rect, viewport);
+  lse_graphics_set_redraw_rect(graphics, viewport, &visible_rect);
+
+  if (lse_rect_f_is_empty(&redraw_rect)) {
+    return;
+  }
+
+  lse_graphics_push_state(graphics);
+  lse_graphics_set_clip_rect(graphics, &redraw_rect);
+
+  // with partial redraw, nodes outside of the redraw region are already correct in the back buffer
+  run_composite(node, graphics, &visible_rect, false);
+
+  if (show_redraw_regions && !lse_rect_f_is_empty(&damage)) {
+    draw_redraw_overlay(node, graphics, &damage);
+    // schedule a frame to erase the overlay
+    lse_node_request_composite(node);
+  }
+
+  self->overlay_rect = show_redraw_regions ? damage : (lse_rect_f){ 0 };
+
+  lse_graphics_pop_state(graphics);
+}
+
+// @private
+static void collect_damage(lse_node* node, const lse_matrix* parent_matrix, bool force, lse_rect_f* damage) {
+  lse_node_base* base = lse_node_get_base(node);
+  lse_rect_f box;
+  lse_matrix matrix;
+  lse_rect_f bounds;
+  uint32_t count;
+
+  // layout, paint and style changes that move or redraw a node request a composite, which marks the path from the
+  // root. a subtree off that path is where the last frame drew it. removed subtrees were damaged on removal.
+  if (!force
+      && !lse_node_has_flag(node, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_GROUP | LSE_NODE_FLAG_DESCENDANT_COMPOSITE)) {
+    return;
+  }
+
+  box = lse_node_get_box(node);
+  matrix = get_node_matrix(node, parent_matrix, &box);
+  bounds = lse_matrix_transform_bounds(&matrix, &(lse_rect_f){ 0, 0, box.width, box.height });
+
+  // composite and group flags cover surface, opacity and transform changes. opacity and transform apply to
+  // descendants, too.
+  force = force || lse_node_has_flag(node, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_GROUP);
+
+  if (force || !lse_rect_f_equals(&bounds, &base->window_bounds)) {
+    *damage = lse_rect_f_union(damage, &base->window_bounds);
+    *damage = lse_rect_f_union(damage, &bounds);
+    base->window_bounds = bounds;
+  }
+
+  if (!lse_node_is_leaf(node)) {
+    count = lse_node_get_child_count(node);
+
+    for (uint32_t i = 0; i < count; i++) {
+      collect_damage(lse_node_get_child_at(node, i), &matrix, force, damage);
+    }
+  }
+}
+
+// @private
+static lse_matrix get_node_matrix(lse_node* node, const lse_matrix* parent_matrix, const lse_rect_f* box) {
+  lse_style* style = lse_node_get_style_or_empty(node);
+  lse_matrix transform = lse_matrix_init_translate(box->x, box->y);
+  lse_matrix matrix;
+
+  lse_matrix_multiply(parent_matrix, &transform, &matrix);
+
+  if (lse_style_has_transform(style)) {
+    transform = lse_style_compute_transform(style, lse_window_get_style_context(lse_node_get_base(node)->window), box);
+    lse_matrix_multiply(&matrix, &transform, &matrix);
+  }
+
+  return matrix;
+}
+
+// @private
+static void draw_redraw_overlay(lse_node* node, lse_graphics* graphics, const lse_rect_f* rect) {
+  lse_root_node* self = (lse_root_node*)node;
+  lse_rect_f overlay_box = { 0, 0, rect->width, rect->height };
+  lse_matrix transform = lse_matrix_init_translate(rect->x, rect->y);
+
+  if (!lse_graphics_begin_queue(graphics)) {
+    return;
+  }
+
+  lse_graphics_queue_fill_rect(graphics, &overlay_box, REDRAW_OVERLAY_COLOR);
+  self->overlay = lse_graphics_end_queue(graphics, (int32_t)rect->width, (int32_t)rect->height, self->overlay);
+
+  if (self->overlay) {
+    lse_graphics_push_state(graphics);
+    lse_graphics_set_matrix(graphics, &transform);
+    lse_graphics_draw_render_object(graphics, self->overlay, REDRAW_OVERLAY_COLOR);
+    lse_graphics_pop_state(graphics);
+  }
+}
+
+// @private
+static void run_composite(lse_node* node, lse_graphics* graphics, const lse_rect_f* visible_rect, bool in_layer) {
   lse_node_base* base = lse_node_get_base(node);
   lse_style* style = lse_node_get_style_or_empty(node);
   lse_rect_f box = lse_node_get_box(node);
   bool clip = lse_style_get_enum(style, LSE_SP_OVERFLOW) == LSE_STYLE_OVERFLOW_HIDDEN;
+  lse_rect_f clip_rect;
+  lse_rect_f clipped_visible_rect;
   lse_matrix transform;
+  bool is_effect;
 
   lse_graphics_push_state(graphics);
   lse_graphics_set_opacity(graphics, lse_style_resolve_opacity(style));
 
-  if (clip) {
-    lse_graphics_set_clip_rect(graphics, &box);
-  }
-
   transform = lse_matrix_init_translate(box.x, box.y);
   lse_graphics_set_matrix(graphics, &transform);
 
+  // a moved subtree reuses its surfaces anyway, e.g. the items of a scrolled list. only fading, scaling and
+  // rotating change pixels a layer would cache.
+  is_effect = lse_style_resolve_opacity(style) < 1.f;
+
   if (lse_style_has_transform(style)) {
     transform = lse_style_compute_transform(style, lse_window_get_style_context(base->window), &box);
     lse_graphics_set_matrix(graphics, &transform);
+    is_effect = is_effect || !is_translation(&transform);
+  }
+
+  if (clip) {
+    clip_rect = get_target_bounds(graphics, &box);
+
+    // descendants of a clipping node cannot draw outside of its box, so nothing in an invisible subtree shows
+    if (!lse_rect_f_intersects(&clip_rect, visible_rect)) {
+      cull_subtree(node, graphics);
+      lse_graphics_pop_state(graphics);
+      return;
+    }
+
+    lse_graphics_set_clip_rect(graphics, &clip_rect);
+    clipped_visible_rect = lse_rect_f_intersect(&clip_rect, visible_rect);
+    visible_rect = &clipped_visible_rect;
   }
 
-  // TODO: check box empty
-  lse_node_on_composite(node, graphics);
+  if (lse_node_has_flag(node, LSE_NODE_FLAG_GROUP) && is_effect) {
+    base->group_frames = lse_min(base->group_frames + 1, LAYER_PROMOTE_FRAMES * 2);
+  } else if (base->group_frames > 0) {
+    base->group_frames--;
+  }
+
+  if (!in_layer && should_use_layer(node, style) && update_layer(node, graphics, &box, clip)) {
+    // the layer is drawn whole. the clip rect keeps partial redraw inside the redraw region.
+    transform = lse_matrix_init_translate(base->layer_bounds.x, base->layer_bounds.y);
+    lse_graphics_set_matrix(graphics, &transform);
+    lse_graphics_draw_render_object(graphics, base->layer, LSE_COLOR_MAKE(255, 255, 255, 255));
+  } else {
+    release_layer(node, graphics);
+    composite_subtree(node, graphics, visible_rect, in_layer);
+  }
+
+  lse_graphics_pop_state(graphics);
+}
+
+// @private
+static void composite_subtree(lse_node* node, lse_graphics* graphics, const lse_rect_f* visible_rect, bool in_layer) {
+  lse_rect_f box = lse_node_get_box(node);
+  lse_rect_f bounds = get_target_bounds(graphics, &box);
+  int32_t occluder = lse_node_is_leaf(node) ? -1 : find_occluding_child(node, graphics, visible_rect);
+  lse_node* child;
+
+  lse_node_unset_flag(node, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_GROUP | LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+
+  // children are visited either way, as they can draw outside of this node's box. for the root, skipping
+  // on_composite skips the clear.
+  if (occluder < 0 && lse_rect_f_intersects(&bounds, visible_rect)) {
+    lse_node_on_composite(node, graphics);
+  } else {
+    ((lse_root_node*)lse_window_get_root(lse_node_get_base(node)->window))->culled_node_count++;
+  }
 
   if (!lse_node_is_leaf(node)) {
     uint32_t count = lse_node_get_child_count(node);
 
     for (uint32_t i = 0; i < count; i++) {
-      run_composite(lse_node_get_child_at(node, i), graphics);
+      child = lse_node_get_child_at(node, i);
+
+      // anything drawn before the occluder is painted over
+      if ((int32_t)i < occluder) {
+        cull_subtree(child, graphics);
+      } else {
+        run_composite(child, graphics, visible_rect, in_layer);
+      }
     }
   }
+}
 
-  lse_graphics_pop_state(graphics);
+// @private
+static int32_t find_occluding_child(lse_node* node, lse_graphics* graphics, const lse_rect_f* visible_rect) {
+  const lse_matrix* parent_matrix = lse_graphics_get_matrix(graphics);
+  lse_node* child;
+  lse_rect_f box;
+  lse_rect_f bounds;
+  lse_rect_f rect;
+  lse_matrix matrix;
+
+  // the opacity of this node and its ancestors applies to every child. if it is translucent, what is behind the
+  // children shows through.
+  if (lse_graphics_get_opacity(graphics) < 1.f) {
+    return -1;
+  }
+
+  // the last child whose opaque pixels cover the whole visible region hides this node and every earlier sibling
+  for (uint32_t i = lse_node_get_child_count(node); i-- > 0;) {
+    child = lse_node_get_child_at(node, i);
+
+    if (lse_style_resolve_opacity(lse_node_get_style_or_empty(child)) < 1.f) {
+      continue;
+    }
+
+    box = lse_node_get_box(child);
+    matrix = get_node_matrix(child, parent_matrix, &box);
+    bounds = lse_matrix_transform_bounds(&matrix, &(lse_rect_f){ 0, 0, box.width, box.height });
+
+    // off screen children, e.g. the items of a scrolled list, cannot cover anything and are not asked
+    if (!lse_rect_f_intersects(&bounds, visible_rect)) {
+      continue;
+    }
+
+    // a rotated opaque rect does not cover its axis aligned bounds
+    if (!lse_equals_f(lse_matrix_get_axis_angle(&matrix), 0) || !lse_node_get_opaque_rect(child, graphics, &rect)) {
+      continue;
+    }
+
+    rect = lse_matrix_transform_bounds(&matrix, &rect);
+    // only whole pixels are guaranteed to be covered after the backend snaps the draw to the pixel grid
+    rect = lse_rect_f_round_in(&rect);
+
+    if (lse_rect_f_contains(&rect, visible_rect)) {
+      return (int32_t)i;
+    }
+  }
+
+  return -1;
+}
+
+// @private
+static void cull_subtree(lse_node* node, lse_graphics* graphics) {
+  lse_root_node* root = (lse_root_node*)lse_window_get_root(lse_node_get_base(node)->window);
+  uint32_t count;
+
+  // the subtree is up to date as far as the screen is concerned
+  lse_node_unset_flag(node, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_GROUP | LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+  root->culled_node_count++;
+
+  // an invisible subtree does not hold layer memory, and has to animate on screen again before it is promoted
+  release_layer(node, graphics);
+  lse_node_get_base(node)->group_frames = 0;
+
+  if (!lse_node_is_leaf(node)) {
+    count = lse_node_get_child_count(node);
+
+    for (uint32_t i = 0; i < count; i++) {
+      cull_subtree(lse_node_get_child_at(node, i), graphics);
+    }
+  }
+}
+
+// @private
+static lse_rect_f get_target_bounds(lse_graphics* graphics, const lse_rect_f* box) {
+  // axis aligned bounds of the box in the space of the current render target (window or layer)
+  return lse_matrix_transform_bounds(lse_graphics_get_matrix(graphics), &(lse_rect_f){ 0, 0, box->width, box->height });
+}
+
+// @private
+static bool update_layer(lse_node* node, lse_graphics* graphics, const lse_rect_f* box, bool clip) {
+  lse_node_base* base = lse_node_get_base(node);
+  lse_root_node* root = (lse_root_node*)lse_window_get_root(base->window);
+  lse_rect_f bounds;
+  lse_matrix offset;
+  int64_t bytes;
+
+  // moving, transforming or fading the subtree reuses the texture. any change inside the subtree redraws it.
+  if (base->layer && !lse_node_has_flag(node, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_DESCENDANT_COMPOSITE)) {
+    lse_node_unset_flag(node, LSE_NODE_FLAG_GROUP);
+    root->layer_bytes += get_layer_bytes(&base->layer_bounds);
+    return true;
+  }
+
+  if (clip) {
+    bounds = (lse_rect_f){ 0, 0, box->width, box->height };
+  } else {
+    bounds = get_subtree_bounds(node, &k_identity);
+  }
+
+  bounds = lse_rect_f_round_out(&bounds);
+
+  if (lse_rect_f_is_empty(&bounds)
+      || bounds.width > (float)(lse_graphics_get_width(graphics) * LAYER_MAX_WINDOW_SCALE)
+      || bounds.height > (float)(lse_graphics_get_height(graphics) * LAYER_MAX_WINDOW_SCALE)) {
+    return false;
+  }
+
+  // reused layers are counted above. the first subtrees visited in the frame get the memory.
+  bytes = get_layer_bytes(&bounds);
+
+  if (root->layer_bytes + bytes > LAYER_MAX_BYTES) {
+    return false;
+  }
+
+  base->layer = lse_graphics_begin_layer(graphics, (int32_t)bounds.width, (int32_t)bounds.height, base->layer);
+
+  if (!base->layer) {
+    return false;
+  }
+
+  base->layer_bounds = bounds;
+  root->layer_bytes += bytes;
+
+  offset = lse_matrix_init_translate(-bounds.x, -bounds.y);
+  lse_graphics_set_matrix(graphics, &offset);
+
+  composite_subtree(node, graphics, &(lse_rect_f){ 0, 0, bounds.width, bounds.height }, true);
+
+  lse_graphics_end_layer(graphics);
+
+  return true;
+}
+
+// @private
+static bool should_use_layer(lse_node* node, lse_style* style) {
+  // a leaf is already drawn from a single surface
+  if (lse_node_is_leaf(node) || lse_node_get_child_count(node) == 0 || !lse_node_get_parent(node)) {
+    return false;
+  }
+
+  if (lse_style_get_enum(style, LSE_SP_WILL_CHANGE) != LSE_STYLE_WILL_CHANGE_AUTO) {
+    return true;
+  }
+
+  return lse_node_get_base(node)->group_frames >= LAYER_PROMOTE_FRAMES;
+}
+
+// @private
+static bool is_translation(const lse_matrix* matrix) {
+  return lse_equals_f(matrix->a, 1) && lse_equals_f(matrix->b, 0) && lse_equals_f(matrix->c, 0)
+         && lse_equals_f(matrix->d, 1);
+}
+
+// @private
+static int64_t get_layer_bytes(const lse_rect_f* bounds) {
+  return (int64_t)bounds->width * (int64_t)bounds->height * 4;
+}
+
+// @private
+static void drop_layer(lse_node* node) {
+  lse_node_base* base = lse_node_get_base(node);
+
+  // the texture contents are undefined. promoted subtrees get a new layer in the next composite.
+  lse_window_destroy_render_object(base->window, base->layer);
+  base->layer = NULL;
+}
+
+// @private
+static void release_layer(lse_node* node, lse_graphics* graphics) {
+  lse_node_base* base = lse_node_get_base(node);
+
+  if (base->layer) {
+    base->layer = lse_graphics_destroy_render_object(graphics, base->layer);
+  }
+}
+
+// @private
+static lse_rect_f get_subtree_bounds(lse_node* node, const lse_matrix* matrix) {
+  lse_style* style = lse_node_get_style_or_empty(node);
+  lse_rect_f box = lse_node_get_box(node);
+  lse_rect_f bounds = lse_matrix_transform_bounds(matrix, &(lse_rect_f){ 0, 0, box.width, box.height });
+  lse_rect_f child_bounds;
+  lse_matrix child_matrix;
+  lse_node* child;
+  uint32_t count;
+
+  // descendants of a clipping node cannot draw outside of its box
+  if (lse_node_is_leaf(node) || lse_style_get_enum(style, LSE_SP_OVERFLOW) == LSE_STYLE_OVERFLOW_HIDDEN) {
+    return bounds;
+  }
+
+  count = lse_node_get_child_count(node);
+
+  for (uint32_t i = 0; i < count; i++) {
+    child = lse_node_get_child_at(node, i);
+    box = lse_node_get_box(child);
+    child_matrix = get_node_matrix(child, matrix, &box);
+    child_bounds = get_subtree_bounds(child, &child_matrix);
+    bounds = lse_rect_f_union(&bounds, &child_bounds);
+  }
+
+  return bounds;
 }
 
 // ////////////////////////////////////////////////////////////////////////////
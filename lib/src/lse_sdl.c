@@ -108,6 +108,7 @@
   APPLY(SDL_DestroyWindow)                                                                                             \
   APPLY(SDL_SetWindowTitle)                                                                                            \
   APPLY(SDL_GetWindowDisplayMode)                                                                                      \
+  APPLY(SDL_GetWindowDisplayIndex)                                                                                     \
   APPLY(SDL_GetWindowFlags)                                                                                            \
   APPLY(SDL_ShowCursor)                                                                                                \
   APPLY(SDL_RWFromFile)                                                                                                \
@@ -124,7 +125,9 @@
   APPLY(SDL_RenderCopyF)                                                                                               \
   APPLY(SDL_RenderCopyExF)                                                                                             \
   APPLY(SDL_RenderFillRectsF)                                                                                          \
-  APPLY(SDL_RenderFillRectF)
+  APPLY(SDL_RenderFillRectF)                                                                                           \
+  APPLY(SDL_RenderGeometry)                                                                                            \
+  APPLY(SDL_RenderSetVSync)
 
 static void set_version_string(char* target, size_t target_size, Uint8 major, Uint8 minor, Uint8 patch);
 
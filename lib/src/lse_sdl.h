@@ -113,6 +113,7 @@ struct lse_sdl {
   void(SDLCALL *SDL_DestroyWindow)(SDL_Window *);
   void(SDLCALL *SDL_SetWindowTitle)(SDL_Window *, const char *);
   int(SDLCALL *SDL_GetWindowDisplayMode)(SDL_Window *, SDL_DisplayMode *);
+  int(SDLCALL *SDL_GetWindowDisplayIndex)(SDL_Window *);
   Uint32(SDLCALL *SDL_GetWindowFlags)(SDL_Window *);
   int(SDLCALL *SDL_ShowCursor)(int);
   SDL_RWops *(SDLCALL *SDL_RWFromFile)(const char *, const char *);
@@ -139,6 +140,8 @@ struct lse_sdl {
       const SDL_RendererFlip);
   int(SDLCALL *SDL_RenderFillRectsF)(SDL_Renderer *, const SDL_FRect *, int);
   int(SDLCALL *SDL_RenderFillRectF)(SDL_Renderer *, const SDL_FRect *);
+  int(SDLCALL *SDL_RenderGeometry)(SDL_Renderer *, SDL_Texture *, const SDL_Vertex *, int, const int *, int);
+  int(SDLCALL *SDL_RenderSetVSync)(SDL_Renderer *, int);
 
   lse_library lib;
 };
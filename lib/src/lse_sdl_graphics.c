@@ -13,43 +13,128 @@
 
 #include "lse_graphics.h"
 
-typedef struct SDL_Texture* sdl_texture_ptr;
+typedef struct sdl_image_texture sdl_image_texture;
+
+// image cache entry. entries are linked from most to least recently drawn, so the least recently drawn textures can
+// be evicted when the cache is over budget.
+struct sdl_image_texture {
+  lse_image* image;
+  // NULL while the pixels of an evicted image are decoded again
+  struct SDL_Texture* texture;
+  int64_t bytes;
+  uint64_t last_drawn_frame;
+  // window area the texture was last drawn to and the frame it was drawn in. with partial redraw, the texture is on
+  // screen until that area is redrawn.
+  lse_rect_f screen_rect;
+  uint64_t screen_frame;
+  sdl_image_texture* prev;
+  sdl_image_texture* next;
+};
+
+typedef sdl_image_texture* sdl_image_texture_ptr;
 #define i_tag image_cache
 #define i_key lse_image_ptr
-#define i_val sdl_texture_ptr
+#define i_val sdl_image_texture_ptr
 #define i_opt c_no_clone
 #include <stc/cmap.h>
 
 #include "lse_color.h"
 #include "lse_env.h"
 #include "lse_font.h"
+#include "lse_glyph_atlas.h"
 #include "lse_image.h"
 #include "lse_memory.h"
 #include "lse_object.h"
 #include "lse_rect.h"
 #include "lse_sdl.h"
 #include "lse_text.h"
+#include "lse_texture_pool.h"
 #include "lse_util.h"
 #include "nanoctx.h"
 
+#define GLYPH_ATLAS_PAGE_SIZE 512
+#define GLYPH_ATLAS_MAX_PAGES 8
+// atlases kept for (font, font size) pairs. unused atlases over the cap are released, least recently used first.
+#define GLYPH_ATLAS_MAX_COUNT 16
+// textures kept for reuse after render objects give them back
+#define TEXTURE_POOL_MAX_BYTES (32 * 1024 * 1024)
+
 typedef struct lse_sdl_graphics lse_sdl_graphics;
 typedef struct sdl_render_object sdl_render_object;
+typedef struct sdl_glyph_atlas sdl_glyph_atlas;
+typedef struct sdl_glyph_quad sdl_glyph_quad;
+typedef struct sdl_geometry_batch sdl_geometry_batch;
+
+struct sdl_glyph_atlas {
+  lse_glyph_atlas atlas;
+  SDL_Texture* pages[GLYPH_ATLAS_MAX_PAGES];
+  // text render objects with quads on the pages. a full atlas is only reset, and an atlas only released, when unused.
+  int32_t usages;
+  uint64_t last_used_frame;
+};
+
+typedef sdl_glyph_atlas* sdl_glyph_atlas_ptr;
+#define i_tag glyph_atlases
+#define i_val sdl_glyph_atlas_ptr
+#define i_opt c_no_clone | c_no_cmp
+#include <stc/cvec.h>
+
+struct sdl_glyph_quad {
+  SDL_Texture* texture;
+  SDL_Rect src_rect;
+  lse_rect_f dest_rect;
+  // the texture holds only this glyph and belongs to the quad, as the glyph did not fit in the atlas
+  bool owns_texture;
+};
+
+// consecutive quads that share a texture, submitted with a single SDL_RenderGeometry call
+struct sdl_geometry_batch {
+  SDL_Texture* texture;
+  SDL_BlendMode blend_mode;
+  float texture_width;
+  float texture_height;
+  // 4 vertices per quad
+  SDL_Vertex* vertices;
+  // 6 indices per quad. the index pattern is the same for every batch, so it is filled in when the buffer grows.
+  int* indices;
+  int32_t quad_count;
+  int32_t quad_capacity;
+};
 
 struct lse_sdl_graphics {
   lse_graphics_base base;
   SDL_Renderer* renderer;
   SDL_Texture* fill_texture;
   bool use_float_rects;
+  bool use_geometry_batch;
+  sdl_geometry_batch batch;
+  // texture of the layer being drawn, or NULL when drawing to the window
+  SDL_Texture* layer_target;
   cmap_image_cache image_cache;
+  sdl_image_texture* image_cache_head;
+  sdl_image_texture* image_cache_tail;
+  // incremented every frame, to find the image textures drawn in the current frame
+  uint64_t frame;
+  cvec_glyph_atlases glyph_atlases;
+  lse_texture_pool texture_pool;
 };
 
 struct sdl_render_object {
-  SDL_Texture* texture;
+  // borrowed from the texture pool. the texture can be larger than rect, so it is drawn with src_rect.
+  lse_pooled_texture texture;
   lse_image* image;
   lse_rect_f rect;
   SDL_Rect src_rect;
   bool has_src_rect;
   bool can_tint;
+  // every pixel in rect is fully opaque, so the object can be drawn without blending when the draw color is opaque
+  bool is_opaque;
+  // text is drawn as a list of glyph quads from a shared glyph atlas, rather than from a texture owned by this object
+  sdl_glyph_quad* quads;
+  int32_t quad_count;
+  int32_t quad_capacity;
+  // atlas the quads were laid out from, holding a usage
+  sdl_glyph_atlas* atlas;
 };
 
 static lse_render_object* sdl_render_object_drop(sdl_render_object* current, lse_sdl_graphics* sdl_graphics);
@@ -75,22 +160,96 @@ static void render_stroke_rect(lse_sdl_graphics* self, lse_render_command* comma
 static void render_texture(lse_sdl_graphics* self, lse_render_command* command);
 
 static bool sw_render_rounded_rect(lse_sdl_graphics* self, lse_render_command* command, SDL_Texture* target);
-static bool sw_render_text(
+
+static sdl_glyph_atlas* get_glyph_atlas(lse_sdl_graphics* self, lse_font* font, float font_size);
+static const lse_atlas_glyph* get_atlas_glyph(lse_sdl_graphics* self, sdl_glyph_atlas* atlas, uint32_t codepoint);
+static bool upload_glyph(
     lse_sdl_graphics* self,
+    sdl_glyph_atlas* atlas,
+    const lse_atlas_glyph* glyph,
+    const lse_glyph_surface* glyph_surface);
+static void sdl_glyph_atlas_release(lse_sdl_graphics* self, sdl_glyph_atlas* atlas, bool destroy_textures);
+static void sdl_glyph_atlas_reset(lse_sdl_graphics* self, sdl_glyph_atlas* atlas);
+static void evict_glyph_atlases(lse_sdl_graphics* self);
+static bool push_standalone_glyph_quad(
+    lse_sdl_graphics* self,
+    sdl_render_object* sro,
+    lse_font* font,
+    uint32_t codepoint,
+    float x,
+    float y,
+    float width,
+    float height);
+static uint32_t* expand_glyph_pixels(const lse_glyph_surface* glyph_surface);
+static void release_glyph_quads(lse_sdl_graphics* self, sdl_render_object* sro);
+static bool layout_text_quads(
+    lse_sdl_graphics* self,
+    sdl_glyph_atlas* atlas,
     lse_render_command* command,
-    SDL_Texture* target,
-    int32_t target_width,
-    int32_t target_height);
-static void
-sw_render_text_line(lse_surface* dest, float x, float y, lse_text_style* text_style, lse_text_line_info* metrics);
-static void sw_copy_alpha_buffer(int32_t x, int32_t y, const lse_glyph_surface* glyph, const lse_surface* dest);
-
-static void cmap_image_cache_release(lse_sdl* sdl, cmap_image_cache_value* entry, bool destroy_texture);
+    sdl_render_object* sro,
+    float width,
+    float height);
+static void layout_text_line_quads(
+    lse_sdl_graphics* self,
+    sdl_glyph_atlas* atlas,
+    sdl_render_object* sro,
+    float x,
+    float y,
+    lse_text_layout* layout,
+    const lse_text_layout_line* line,
+    float width,
+    float height);
+static void push_glyph_quad(
+    sdl_render_object* sro,
+    SDL_Texture* page,
+    const lse_atlas_glyph* glyph,
+    int32_t x,
+    int32_t y,
+    float width,
+    float height);
+static void draw_glyph_quads(
+    lse_sdl_graphics* self,
+    sdl_render_object* sro,
+    const lse_matrix* m,
+    float angle,
+    lse_color color);
+static lse_color get_draw_color(lse_graphics* graphics, sdl_render_object* sro, lse_color color);
+
+static void batch_quad(
+    lse_sdl_graphics* self,
+    SDL_Texture* texture,
+    SDL_BlendMode blend_mode,
+    const SDL_Rect* src_rect,
+    const SDL_FRect* dest,
+    float angle,
+    const SDL_FPoint* pivot,
+    lse_color color);
+static void flush_batch(lse_sdl_graphics* self);
+static void grow_batch(sdl_geometry_batch* batch);
+
+static void* texture_pool_create(void* user_data, int32_t access, int32_t width, int32_t height);
+static void texture_pool_destroy(void* user_data, void* texture);
+static void release_pooled_texture(lse_sdl_graphics* self, sdl_render_object* sro);
+
+static sdl_image_texture* image_cache_insert(lse_sdl_graphics* self, lse_image* image);
+static void image_cache_erase(lse_sdl_graphics* self, sdl_image_texture* entry, bool free_texture);
+static void image_cache_evict(lse_sdl_graphics* self, int64_t budget);
+static void image_cache_unlink(lse_sdl_graphics* self, sdl_image_texture* entry);
+static void image_cache_link_front(lse_sdl_graphics* self, sdl_image_texture* entry);
+static void image_cache_set_screen_rect(lse_sdl_graphics* self, lse_image* image, const lse_rect_f* rect);
+static bool image_cache_is_on_screen(lse_sdl_graphics* self, sdl_image_texture* entry);
+static bool has_opaque_texture(lse_sdl_graphics* self, lse_image* image);
 static SDL_Texture* get_texture(lse_sdl_graphics* self, lse_image* image);
+static SDL_Rect to_pixel_src_rect(lse_image* image, const lse_rect* src_rect);
 
-static SDL_Texture*
-ensure_texture(lse_sdl_graphics* self, SDL_Texture* texture, int32_t access, int32_t width, int32_t height);
+static SDL_Texture* create_texture(lse_sdl_graphics* self, int32_t access, int32_t width, int32_t height);
+static bool
+update_texture(lse_sdl_graphics* self, SDL_Texture* texture, const SDL_Rect* rect, const void* pixels, int32_t pitch);
+static void destroy_texture(lse_sdl_graphics* self, SDL_Texture* texture);
 static bool has_texture_format(lse_sdl* sdl, SDL_Renderer* renderer, Uint32 desired_format);
+static void set_render_target(lse_sdl_graphics* self, SDL_Texture* texture);
+static void set_texture_color(lse_sdl_graphics* self, SDL_Texture* texture, lse_color color);
+static void set_clip_rect_from_state(lse_sdl_graphics* self);
 
 #define INITIAL_IMAGE_CACHE_CAPACITY 32
 #define LSE_TEXTURE_FORMAT LSE_COLOR_FORMAT_RGBA
@@ -108,6 +267,8 @@ static void constructor(lse_object* object, void* arg) {
 
   lse_graphics_base_constructor(graphics, arg);
   self->image_cache = cmap_image_cache_with_capacity(INITIAL_IMAGE_CACHE_CAPACITY);
+  self->glyph_atlases = cvec_glyph_atlases_init();
+  self->texture_pool = lse_texture_pool_init(&texture_pool_create, &texture_pool_destroy, self, TEXTURE_POOL_MAX_BYTES);
 }
 
 // @override
@@ -117,6 +278,10 @@ static void destructor(lse_object* object) {
 
   lse_graphics_base_destructor(graphics);
   cmap_image_cache_drop(&self->image_cache);
+  cvec_glyph_atlases_drop(&self->glyph_atlases);
+  lse_texture_pool_drop(&self->texture_pool);
+  free(self->batch.vertices);
+  free(self->batch.indices);
 }
 
 // @override
@@ -130,6 +295,9 @@ static lse_status configure(lse_graphics* graphics, void* arg) {
   SDL_Window* window = arg;
   SDL_Renderer* renderer = NULL;
   SDL_Texture* fill_texture = NULL;
+  SDL_RendererInfo renderer_info;
+  SDL_DisplayMode display_mode;
+  Uint32 renderer_flags = SDL_RENDERER_ACCELERATED | SDL_RENDERER_TARGETTEXTURE;
 
   if (self->renderer) {
     return LSE_ERR_ALREADY_CONFIGURED;
@@ -139,8 +307,11 @@ static lse_status configure(lse_graphics* graphics, void* arg) {
   // create renderer
   //
 
-  renderer = sdl->SDL_CreateRenderer(
-      window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE);
+  if (self->base.env->render_settings.vsync != LSE_VSYNC_MODE_OFF) {
+    renderer_flags |= SDL_RENDERER_PRESENTVSYNC;
+  }
+
+  renderer = sdl->SDL_CreateRenderer(window, -1, renderer_flags);
 
   if (!renderer) {
     LSE_LOG_SDL_ERROR(sdl, "SDL_CreateRenderer");
@@ -149,6 +320,22 @@ static lse_status configure(lse_graphics* graphics, void* arg) {
 
   sdl->SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
+  //
+  // frame pacing info: the driver may not honor the vsync request
+  //
+
+  if (sdl->SDL_GetRendererInfo(renderer, &renderer_info) == 0) {
+    self->base.is_vsync_enabled = (renderer_info.flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+  } else {
+    self->base.is_vsync_enabled = (renderer_flags & SDL_RENDERER_PRESENTVSYNC) != 0;
+  }
+
+  self->base.can_set_vsync = sdl->SDL_RenderSetVSync != NULL;
+
+  if (sdl->SDL_GetCurrentDisplayMode(sdl->SDL_GetWindowDisplayIndex(window), &display_mode) == 0) {
+    self->base.refresh_rate = display_mode.refresh_rate;
+  }
+
   //
   // check the texture format
   //
@@ -176,26 +363,30 @@ static lse_status configure(lse_graphics* graphics, void* arg) {
 
   self->renderer = renderer;
 
-  fill_texture = ensure_texture(self, NULL, SDL_TEXTUREACCESS_STATIC, 1, 1);
+  fill_texture = create_texture(self, SDL_TEXTUREACCESS_STATIC, 1, 1);
 
   if (!fill_texture) {
     LSE_LOG_SDL_ERROR(sdl, "SDL_CreateTexture");
     goto ERROR;
   }
 
-  if (sdl->SDL_UpdateTexture(fill_texture, NULL, (uint8_t*)&(uint32_t){ 0xFFFFFFFF }, 4) != 0) {
+  if (!update_texture(self, fill_texture, NULL, (uint8_t*)&(uint32_t){ 0xFFFFFFFF }, 4)) {
     LSE_LOG_SDL_ERROR(sdl, "SDL_UpdateTexture");
     goto ERROR;
   }
 
   self->fill_texture = fill_texture;
   self->use_float_rects = sdl->SDL_RenderCopyF != NULL;
+  // SDL_RenderGeometry was added in 2.0.18. older versions draw each render object with SDL_RenderCopyEx.
+  self->use_geometry_batch = sdl->SDL_RenderGeometry != NULL && self->base.env->render_settings.batch_geometry;
+
+  LSE_LOG_INFO("geometry batching: %s", self->use_geometry_batch ? "enabled" : "disabled");
 
   return LSE_OK;
 
 ERROR:
   if (fill_texture) {
-    sdl->SDL_DestroyTexture(fill_texture);
+    destroy_texture(self, fill_texture);
   }
 
   if (renderer) {
@@ -210,18 +401,31 @@ ERROR:
 static void destroy(lse_graphics* graphics) {
   lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
   lse_sdl* sdl = lse_get_sdl_from_base(self);
+  const lse_texture_pool_stats* stats;
 
   if (lse_graphics_is_destroyed(graphics)) {
     return;
   }
 
-  c_foreach(i, cmap_image_cache, self->image_cache) {
-    cmap_image_cache_release(sdl, i.ref, self->renderer != NULL);
+  while (self->image_cache_head) {
+    image_cache_erase(self, self->image_cache_head, self->renderer != NULL);
   }
-  cmap_image_cache_clear(&self->image_cache);
+
+  c_foreach(i, cvec_glyph_atlases, self->glyph_atlases) {
+    sdl_glyph_atlas_release(self, *i.ref, self->renderer != NULL);
+  }
+  cvec_glyph_atlases_clear(&self->glyph_atlases);
+
+  stats = lse_texture_pool_get_stats(&self->texture_pool);
+  LSE_LOG_DEBUG(
+      "texture pool: %llu hits, %llu misses, %lld resident bytes",
+      (unsigned long long)stats->hits,
+      (unsigned long long)stats->misses,
+      (long long)stats->resident_bytes);
+  lse_texture_pool_drop(&self->texture_pool);
 
   if (self->renderer) {
-    sdl->SDL_DestroyTexture(self->fill_texture);
+    destroy_texture(self, self->fill_texture);
     self->fill_texture = NULL;
 
     sdl->SDL_DestroyRenderer(self->renderer);
@@ -244,16 +448,14 @@ static void push_state(lse_graphics* graphics) {
 // @override
 static void pop_state(lse_graphics* graphics) {
   bool had_clip_rect;
-  const lse_graphics_state* current;
   lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
-  lse_sdl* sdl = lse_get_sdl_from_base(self);
 
   had_clip_rect = lse_graphics_base_get_state(graphics)->has_clip_rect;
   lse_graphics_base_pop_state(graphics);
 
   if (had_clip_rect) {
-    current = lse_graphics_base_get_state(graphics);
-    sdl->SDL_RenderSetClipRect(self->renderer, current ? (const SDL_Rect*)&current->clip_rect : NULL);
+    flush_batch(self);
+    set_clip_rect_from_state(self);
   }
 }
 
@@ -278,22 +480,34 @@ static void set_clip_rect(lse_graphics* graphics, lse_rect_f* rect) {
   lse_sdl* sdl = lse_get_sdl_from_base(self);
   const lse_rect* clip_rect;
 
+  flush_batch(self);
+
   lse_graphics_base_set_clip_rect(graphics, rect);
   clip_rect = lse_graphics_base_get_clip_rect(graphics);
 
   sdl->SDL_RenderSetClipRect(self->renderer, (const SDL_Rect*)clip_rect);
+  lse_graphics_add_render_stat(self, clip_rect_changes, 1);
 }
 
 // @override
 static void begin(lse_graphics* graphics) {
+  ((lse_sdl_graphics*)graphics)->frame++;
 }
 
 // @override
 static void end(lse_graphics* graphics) {
   lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
   lse_sdl* sdl = lse_get_sdl_from_base(self);
+  double start;
+
+  flush_batch(self);
 
+  start = lse_get_time_ms();
   sdl->SDL_RenderPresent(self->renderer);
+  lse_frame_timing_mark(&self->base.env->frame_timing, LSE_FRAME_PHASE_PRESENT, start);
+
+  // after present, so no pending draw references an evicted texture
+  image_cache_evict(self, self->base.env->render_settings.image_cache_budget);
 
   lse_graphics_base_end(graphics);
 }
@@ -302,19 +516,49 @@ static void end(lse_graphics* graphics) {
 static void clear(lse_graphics* graphics, lse_color color) {
   lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
   lse_sdl* sdl = lse_get_sdl_from_base(self);
+  const lse_rect* clip_rect = lse_graphics_base_get_clip_rect(graphics);
+
+  flush_batch(self);
+  lse_graphics_add_render_stat(self, draw_calls, 1);
 
   sdl->SDL_SetRenderDrawColor(self->renderer, color.comp.r, color.comp.g, color.comp.b, color.comp.a);
-  sdl->SDL_RenderClear(self->renderer);
+
+  if (lse_rect_is_empty(clip_rect)) {
+    sdl->SDL_RenderClear(self->renderer);
+  } else {
+    // SDL_RenderClear ignores the clip rect. partial redraw depends on clear staying inside the clip rect.
+    sdl->SDL_SetRenderDrawBlendMode(self->renderer, SDL_BLENDMODE_NONE);
+    sdl->SDL_RenderFillRect(self->renderer, (const SDL_Rect*)clip_rect);
+    sdl->SDL_SetRenderDrawBlendMode(self->renderer, SDL_BLENDMODE_BLEND);
+  }
+}
+
+// @override
+static void set_vsync(lse_graphics* graphics, bool enabled) {
+  lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
+  lse_sdl* sdl = lse_get_sdl_from_base(self);
+
+  if (!self->renderer || !self->base.can_set_vsync || self->base.is_vsync_enabled == enabled) {
+    return;
+  }
+
+  if (sdl->SDL_RenderSetVSync(self->renderer, enabled ? 1 : 0) != 0) {
+    LSE_LOG_SDL_ERROR(sdl, "SDL_RenderSetVSync");
+    return;
+  }
+
+  self->base.is_vsync_enabled = enabled;
 }
 
 // @override
 static void remove_image(lse_graphics* graphics, lse_image* image) {
   lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
-  cmap_image_cache_value* value = cmap_image_cache_get_mut(&self->image_cache, image);
+  const cmap_image_cache_value* value = cmap_image_cache_get(&self->image_cache, image);
 
   if (value) {
-    cmap_image_cache_release(lse_get_sdl_from_base(self), value, true);
-    cmap_image_cache_erase(&self->image_cache, image);
+    // the texture may be referenced by pending batched draws
+    flush_batch(self);
+    image_cache_erase(self, value->second, true);
   }
 }
 
@@ -355,36 +599,80 @@ static void draw_render_object(lse_graphics* graphics, lse_render_object* render
   sdl_render_object* sro = (sdl_render_object*)render_object;
   lse_sdl* sdl = lse_get_sdl_from_base(self);
   SDL_Texture* texture;
+  SDL_BlendMode blend_mode;
   const lse_matrix* m = lse_graphics_get_matrix(graphics);
   lse_matrix temp;
   float angle;
 
+  color = get_draw_color(graphics, sro, color);
+
+  if (color.comp.a == 0) {
+    return;
+  }
+
+  angle = lse_matrix_get_axis_angle(m);
+
+  if (!lse_equals_f(angle, 0)) {
+    temp = lse_matrix_init_rotate(-angle);
+    lse_matrix_multiply(m, &temp, &temp);
+    m = &temp;
+  }
+
+  if (sro->quads) {
+    draw_glyph_quads(self, sro, m, angle, color);
+    return;
+  }
+
   if (sro->image) {
     texture = get_texture(self, sro->image);
     if (!texture) {
       return;
     }
-  } else if (sro->texture) {
-    texture = sro->texture;
+  } else if (sro->texture.handle) {
+    texture = sro->texture.handle;
   } else {
     texture = self->fill_texture;
   }
 
-  if (!sro->can_tint) {
-    color.value = 0xFFFFFFFF;
+  if (sro->image && !self->layer_target) {
+    image_cache_set_screen_rect(
+        self,
+        sro->image,
+        &(lse_rect_f){
+            .x = sro->rect.x + lse_matrix_get_translate_x(m),
+            .y = sro->rect.y + lse_matrix_get_translate_y(m),
+            .width = sro->rect.width * lse_matrix_get_scale_x(m),
+            .height = sro->rect.height * lse_matrix_get_scale_y(m),
+        });
   }
 
-  sdl->SDL_SetTextureColorMod(texture, color.comp.r, color.comp.g, color.comp.b);
-  sdl->SDL_SetTextureAlphaMod(texture, color.comp.a);
+  // opaque content drawn at full alpha overwrites the target, so blending (a read of the target per pixel) is skipped
+  blend_mode = sro->is_opaque && color.comp.a == 255 ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND;
 
-  angle = lse_matrix_get_axis_angle(m);
+  if (self->use_geometry_batch) {
+    SDL_FRect dest = {
+      .x = sro->rect.x + lse_matrix_get_translate_x(m),
+      .y = sro->rect.y + lse_matrix_get_translate_y(m),
+      .w = sro->rect.width * lse_matrix_get_scale_x(m),
+      .h = sro->rect.height * lse_matrix_get_scale_y(m),
+    };
 
-  if (!lse_equals_f(angle, 0)) {
-    temp = lse_matrix_init_rotate(-angle);
-    lse_matrix_multiply(m, &temp, &temp);
-    m = &temp;
+    batch_quad(
+        self,
+        texture,
+        blend_mode,
+        sro->has_src_rect ? &sro->src_rect : NULL,
+        &dest,
+        angle,
+        &(SDL_FPoint){ dest.x, dest.y },
+        color);
+    return;
   }
 
+  set_texture_color(self, texture, color);
+  sdl->SDL_SetTextureBlendMode(texture, blend_mode);
+  lse_graphics_add_render_stat(self, draw_calls, 1);
+
   if (self->use_float_rects) {
     SDL_FRect dest = {
       // TODO: snap to pixel grid?
@@ -422,8 +710,33 @@ static void draw_render_object(lse_graphics* graphics, lse_render_object* render
   }
 }
 
+// @override
+static bool
+get_opaque_rect(lse_graphics* graphics, lse_render_object* render_object, lse_color color, lse_rect_f* rect) {
+  lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
+  sdl_render_object* sro = (sdl_render_object*)render_object;
+
+  // mirrors draw_render_object, which skips blending under the same conditions
+  if (!sro || !sro->is_opaque || get_draw_color(graphics, sro, color).comp.a != 255) {
+    return false;
+  }
+
+  // an image without a texture draws nothing. the cache is only peeked at: occlusion tests run on nodes that may not
+  // be drawn this frame, so they must not upload, reload or touch the lru order.
+  if (sro->image && !has_opaque_texture(self, sro->image)) {
+    return false;
+  }
+
+  *rect = sro->rect;
+
+  return true;
+}
+
 // @override
 static lse_render_object* destroy_render_object(lse_graphics* graphics, lse_render_object* render_object) {
+  // the render object texture may be referenced by pending batched draws
+  flush_batch((lse_sdl_graphics*)graphics);
+
   return sdl_render_object_drop((sdl_render_object*)render_object, (lse_sdl_graphics*)graphics);
 }
 
@@ -436,6 +749,9 @@ end_queue(lse_graphics* graphics, int32_t width, int32_t height, lse_render_obje
   lse_render_command* command;
   sdl_render_object* sro = (sdl_render_object*)render_object;
 
+  // pending draws target the current render target and may reference the texture of render_object
+  flush_batch(self);
+
   if (!size) {
     return sdl_render_object_drop(sro, self);
   }
@@ -464,13 +780,17 @@ end_queue(lse_graphics* graphics, int32_t width, int32_t height, lse_render_obje
   }
 
   sro->rect = (lse_rect_f){ 0, 0, (float)width, (float)height };
-  sro->has_src_rect = false;
+  sro->src_rect = (SDL_Rect){ 0, 0, width, height };
+  sro->has_src_rect = true;
   sro->can_tint = false;
 
-  if (sdl->SDL_SetRenderTarget(self->renderer, sro->texture) != 0) {
+  if (sdl->SDL_SetRenderTarget(self->renderer, sro->texture.handle) != 0) {
     return sdl_render_object_drop(sro, self);
   }
 
+  lse_graphics_add_render_stat(self, render_target_changes, 1);
+
+  // clears the whole texture, so the unused area of a bucket sized texture does not bleed into the content
   sdl->SDL_SetRenderDrawColor(self->renderer, 0, 0, 0, 0);
   sdl->SDL_RenderClear(self->renderer);
 
@@ -491,14 +811,71 @@ end_queue(lse_graphics* graphics, int32_t width, int32_t height, lse_render_obje
     }
   }
 
-  sdl->SDL_SetRenderTarget(self->renderer, NULL);
+  set_render_target(self, self->layer_target);
+
+  return (lse_render_object*)sro;
+}
+
+// @override
+static lse_render_object*
+begin_layer(lse_graphics* graphics, int32_t width, int32_t height, lse_render_object* render_object) {
+  lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
+  lse_sdl* sdl = lse_get_sdl_from_base(self);
+  sdl_render_object* sro = (sdl_render_object*)render_object;
+
+  assert(self->layer_target == NULL && "layers do not nest");
+
+  // pending draws belong to the current target and may reference the texture of render_object
+  flush_batch(self);
+
+  sro = sdl_render_object_init_as_target(sro, self, SDL_TEXTUREACCESS_TARGET, width, height);
+
+  if (!sro) {
+    return (lse_render_object*)sro;
+  }
+
+  sro->rect = (lse_rect_f){ 0, 0, (float)width, (float)height };
+  sro->src_rect = (SDL_Rect){ 0, 0, width, height };
+  sro->has_src_rect = true;
+  sro->can_tint = false;
+
+  if (sdl->SDL_SetRenderTarget(self->renderer, sro->texture.handle) != 0) {
+    return sdl_render_object_drop(sro, self);
+  }
+
+  lse_graphics_add_render_stat(self, render_target_changes, 1);
+
+  sdl->SDL_SetRenderDrawColor(self->renderer, 0, 0, 0, 0);
+  sdl->SDL_RenderClear(self->renderer);
+  lse_graphics_add_render_stat(self, draw_calls, 1);
+
+  self->layer_target = sro->texture.handle;
+  lse_graphics_base_push_layer_state(graphics);
 
   return (lse_render_object*)sro;
 }
 
+// @override
+static void end_layer(lse_graphics* graphics) {
+  lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
+
+  flush_batch(self);
+
+  set_render_target(self, NULL);
+  self->layer_target = NULL;
+
+  lse_graphics_base_pop_state(graphics);
+  set_clip_rect_from_state(self);
+}
+
 // @private
 static void render_fill_rect(lse_sdl_graphics* self, lse_render_command* command) {
   lse_sdl* sdl = lse_get_sdl_from_base(self);
+  bool is_opaque = command->fill_color.comp.a == 255;
+
+  if (is_opaque) {
+    sdl->SDL_SetRenderDrawBlendMode(self->renderer, SDL_BLENDMODE_NONE);
+  }
 
   sdl->SDL_SetRenderDrawColor(
       self->renderer,
@@ -526,6 +903,18 @@ static void render_fill_rect(lse_sdl_graphics* self, lse_render_command* command
             .h = (int32_t)command->rect->height,
         });
   }
+
+  if (is_opaque) {
+    sdl->SDL_SetRenderDrawBlendMode(self->renderer, SDL_BLENDMODE_BLEND);
+  }
+}
+
+// @private
+static bool has_opaque_texture(lse_sdl_graphics* self, lse_image* image) {
+  const cmap_image_cache_value* value = cmap_image_cache_get(&self->image_cache, image);
+
+  // the image may have been reloaded with different pixels since the render object was created
+  return value && value->second->texture && lse_image_is_opaque(image);
 }
 
 // private
@@ -535,20 +924,41 @@ static SDL_Texture* get_texture(lse_sdl_graphics* self, lse_image* image) {
   int32_t height;
   SDL_Texture* texture;
   const cmap_image_cache_value* value = cmap_image_cache_get(&self->image_cache, image);
+  sdl_image_texture* entry = value ? value->second : NULL;
 
-  if (value) {
-    return value->second;
+  if (entry) {
+    entry->last_drawn_frame = self->frame;
+
+    if (entry != self->image_cache_head) {
+      image_cache_unlink(self, entry);
+      image_cache_link_front(self, entry);
+    }
+
+    if (entry->texture) {
+      return entry->texture;
+    }
+  }
+
+  if (!lse_image_is_ready(image)) {
+    return NULL;
   }
 
   pixels = lse_image_get_pixels(image);
-  width = lse_image_get_width(image);
-  height = lse_image_get_height(image);
 
-  if (!pixels || !lse_image_is_ready(image)) {
+  if (!pixels) {
+    // the pixels may have been released after upload, so an evicted texture is uploaded again after the image is
+    // decoded again. the entry without a texture marks the reload as requested.
+    if (!entry) {
+      image_cache_insert(self, image);
+      lse_graphics_base_reload_image((lse_graphics*)self, image);
+    }
+
     return NULL;
   }
 
-  texture = ensure_texture(self, NULL, SDL_TEXTUREACCESS_STATIC, width, height);
+  width = lse_image_get_pixel_width(image);
+  height = lse_image_get_pixel_height(image);
+  texture = create_texture(self, SDL_TEXTUREACCESS_STATIC, width, height);
 
   if (!texture) {
     return NULL;
@@ -556,49 +966,164 @@ static SDL_Texture* get_texture(lse_sdl_graphics* self, lse_image* image) {
 
   lse_color_to_format(pixels, width * height, LSE_TEXTURE_FORMAT);
 
-  if (lse_get_sdl_from_base(self)->SDL_UpdateTexture(texture, NULL, pixels, width * 4) == 0) {
-    lse_ref(image);
-    cmap_image_cache_insert(&self->image_cache, image, texture);
+  if (update_texture(self, texture, NULL, pixels, width * 4)) {
+    entry = entry ? entry : image_cache_insert(self, image);
+    entry->texture = texture;
+    entry->bytes = (int64_t)width * height * 4;
+    lse_graphics_add_render_stat(self, image_cache_count, 1);
+    lse_graphics_add_render_stat(self, image_cache_bytes, entry->bytes);
   } else {
-    lse_get_sdl_from_base(self)->SDL_DestroyTexture(texture);
+    destroy_texture(self, texture);
+    texture = NULL;
   }
 
-  lse_image_release_pixels(image);
+  lse_graphics_base_image_uploaded((lse_graphics*)self, image);
 
   return texture;
 }
 
 // @private
-static void cmap_image_cache_release(lse_sdl* sdl, cmap_image_cache_value* entry, bool destroy_texture) {
-  lse_unref(entry->first);
+static sdl_image_texture* image_cache_insert(lse_sdl_graphics* self, lse_image* image) {
+  sdl_image_texture* entry = lse_calloc(1, sizeof(sdl_image_texture));
+
+  entry->image = image;
+  entry->last_drawn_frame = self->frame;
+  lse_ref(image);
+
+  cmap_image_cache_insert(&self->image_cache, image, entry);
+  image_cache_link_front(self, entry);
+
+  return entry;
+}
+
+// @private
+static void image_cache_erase(lse_sdl_graphics* self, sdl_image_texture* entry, bool free_texture) {
+  image_cache_unlink(self, entry);
+  cmap_image_cache_erase(&self->image_cache, entry->image);
+
+  if (entry->texture) {
+    lse_graphics_add_render_stat(self, image_cache_count, -1);
+    lse_graphics_add_render_stat(self, image_cache_bytes, -entry->bytes);
+
+    if (free_texture) {
+      destroy_texture(self, entry->texture);
+    }
+  }
+
+  lse_unref(entry->image);
+  free(entry);
+}
+
+// @private
+static void image_cache_evict(lse_sdl_graphics* self, int64_t budget) {
+  sdl_image_texture* entry;
+  sdl_image_texture* prev;
+
+  if (budget <= 0) {
+    return;
+  }
+
+  // textures drawn in the current frame are still in use. entries are ordered by frame, so the walk stops at the first
+  // one. older textures still shown outside of the redrawn area are skipped.
+  entry = self->image_cache_tail;
+
+  while (self->base.total_stats.image_cache_bytes > budget && entry && entry->last_drawn_frame != self->frame) {
+    prev = entry->prev;
+
+    if (!image_cache_is_on_screen(self, entry)) {
+      if (entry->texture) {
+        lse_graphics_add_render_stat(self, image_cache_evictions, 1);
+      }
+
+      image_cache_erase(self, entry, true);
+    }
+
+    entry = prev;
+  }
+}
+
+// @private
+static void image_cache_set_screen_rect(lse_sdl_graphics* self, lse_image* image, const lse_rect_f* rect) {
+  const cmap_image_cache_value* value = cmap_image_cache_get(&self->image_cache, image);
+  sdl_image_texture* entry = value ? value->second : NULL;
+
+  if (!entry) {
+    return;
+  }
+
+  // an image drawn more than once in a frame is on screen in all of the places
+  if (entry->screen_frame == self->frame) {
+    entry->screen_rect = lse_rect_f_union(&entry->screen_rect, rect);
+  } else {
+    entry->screen_rect = *rect;
+    entry->screen_frame = self->frame;
+  }
+}
+
+// @private
+static bool image_cache_is_on_screen(lse_sdl_graphics* self, sdl_image_texture* entry) {
+  lse_rect_f visible_rect = lse_rect_f_intersect(&entry->screen_rect, &self->base.viewport);
+
+  // once its area is redrawn without it, the texture is no longer on screen
+  return !lse_rect_f_is_empty(&visible_rect) && !lse_rect_f_contains(&self->base.redraw_rect, &visible_rect);
+}
+
+// @private
+static void image_cache_unlink(lse_sdl_graphics* self, sdl_image_texture* entry) {
+  if (entry->prev) {
+    entry->prev->next = entry->next;
+  } else {
+    self->image_cache_head = entry->next;
+  }
+
+  if (entry->next) {
+    entry->next->prev = entry->prev;
+  } else {
+    self->image_cache_tail = entry->prev;
+  }
+
+  entry->prev = entry->next = NULL;
+}
+
+// @private
+static void image_cache_link_front(lse_sdl_graphics* self, sdl_image_texture* entry) {
+  entry->prev = NULL;
+  entry->next = self->image_cache_head;
 
-  if (destroy_texture) {
-    sdl->SDL_DestroyTexture(entry->second);
+  if (self->image_cache_head) {
+    self->image_cache_head->prev = entry;
+  } else {
+    self->image_cache_tail = entry;
   }
+
+  self->image_cache_head = entry;
 }
 
 // @private
 static void render_texture(lse_sdl_graphics* self, lse_render_command* command) {
   lse_sdl* sdl = lse_get_sdl_from_base(self);
   SDL_Texture* texture = get_texture(self, command->image);
+  SDL_Rect src_rect;
 
   if (!texture) {
     return;
   }
 
+  src_rect = to_pixel_src_rect(command->image, command->src_rect);
+
   // TODO: get color from filter, use opacity
-  sdl->SDL_SetTextureColorMod(texture, 0xFF, 0xFF, 0xFF /*filter.tint.r, filter.tint.g, filter.tint.b*/);
-  sdl->SDL_SetTextureAlphaMod(texture, 0xFF /*filter.tint.a*/);
+  set_texture_color(self, texture, (lse_color){ .value = 0xFFFFFFFF });
+  sdl->SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
 
   if (self->use_float_rects) {
     // TODO: snap to pixel grid
-    sdl->SDL_RenderCopyF(self->renderer, texture, (SDL_Rect*)command->src_rect, (SDL_FRect*)command->rect);
+    sdl->SDL_RenderCopyF(self->renderer, texture, &src_rect, (SDL_FRect*)command->rect);
   } else {
     // TODO: snap to pixel grid
     sdl->SDL_RenderCopy(
         self->renderer,
         texture,
-        (SDL_Rect*)command->src_rect,
+        &src_rect,
         &(SDL_Rect){
             (int32_t)command->rect->x,
             (int32_t)command->rect->y,
@@ -718,134 +1243,73 @@ static bool sw_render_rounded_rect(lse_sdl_graphics* self, lse_render_command* c
 
   nctx_render_shape(ctx);
   lse_color_to_format((lse_color*)pixels, width * height, LSE_TEXTURE_FORMAT);
-  result = lse_get_sdl_from_base(self)->SDL_UpdateTexture(target, NULL, pixels, pitch) == 0;
+  result = update_texture(self, target, &(SDL_Rect){ 0, 0, width, height }, pixels, pitch);
 
 DONE:
   free(pixels);
   return result;
 }
 
-static bool sw_render_text(
-    lse_sdl_graphics* self,
-    lse_render_command* command,
-    SDL_Texture* target,
-    int32_t target_width,
-    int32_t target_height) {
-  lse_font* font = command->text_style->font;
-  float line_height;
-  float x = 0;
-  float y = 0;
-  bool result;
-  const char* cursor = lse_string_as_cstring(command->text);
-  lse_text_line_info line_metrics;
-  lse_surface dest = {
-    .width = target_width,
-    .height = target_height,
-    .buffer = lse_calloc(target_width * target_height, sizeof(lse_color)),
-    .pitch = target_width * (int32_t)sizeof(lse_color),
-  };
-  int32_t max_lines = command->text_style->max_lines;
-  int32_t line_number = 1;
+// @private
+static lse_render_object*
+create_fill_rect_render_object(lse_graphics* graphics, lse_render_command* command, sdl_render_object* sro) {
+  sro = sdl_render_object_init(sro, (lse_sdl_graphics*)graphics);
 
-  if (!dest.buffer) {
-    return false;
+  if (sro) {
+    sro->rect = *command->rect;
+    sro->can_tint = true;
+    // drawn with the opaque white fill texture. the draw color decides the final alpha.
+    sro->is_opaque = true;
   }
 
-  lse_font_use_font_size(font, command->text_style->font_size_px);
-  line_height = lse_font_get_line_height(font);
-
-  while (*cursor) {
-    lse_text_get_line(cursor, command->text_style, &line_metrics);
-
-    // lines that go outside the content box should not be aligned
-    if (line_metrics.width <= command->rect->width) {
-      switch (command->text_style->align) {
-        case LSE_STYLE_TEXT_ALIGN_CENTER:
-          x = ((float)dest.width / 2.f) - (line_metrics.width / 2.f);
-          break;
-        case LSE_STYLE_TEXT_ALIGN_RIGHT:
-          x = (float)dest.width - line_metrics.width;
-          break;
-        default:
-          break;
-      }
-    }
+  return (lse_render_object*)sro;
+}
 
-    sw_render_text_line(&dest, x, y, command->text_style, &line_metrics);
-
-    cursor = line_metrics.next;
-    y += line_height;
-
-    // TODO: vertical limit
-    if (max_lines > 0 && max_lines == line_number++) {
-      break;
-    }
-  }
-
-  result = lse_get_sdl_from_base(self)->SDL_UpdateTexture(target, NULL, dest.buffer, dest.pitch) == 0;
-  free(dest.buffer);
-
-  return result;
-}
-
-// @private
-static void
-sw_render_text_line(lse_surface* dest, float x, float y, lse_text_style* text_style, lse_text_line_info* metrics) {
-  lse_font* font = text_style->font;
-  float ascent = lse_font_get_ascent(font);
-  uint32_t codepoint;
-  uint32_t previous = 0;
-  lse_glyph_surface glyph;
-  const char* cursor = metrics->start;
-
-  while (*cursor && cursor != metrics->next) {
-    codepoint = lse_text_peek(cursor, text_style);
-
-    x += lse_font_get_kerning(font, previous, codepoint);
-
-    if (lse_font_get_glyph_surface(font, codepoint, &glyph)) {
-      sw_copy_alpha_buffer(
-          lse_snap_to_pixel_grid_i(x + (float)glyph.x_offset),
-          lse_snap_to_pixel_grid_i(y + ascent - (float)glyph.y_offset),
-          &glyph,
-          dest);
-    }
-
-    x += lse_font_get_advance(font, codepoint);
-
-    previous = codepoint;
-    cursor = lse_text_next(cursor);
-  }
-}
-
-// @private
-static lse_render_object*
-create_fill_rect_render_object(lse_graphics* graphics, lse_render_command* command, sdl_render_object* sro) {
-  sro = sdl_render_object_init(sro, (lse_sdl_graphics*)graphics);
+// @private
+static lse_render_object*
+create_draw_image_render_object(lse_graphics* graphics, lse_render_command* command, sdl_render_object* sro) {
+  sro = sdl_render_object_init(sro, (lse_sdl_graphics*)graphics);
 
   if (sro) {
+    sro->image = command->image;
+    lse_ref(sro->image);
     sro->rect = *command->rect;
+    sro->src_rect = to_pixel_src_rect(sro->image, command->src_rect);
+    sro->has_src_rect = true;
     sro->can_tint = true;
+    sro->is_opaque = lse_image_is_opaque(sro->image);
   }
 
   return (lse_render_object*)sro;
 }
 
 // @private
-static lse_render_object*
-create_draw_image_render_object(lse_graphics* graphics, lse_render_command* command, sdl_render_object* sro) {
-  sro = sdl_render_object_init(sro, (lse_sdl_graphics*)graphics);
+static SDL_Rect to_pixel_src_rect(lse_image* image, const lse_rect* src_rect) {
+  int32_t width = lse_image_get_width(image);
+  int32_t height = lse_image_get_height(image);
+  int32_t pixel_width = lse_image_get_pixel_width(image);
+  int32_t pixel_height = lse_image_get_pixel_height(image);
+  float sx;
+  float sy;
+
+  if (!src_rect) {
+    return (SDL_Rect){ 0, 0, pixel_width, pixel_height };
+  }
 
-  if (sro) {
-    sro->image = command->image;
-    lse_ref(sro->image);
-    sro->rect = *command->rect;
-    sro->src_rect = *((SDL_Rect*)command->src_rect);
-    sro->has_src_rect = true;
-    sro->can_tint = true;
+  // src_rect is in intrinsic image coordinates. an image decoded at display size has fewer pixels.
+  if ((pixel_width == width && pixel_height == height) || width <= 0 || height <= 0) {
+    return *((const SDL_Rect*)src_rect);
   }
 
-  return (lse_render_object*)sro;
+  sx = (float)pixel_width / (float)width;
+  sy = (float)pixel_height / (float)height;
+
+  return (SDL_Rect){
+    (int32_t)floorf((float)src_rect->x * sx),
+    (int32_t)floorf((float)src_rect->y * sy),
+    lse_max((int32_t)ceilf((float)src_rect->width * sx), 1),
+    lse_max((int32_t)ceilf((float)src_rect->height * sy), 1),
+  };
 }
 
 // @private
@@ -860,45 +1324,48 @@ create_rounded_rect_render_object(lse_graphics* graphics, lse_render_command* co
     return (lse_render_object*)sro;
   }
 
-  if (!sw_render_rounded_rect(self, command, sro->texture)) {
+  if (!sw_render_rounded_rect(self, command, sro->texture.handle)) {
     return sdl_render_object_drop(sro, self);
   }
 
   sro->rect = *command->rect;
-  sro->has_src_rect = false;
+  sro->src_rect = (SDL_Rect){ 0, 0, (int32_t)command->rect->width, (int32_t)command->rect->height };
+  sro->has_src_rect = true;
   sro->can_tint = false;
 
   return (lse_render_object*)sro;
 }
 
+// @private
 static lse_render_object*
 create_draw_text_render_object(lse_graphics* graphics, lse_render_command* command, sdl_render_object* sro) {
   lse_sdl_graphics* self = (lse_sdl_graphics*)graphics;
-  lse_size bounds;
-  int32_t width;
-  int32_t height;
-
-  lse_text_measure(command->text, command->text_style, &bounds);
-
-  width = (int32_t)ceilf(bounds.width);
-  height = (int32_t)ceilf(bounds.height);
+  lse_text_layout* layout = command->text_layout;
+  sdl_glyph_atlas* atlas;
+  float width = ceilf(layout->size.width);
+  float height = ceilf(layout->size.height);
 
-  sro = sdl_render_object_init_as_target(sro, self, SDL_TEXTUREACCESS_STATIC, width, height);
+  // first, so the usage of the atlas by the previous quads is given back and a full atlas can be reset
+  sro = sdl_render_object_init(sro, self);
+  atlas = get_glyph_atlas(self, command->text_style->font, command->text_style->font_size_px);
 
-  if (!sro) {
-    return (lse_render_object*)sro;
+  if (!atlas) {
+    return sdl_render_object_drop(sro, self);
   }
 
-  if (!sw_render_text(self, command, sro->texture, width, height)) {
+  sro->atlas = atlas;
+  atlas->usages++;
+
+  if (!layout_text_quads(self, atlas, command, sro, width, height)) {
     return sdl_render_object_drop(sro, self);
   }
 
   switch (command->text_style->align) {
     case LSE_STYLE_TEXT_ALIGN_CENTER:
-      command->rect->x += (((float)command->rect->width / 2.f) - ((float)width / 2.f));
+      command->rect->x += (((float)command->rect->width / 2.f) - (width / 2.f));
       break;
     case LSE_STYLE_TEXT_ALIGN_RIGHT:
-      command->rect->x += (float)command->rect->width - (float)width;
+      command->rect->x += (float)command->rect->width - width;
       break;
     default:
       break;
@@ -907,11 +1374,10 @@ create_draw_text_render_object(lse_graphics* graphics, lse_render_command* comma
   sro->rect = (lse_rect_f){
     .x = command->rect->x,
     .y = command->rect->y,
-    .width = (float)width,
-    .height = (float)height,
+    .width = width,
+    .height = height,
   };
 
-  // TODO: may need to use src rect for overflow/content clipping
   sro->has_src_rect = false;
   sro->can_tint = true;
 
@@ -919,41 +1385,712 @@ create_draw_text_render_object(lse_graphics* graphics, lse_render_command* comma
 }
 
 // @private
-static SDL_Texture*
-ensure_texture(lse_sdl_graphics* self, SDL_Texture* texture, int32_t access, int32_t width, int32_t height) {
+static bool layout_text_quads(
+    lse_sdl_graphics* self,
+    sdl_glyph_atlas* atlas,
+    lse_render_command* command,
+    sdl_render_object* sro,
+    float width,
+    float height) {
+  lse_text_style* text_style = command->text_style;
+  lse_text_layout* layout = command->text_layout;
+  size_t line_count = lse_text_layout_get_line_count(layout);
+  const lse_text_layout_line* line;
+  float x;
+  float y = 0;
+
+  // glyphs missing from the atlas are rasterized at the current font size
+  if (!lse_font_use_font_size(text_style->font, text_style->font_size_px)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < line_count && y < height; i++) {
+    line = lse_text_layout_get_line(layout, i);
+    x = 0;
+
+    // lines that go outside the content box should not be aligned
+    if (line->width <= command->rect->width) {
+      switch (text_style->align) {
+        case LSE_STYLE_TEXT_ALIGN_CENTER:
+          x = (width / 2.f) - (line->width / 2.f);
+          break;
+        case LSE_STYLE_TEXT_ALIGN_RIGHT:
+          x = width - line->width;
+          break;
+        default:
+          break;
+      }
+    }
+
+    layout_text_line_quads(self, atlas, sro, x, y, layout, line, width, height);
+
+    y += layout->line_height;
+  }
+
+  return sro->quad_count > 0;
+}
+
+// @private
+static void layout_text_line_quads(
+    lse_sdl_graphics* self,
+    sdl_glyph_atlas* atlas,
+    sdl_render_object* sro,
+    float x,
+    float y,
+    lse_text_layout* layout,
+    const lse_text_layout_line* line,
+    float width,
+    float height) {
+  const lse_text_layout_glyph* layout_glyph;
+  const lse_atlas_glyph* glyph;
+
+  for (int32_t i = 0; i < line->glyph_count; i++) {
+    layout_glyph = lse_text_layout_get_glyph(layout, (size_t)(line->glyph_start + i));
+    glyph = get_atlas_glyph(self, atlas, layout_glyph->codepoint);
+
+    if (!glyph) {
+      push_standalone_glyph_quad(
+          self,
+          sro,
+          atlas->atlas.font,
+          layout_glyph->codepoint,
+          x + layout_glyph->x,
+          y + layout->ascent,
+          width,
+          height);
+    } else if (glyph->page != LSE_GLYPH_ATLAS_NO_PAGE) {
+      push_glyph_quad(
+          sro,
+          atlas->pages[glyph->page],
+          glyph,
+          lse_snap_to_pixel_grid_i(x + layout_glyph->x + (float)glyph->x_offset),
+          lse_snap_to_pixel_grid_i(y + layout->ascent - (float)glyph->y_offset),
+          width,
+          height);
+    }
+  }
+}
+
+// @private
+static void push_glyph_quad(
+    sdl_render_object* sro,
+    SDL_Texture* page,
+    const lse_atlas_glyph* glyph,
+    int32_t x,
+    int32_t y,
+    float width,
+    float height) {
+  SDL_Rect src_rect = *((const SDL_Rect*)&glyph->rect);
+
+  // clip the glyph to the text bounds
+  if (x < 0) {
+    src_rect.x -= x;
+    src_rect.w += x;
+    x = 0;
+  }
+
+  if (y < 0) {
+    src_rect.y -= y;
+    src_rect.h += y;
+    y = 0;
+  }
+
+  src_rect.w = lse_min(src_rect.w, (int32_t)width - x);
+  src_rect.h = lse_min(src_rect.h, (int32_t)height - y);
+
+  if (src_rect.w <= 0 || src_rect.h <= 0) {
+    return;
+  }
+
+  if (sro->quad_count == sro->quad_capacity) {
+    sro->quad_capacity = sro->quad_capacity ? sro->quad_capacity * 2 : 16;
+    sro->quads = lse_realloc(sro->quads, (size_t)sro->quad_capacity * sizeof(sdl_glyph_quad));
+  }
+
+  sro->quads[sro->quad_count++] = (sdl_glyph_quad){
+    .texture = page,
+    .src_rect = src_rect,
+    .dest_rect = { (float)x, (float)y, (float)src_rect.w, (float)src_rect.h },
+  };
+}
+
+// @private
+static void draw_glyph_quads(
+    lse_sdl_graphics* self,
+    sdl_render_object* sro,
+    const lse_matrix* m,
+    float angle,
+    lse_color color) {
   lse_sdl* sdl = lse_get_sdl_from_base(self);
-  int32_t current_access;
-  int32_t current_width;
-  int32_t current_height;
+  const float origin_x = sro->rect.x + lse_matrix_get_translate_x(m);
+  const float origin_y = sro->rect.y + lse_matrix_get_translate_y(m);
+  const float scale_x = lse_matrix_get_scale_x(m);
+  const float scale_y = lse_matrix_get_scale_y(m);
+  SDL_Texture* current = NULL;
+  sdl_glyph_quad* quad;
+
+  // glyphs are rotated around the origin of the text, rather than their own origin. since consecutive copies use the
+  // same page texture, the renderer can batch them into a single draw call.
+  for (int32_t i = 0; i < sro->quad_count; i++) {
+    quad = &sro->quads[i];
+
+    if (self->use_geometry_batch) {
+      SDL_FRect dest = {
+        .x = origin_x + (quad->dest_rect.x * scale_x),
+        .y = origin_y + (quad->dest_rect.y * scale_y),
+        .w = quad->dest_rect.width * scale_x,
+        .h = quad->dest_rect.height * scale_y,
+      };
+
+      batch_quad(
+          self,
+          quad->texture,
+          SDL_BLENDMODE_BLEND,
+          &quad->src_rect,
+          &dest,
+          angle,
+          &(SDL_FPoint){ origin_x, origin_y },
+          color);
+      continue;
+    }
 
-  if (texture) {
-    // TODO: using a strict w/h criteria will create texture churn for common scene graph usages. if the texture
-    // is too big, reuse it but use clip rect and src rect when rendering.
-    if (sdl->SDL_QueryTexture(texture, NULL, &current_access, &current_width, &current_height) == 0 &&
-        current_access == access && current_width == width && current_height == height) {
-      return texture;
+    lse_graphics_add_render_stat(self, draw_calls, 1);
+
+    if (quad->texture != current) {
+      current = quad->texture;
+      set_texture_color(self, current, color);
+      sdl->SDL_SetTextureBlendMode(current, SDL_BLENDMODE_BLEND);
+    }
+
+    if (self->use_float_rects) {
+      SDL_FRect dest = {
+        .x = origin_x + (quad->dest_rect.x * scale_x),
+        .y = origin_y + (quad->dest_rect.y * scale_y),
+        .w = quad->dest_rect.width * scale_x,
+        .h = quad->dest_rect.height * scale_y,
+      };
+      SDL_FPoint center = { origin_x - dest.x, origin_y - dest.y };
+
+      sdl->SDL_RenderCopyExF(self->renderer, current, &quad->src_rect, &dest, angle, &center, SDL_FLIP_NONE);
+    } else {
+      SDL_Rect dest = {
+        .x = (int32_t)(origin_x + (quad->dest_rect.x * scale_x)),
+        .y = (int32_t)(origin_y + (quad->dest_rect.y * scale_y)),
+        .w = (int32_t)(quad->dest_rect.width * scale_x),
+        .h = (int32_t)(quad->dest_rect.height * scale_y),
+      };
+      SDL_Point center = { (int32_t)origin_x - dest.x, (int32_t)origin_y - dest.y };
+
+      sdl->SDL_RenderCopyEx(self->renderer, current, &quad->src_rect, &dest, angle, &center, SDL_FLIP_NONE);
+    }
+  }
+}
+
+// @private
+static lse_color get_draw_color(lse_graphics* graphics, sdl_render_object* sro, lse_color color) {
+  if (!sro->can_tint) {
+    color.value = 0xFFFFFFFF;
+  }
+
+  // opacity accumulates down the scene graph in the state stack
+  color.comp.a = (uint8_t)((float)color.comp.a * lse_graphics_base_get_state(graphics)->opacity);
+
+  return color;
+}
+
+// @private
+static sdl_glyph_atlas* get_glyph_atlas(lse_sdl_graphics* self, lse_font* font, float font_size) {
+  sdl_glyph_atlas* atlas = NULL;
+  int32_t page_size;
+
+  if (!lse_font_is_ready(font)) {
+    return NULL;
+  }
+
+  c_foreach(i, cvec_glyph_atlases, self->glyph_atlases) {
+    if (lse_glyph_atlas_matches(&(*i.ref)->atlas, font, font_size)) {
+      atlas = *i.ref;
+      break;
+    }
+  }
+
+  if (atlas) {
+    // no text draws from the pages, so the glyphs that did not fit get another chance
+    if (atlas->atlas.is_full && atlas->usages == 0) {
+      sdl_glyph_atlas_reset(self, atlas);
     }
+  } else {
+    // large font sizes get bigger pages, so more than a handful of glyphs fit on a page
+    page_size = font_size > 64.f ? GLYPH_ATLAS_PAGE_SIZE * 2 : GLYPH_ATLAS_PAGE_SIZE;
+    atlas = lse_calloc(1, sizeof(sdl_glyph_atlas));
+    atlas->atlas = lse_glyph_atlas_init(font, font_size, page_size, GLYPH_ATLAS_MAX_PAGES);
+    cvec_glyph_atlases_push_back(&self->glyph_atlases, atlas);
+  }
+
+  atlas->last_used_frame = self->frame;
+
+  if (cvec_glyph_atlases_size(self->glyph_atlases) > GLYPH_ATLAS_MAX_COUNT) {
+    evict_glyph_atlases(self);
+  }
+
+  return atlas;
+}
+
+// @private
+static void evict_glyph_atlases(lse_sdl_graphics* self) {
+  cvec_glyph_atlases_iter lru = { 0 };
+  sdl_glyph_atlas* atlas;
+
+  while (cvec_glyph_atlases_size(self->glyph_atlases) > GLYPH_ATLAS_MAX_COUNT) {
+    lru.ref = NULL;
 
-    sdl->SDL_DestroyTexture(texture);
+    // atlases used this frame are about to get quads, so they are never picked
+    c_foreach(i, cvec_glyph_atlases, self->glyph_atlases) {
+      atlas = *i.ref;
+
+      if (atlas->usages == 0 && atlas->last_used_frame != self->frame
+          && (!lru.ref || atlas->last_used_frame < (*lru.ref)->last_used_frame)) {
+        lru = i;
+      }
+    }
+
+    // every atlas has text on screen. the cap is exceeded until some of the text goes away.
+    if (!lru.ref) {
+      return;
+    }
+
+    sdl_glyph_atlas_release(self, *lru.ref, true);
+    cvec_glyph_atlases_erase_at(&self->glyph_atlases, lru);
   }
+}
 
-  texture = sdl->SDL_CreateTexture(self->renderer, LSE_SDL_TEXTURE_FORMAT, access, width, height);
+// @private
+static const lse_atlas_glyph* get_atlas_glyph(lse_sdl_graphics* self, sdl_glyph_atlas* atlas, uint32_t codepoint) {
+  const lse_atlas_glyph* glyph = lse_glyph_atlas_find(&atlas->atlas, codepoint);
+  lse_glyph_surface glyph_surface;
+
+  if (glyph) {
+    return glyph;
+  }
+
+  if (lse_font_get_glyph_surface(atlas->atlas.font, codepoint, &glyph_surface)) {
+    glyph = lse_glyph_atlas_insert(
+        &atlas->atlas,
+        codepoint,
+        glyph_surface.surface.width,
+        glyph_surface.surface.height,
+        glyph_surface.x_offset,
+        glyph_surface.y_offset);
+
+    // NULL if the glyph is larger than a page or the atlas is full. the caller draws it from its own texture.
+    if (glyph && glyph->page != LSE_GLYPH_ATLAS_NO_PAGE && !upload_glyph(self, atlas, glyph, &glyph_surface)) {
+      // forget the glyph, so the caller draws it from its own texture and the next frame retries the upload
+      LSE_LOG_ERROR("failed to upload glyph to atlas: %u", codepoint);
+      lse_glyph_atlas_remove(&atlas->atlas, codepoint);
+      glyph = NULL;
+    }
+  } else {
+    // cache whitespace and missing glyphs, so the font is not asked again
+    glyph = lse_glyph_atlas_insert(&atlas->atlas, codepoint, 0, 0, 0, 0);
+  }
+
+  return glyph;
+}
+
+// @private
+static bool push_standalone_glyph_quad(
+    lse_sdl_graphics* self,
+    sdl_render_object* sro,
+    lse_font* font,
+    uint32_t codepoint,
+    float x,
+    float y,
+    float width,
+    float height) {
+  lse_glyph_surface glyph_surface;
+  lse_atlas_glyph glyph;
+  SDL_Texture* texture;
+  uint32_t* pixels;
+  bool result;
+
+  if (!lse_font_get_glyph_surface(font, codepoint, &glyph_surface)) {
+    return false;
+  }
+
+  texture = create_texture(self, SDL_TEXTUREACCESS_STATIC, glyph_surface.surface.width, glyph_surface.surface.height);
+
+  if (!texture) {
+    return false;
+  }
+
+  pixels = expand_glyph_pixels(&glyph_surface);
+  result = update_texture(self, texture, NULL, pixels, glyph_surface.surface.width * (int32_t)sizeof(uint32_t));
+  free(pixels);
+
+  glyph = (lse_atlas_glyph){
+    .rect = { 0, 0, glyph_surface.surface.width, glyph_surface.surface.height },
+    .x_offset = glyph_surface.x_offset,
+    .y_offset = glyph_surface.y_offset,
+  };
+
+  if (result) {
+    push_glyph_quad(
+        sro,
+        texture,
+        &glyph,
+        lse_snap_to_pixel_grid_i(x + (float)glyph.x_offset),
+        lse_snap_to_pixel_grid_i(y - (float)glyph.y_offset),
+        width,
+        height);
+  }
+
+  // push_glyph_quad drops glyphs clipped away by the text bounds
+  if (!result || sro->quad_count == 0 || sro->quads[sro->quad_count - 1].texture != texture) {
+    destroy_texture(self, texture);
+    return false;
+  }
+
+  sro->quads[sro->quad_count - 1].owns_texture = true;
+
+  return true;
+}
+
+// @private
+static bool upload_glyph(
+    lse_sdl_graphics* self,
+    sdl_glyph_atlas* atlas,
+    const lse_atlas_glyph* glyph,
+    const lse_glyph_surface* glyph_surface) {
+  SDL_Texture* page = atlas->pages[glyph->page];
+  uint32_t* pixels;
+  bool result;
+
+  if (!page) {
+    page = create_texture(self, SDL_TEXTUREACCESS_STATIC, atlas->atlas.page_width, atlas->atlas.page_height);
+
+    if (!page) {
+      return false;
+    }
+
+    // clear the page, so padding between glyphs is transparent
+    pixels = lse_calloc((size_t)(atlas->atlas.page_width * atlas->atlas.page_height), sizeof(uint32_t));
+    update_texture(self, page, NULL, pixels, atlas->atlas.page_width * (int32_t)sizeof(uint32_t));
+    free(pixels);
+
+    atlas->pages[glyph->page] = page;
+  }
+
+  pixels = expand_glyph_pixels(glyph_surface);
+  result = update_texture(
+      self, page, (const SDL_Rect*)&glyph->rect, pixels, glyph->rect.width * (int32_t)sizeof(uint32_t));
+  free(pixels);
+
+  return result;
+}
+
+// @private
+static uint32_t* expand_glyph_pixels(const lse_glyph_surface* glyph_surface) {
+  const uint8_t* src = glyph_surface->surface.buffer;
+  int32_t width = glyph_surface->surface.width;
+  int32_t height = glyph_surface->surface.height;
+  uint32_t* pixels = lse_malloc((size_t)(width * height) * sizeof(uint32_t));
+  uint32_t* dest = pixels;
+  int32_t x;
+  int32_t y;
+
+  // expand the 8-bit alpha glyph to white + alpha, so text color can be applied with a texture tint
+  for (y = 0; y < height; y++) {
+    for (x = 0; x < width; x++) {
+      *dest++ = 0xFFFFFF | ((uint32_t)src[x] << 24);
+    }
+
+    src += glyph_surface->surface.pitch;
+  }
+
+  return pixels;
+}
+
+// @private
+static void sdl_glyph_atlas_release(lse_sdl_graphics* self, sdl_glyph_atlas* atlas, bool destroy_textures) {
+  if (destroy_textures) {
+    // pending batched draws may reference the pages
+    flush_batch(self);
+
+    for (int32_t i = 0; i < GLYPH_ATLAS_MAX_PAGES; i++) {
+      if (atlas->pages[i]) {
+        destroy_texture(self, atlas->pages[i]);
+      }
+    }
+  }
+
+  lse_glyph_atlas_drop(&atlas->atlas);
+  free(atlas);
+}
+
+// @private
+static void sdl_glyph_atlas_reset(lse_sdl_graphics* self, sdl_glyph_atlas* atlas) {
+  flush_batch(self);
+
+  // pages are created cleared on the next upload, so padding between new glyphs is transparent again
+  for (int32_t i = 0; i < GLYPH_ATLAS_MAX_PAGES; i++) {
+    if (atlas->pages[i]) {
+      destroy_texture(self, atlas->pages[i]);
+      atlas->pages[i] = NULL;
+    }
+  }
+
+  lse_glyph_atlas_reset(&atlas->atlas);
+}
+
+// @private
+static void release_glyph_quads(lse_sdl_graphics* self, sdl_render_object* sro) {
+  bool has_owned_textures = false;
+
+  for (int32_t i = 0; i < sro->quad_count; i++) {
+    has_owned_textures |= sro->quads[i].owns_texture;
+  }
+
+  if (has_owned_textures && self->renderer) {
+    // pending batched draws may reference the glyph textures
+    flush_batch(self);
+
+    for (int32_t i = 0; i < sro->quad_count; i++) {
+      if (sro->quads[i].owns_texture) {
+        destroy_texture(self, sro->quads[i].texture);
+      }
+    }
+  }
+
+  free(sro->quads);
+  sro->quads = NULL;
+  sro->quad_count = sro->quad_capacity = 0;
+
+  if (sro->atlas) {
+    sro->atlas->usages--;
+    sro->atlas = NULL;
+  }
+}
+
+// @private
+static SDL_Texture* create_texture(lse_sdl_graphics* self, int32_t access, int32_t width, int32_t height) {
+  lse_sdl* sdl = lse_get_sdl_from_base(self);
+  SDL_Texture* texture = sdl->SDL_CreateTexture(self->renderer, LSE_SDL_TEXTURE_FORMAT, access, width, height);
 
   if (texture) {
     sdl->SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    lse_graphics_add_render_stat(self, textures_created, 1);
   }
 
   return texture;
 }
 
+// @private
+static void destroy_texture(lse_sdl_graphics* self, SDL_Texture* texture) {
+  lse_get_sdl_from_base(self)->SDL_DestroyTexture(texture);
+  lse_graphics_add_render_stat(self, textures_destroyed, 1);
+}
+
+// @private
+static bool
+update_texture(lse_sdl_graphics* self, SDL_Texture* texture, const SDL_Rect* rect, const void* pixels, int32_t pitch) {
+  lse_sdl* sdl = lse_get_sdl_from_base(self);
+  double start = lse_get_time_ms();
+  bool result = sdl->SDL_UpdateTexture(texture, rect, pixels, pitch) == 0;
+  int height;
+
+  lse_frame_timing_mark(&self->base.env->frame_timing, LSE_FRAME_PHASE_UPLOAD, start);
+
+  if (result) {
+    if (rect) {
+      height = rect->h;
+    } else if (sdl->SDL_QueryTexture(texture, NULL, NULL, NULL, &height) != 0) {
+      height = 0;
+    }
+
+    lse_graphics_add_render_stat(self, bytes_uploaded, (uint64_t)pitch * (uint64_t)height);
+  }
+
+  return result;
+}
+
+// @private
+static void set_render_target(lse_sdl_graphics* self, SDL_Texture* texture) {
+  lse_get_sdl_from_base(self)->SDL_SetRenderTarget(self->renderer, texture);
+  lse_graphics_add_render_stat(self, render_target_changes, 1);
+}
+
+// @private
+static void set_texture_color(lse_sdl_graphics* self, SDL_Texture* texture, lse_color color) {
+  lse_sdl* sdl = lse_get_sdl_from_base(self);
+
+  sdl->SDL_SetTextureColorMod(texture, color.comp.r, color.comp.g, color.comp.b);
+  sdl->SDL_SetTextureAlphaMod(texture, color.comp.a);
+  lse_graphics_add_render_stat(self, color_mod_changes, 1);
+  lse_graphics_add_render_stat(self, alpha_mod_changes, 1);
+}
+
+// @private
+static void set_clip_rect_from_state(lse_sdl_graphics* self) {
+  const lse_graphics_state* current = lse_graphics_base_get_state((lse_graphics*)self);
+
+  lse_get_sdl_from_base(self)->SDL_RenderSetClipRect(
+      self->renderer,
+      current && !lse_rect_is_empty(&current->clip_rect) ? (const SDL_Rect*)&current->clip_rect : NULL);
+  lse_graphics_add_render_stat(self, clip_rect_changes, 1);
+}
+
+// @private
+static void batch_quad(
+    lse_sdl_graphics* self,
+    SDL_Texture* texture,
+    SDL_BlendMode blend_mode,
+    const SDL_Rect* src_rect,
+    const SDL_FRect* dest,
+    float angle,
+    const SDL_FPoint* pivot,
+    lse_color color) {
+  sdl_geometry_batch* batch = &self->batch;
+  SDL_Color vertex_color = { color.comp.r, color.comp.g, color.comp.b, color.comp.a };
+  SDL_FPoint corners[4] = {
+    { dest->x, dest->y },
+    { dest->x + dest->w, dest->y },
+    { dest->x + dest->w, dest->y + dest->h },
+    { dest->x, dest->y + dest->h },
+  };
+  float u0 = 0;
+  float v0 = 0;
+  float u1 = 1;
+  float v1 = 1;
+  float radians;
+  float s;
+  float c;
+  float x;
+  float y;
+  int32_t texture_width;
+  int32_t texture_height;
+  SDL_Vertex* vertex;
+
+  // blend mode is texture state, so a change ends the batch
+  if (batch->quad_count == 0 || texture != batch->texture || blend_mode != batch->blend_mode) {
+    flush_batch(self);
+
+    if (lse_get_sdl_from_base(self)->SDL_QueryTexture(texture, NULL, NULL, &texture_width, &texture_height) != 0) {
+      return;
+    }
+
+    batch->texture = texture;
+    batch->blend_mode = blend_mode;
+    batch->texture_width = (float)texture_width;
+    batch->texture_height = (float)texture_height;
+  }
+
+  if (src_rect) {
+    u0 = (float)src_rect->x / batch->texture_width;
+    v0 = (float)src_rect->y / batch->texture_height;
+    u1 = (float)(src_rect->x + src_rect->w) / batch->texture_width;
+    v1 = (float)(src_rect->y + src_rect->h) / batch->texture_height;
+  }
+
+  // rotate clockwise (degrees) around pivot, matching SDL_RenderCopyEx
+  if (!lse_equals_f(angle, 0)) {
+    radians = angle * PI_F / 180.f;
+    s = sinf(radians);
+    c = cosf(radians);
+
+    for (int32_t i = 0; i < 4; i++) {
+      x = corners[i].x - pivot->x;
+      y = corners[i].y - pivot->y;
+      corners[i].x = pivot->x + (x * c) - (y * s);
+      corners[i].y = pivot->y + (x * s) + (y * c);
+    }
+  }
+
+  if (batch->quad_count == batch->quad_capacity) {
+    grow_batch(batch);
+  }
+
+  vertex = &batch->vertices[batch->quad_count * 4];
+  vertex[0] = (SDL_Vertex){ corners[0], vertex_color, { u0, v0 } };
+  vertex[1] = (SDL_Vertex){ corners[1], vertex_color, { u1, v0 } };
+  vertex[2] = (SDL_Vertex){ corners[2], vertex_color, { u1, v1 } };
+  vertex[3] = (SDL_Vertex){ corners[3], vertex_color, { u0, v1 } };
+
+  batch->quad_count++;
+}
+
+// @private
+static void flush_batch(lse_sdl_graphics* self) {
+  sdl_geometry_batch* batch = &self->batch;
+
+  if (batch->quad_count == 0) {
+    return;
+  }
+
+  // color and alpha mod are per vertex, so texture color mod does not need to be set
+  lse_get_sdl_from_base(self)->SDL_SetTextureBlendMode(batch->texture, batch->blend_mode);
+  lse_get_sdl_from_base(self)->SDL_RenderGeometry(
+      self->renderer, batch->texture, batch->vertices, batch->quad_count * 4, batch->indices, batch->quad_count * 6);
+  lse_graphics_add_render_stat(self, draw_calls, 1);
+
+  batch->quad_count = 0;
+  batch->texture = NULL;
+}
+
+// @private
+static void grow_batch(sdl_geometry_batch* batch) {
+  int32_t capacity = batch->quad_capacity ? batch->quad_capacity * 2 : 64;
+  int* index;
+
+  batch->vertices = lse_realloc(batch->vertices, (size_t)capacity * 4 * sizeof(SDL_Vertex));
+  batch->indices = lse_realloc(batch->indices, (size_t)capacity * 6 * sizeof(int));
+
+  // two triangles per quad: 0-1-2 and 2-3-0
+  for (int32_t i = batch->quad_capacity; i < capacity; i++) {
+    index = &batch->indices[i * 6];
+    index[0] = (i * 4);
+    index[1] = (i * 4) + 1;
+    index[2] = (i * 4) + 2;
+    index[3] = (i * 4) + 2;
+    index[4] = (i * 4) + 3;
+    index[5] = (i * 4);
+  }
+
+  batch->quad_capacity = capacity;
+}
+
+// @private
+static void* texture_pool_create(void* user_data, int32_t access, int32_t width, int32_t height) {
+  return create_texture((lse_sdl_graphics*)user_data, access, width, height);
+}
+
+// @private
+static void texture_pool_destroy(void* user_data, void* texture) {
+  lse_sdl_graphics* self = user_data;
+
+  // textures die with the renderer
+  if (self->renderer) {
+    destroy_texture(self, texture);
+  }
+}
+
+// @private
+static void release_pooled_texture(lse_sdl_graphics* self, sdl_render_object* sro) {
+  // after destroy, the renderer has already released the texture
+  if (self->renderer) {
+    lse_texture_pool_release(&self->texture_pool, &sro->texture);
+  }
+
+  sro->texture = (lse_pooled_texture){ 0 };
+}
+
 static lse_render_object* sdl_render_object_drop(sdl_render_object* current, lse_sdl_graphics* sdl_graphics) {
   if (current) {
-    if (current->texture) {
-      lse_get_sdl_from_base(sdl_graphics)->SDL_DestroyTexture(current->texture);
-    }
+    release_pooled_texture(sdl_graphics, current);
     lse_unref(current->image);
+    release_glyph_quads(sdl_graphics, current);
 
     free(current);
+    lse_graphics_add_render_stat(sdl_graphics, render_object_count, -1);
   }
 
   return NULL;
@@ -961,14 +2098,14 @@ static lse_render_object* sdl_render_object_drop(sdl_render_object* current, lse
 
 static sdl_render_object* sdl_render_object_init(sdl_render_object* current, lse_sdl_graphics* sdl_graphics) {
   if (current) {
-    if (current->texture) {
-      lse_get_sdl_from_base(sdl_graphics)->SDL_DestroyTexture(current->texture);
-    }
+    release_pooled_texture(sdl_graphics, current);
     lse_unref(current->image);
+    release_glyph_quads(sdl_graphics, current);
 
     memset(current, 0, sizeof(sdl_render_object));
   } else {
     current = lse_calloc(1, sizeof(sdl_render_object));
+    lse_graphics_add_render_stat(sdl_graphics, render_object_count, 1);
   }
 
   return current;
@@ -980,20 +2117,18 @@ static sdl_render_object* sdl_render_object_init_as_target(
     int32_t texture_access,
     int32_t width,
     int32_t height) {
-  SDL_Texture* texture;
+  lse_pooled_texture texture;
 
   assert(texture_access == SDL_TEXTUREACCESS_TARGET || texture_access == SDL_TEXTUREACCESS_STATIC);
 
+  // give the current texture back first. if the new size falls in the same bucket, the same texture comes back.
   if (current) {
-    texture = current->texture;
-    current->texture = NULL;
-  } else {
-    texture = NULL;
+    release_pooled_texture(sdl_graphics, current);
   }
 
-  texture = ensure_texture(sdl_graphics, texture, texture_access, width, height);
+  texture = lse_texture_pool_acquire(&sdl_graphics->texture_pool, texture_access, width, height);
 
-  if (!texture) {
+  if (!texture.handle) {
     return (sdl_render_object*)sdl_render_object_drop(current, sdl_graphics);
   }
 
@@ -1003,29 +2138,6 @@ static sdl_render_object* sdl_render_object_init_as_target(
   return current;
 }
 
-static void sw_copy_alpha_buffer(int32_t x, int32_t y, const lse_glyph_surface* glyph, const lse_surface* dest) {
-  uint8_t* src_buffer = glyph->surface.buffer;
-  int32_t src_width = glyph->surface.width;
-  int32_t src_height = glyph->surface.height;
-  lse_color* dest_buffer = dest->buffer;
-  int32_t dest_buffer_stride = dest->pitch / (int32_t)sizeof(lse_color);
-  int32_t src_y = 0;
-  int32_t i;
-
-  dest_buffer += ((dest_buffer_stride * y) + x);
-
-  while (src_y < src_height && src_y < dest->height - y) {
-    for (i = 0; i < src_width; i++) {
-      dest_buffer[i].value = (0xFFFFFF | (src_buffer[i] << 24));
-    }
-
-    dest_buffer += dest_buffer_stride;
-    src_buffer += src_width;
-
-    src_y++;
-  }
-}
-
 // ////////////////////////////////////////////////////////////////////////////
 // Export type information for lse_object.c:register_types().
 // ////////////////////////////////////////////////////////////////////////////
@@ -303,6 +303,23 @@ static bool process_events(lse_video* video) {
       case SDL_JOYDEVICEREMOVED:
         lse_env_on_gamepad_disconnected(self->env, event->jdevice.which);
         break;
+      case SDL_WINDOWEVENT:
+        // the back buffer is not preserved, so partial redraw cannot rely on the last frame
+        switch (event->window.event) {
+          case SDL_WINDOWEVENT_EXPOSED:
+          case SDL_WINDOWEVENT_RESTORED:
+          case SDL_WINDOWEVENT_SIZE_CHANGED:
+            lse_env_on_window_damaged(self->env);
+            break;
+          default:
+            break;
+        }
+        break;
+      case SDL_RENDER_TARGETS_RESET:
+      case SDL_RENDER_DEVICE_RESET:
+        // render target textures, including layers, lost their contents
+        lse_env_on_window_damaged(self->env);
+        break;
       case SDL_CONTROLLERAXISMOTION:
         self->env->on_gamepad_axis_motion(
             event->caxis.which,
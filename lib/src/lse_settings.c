@@ -13,11 +13,20 @@
 
 #include <lse.h>
 
+#include "lse_cfg.h"
+
 lse_settings lse_settings_init() {
   return (lse_settings){
     .mock_settings = { .enabled = false },
     .sdl_mixer_settings = { .enabled = true },
     .sdl_settings = { .enabled = true },
+    .render_settings = { .partial_redraw = false,
+                         .show_redraw_regions = false,
+                         .batch_geometry = true,
+                         .vsync = LSE_VSYNC_MODE_ON,
+                         .fps_limit = 0,
+                         .image_cache_budget = LSE_CFG_IMAGE_CACHE_BUDGET,
+                         .image_store_budget = LSE_CFG_IMAGE_STORE_BUDGET },
   };
 }
 
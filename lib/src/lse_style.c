@@ -481,7 +481,8 @@ LSE_API bool LSE_CDECL lse_style_set_enum(lse_style* style, lse_style_property p
 
 LSE_API bool LSE_CDECL lse_style_set_object(lse_style* style, lse_style_property prop, lse_object* value) {
   lse_style_property_type prop_type;
-  cmap_properties_result result;
+  cmap_properties_iter it;
+  lse_object* replaced = NULL;
 
   if (lse_style_is_locked(style)) {
     prop_type = LSE_STYLE_PROPERTY_TYPE_UNKNOWN;
@@ -491,30 +492,18 @@ LSE_API bool LSE_CDECL lse_style_set_object(lse_style* style, lse_style_property
 
   switch (prop_type) {
     case LSE_STYLE_PROPERTY_TYPE_STRING:
-      // TODO: validate
-      // TODO: same value?
-      // TODO: update node
-      // TODO: unref if set
-      // TODO: empty string?
-      result = cmap_properties_insert_or_assign(
-          &style->properties,
-          prop,
-          (style_property){
-              .u.object = value,
-          });
-      break;
     case LSE_STYLE_PROPERTY_TYPE_FILTER:
-      // TODO: validate
-      result = cmap_properties_insert_or_assign(
-          &style->properties,
-          prop,
-          (style_property){
-              .u.object = value,
-          });
-      break;
     case LSE_STYLE_PROPERTY_TYPE_TRANSFORM:
       // TODO: validate
-      result = cmap_properties_insert_or_assign(
+      // TODO: same value?
+      // TODO: empty string?
+      it = cmap_properties_find(&style->properties, prop);
+
+      if (it.ref != cmap_properties_end(&style->properties).ref) {
+        replaced = it.ref->second.u.object;
+      }
+
+      cmap_properties_insert_or_assign(
           &style->properties,
           prop,
           (style_property){
@@ -522,19 +511,18 @@ LSE_API bool LSE_CDECL lse_style_set_object(lse_style* style, lse_style_property
           });
       break;
     default:
-      result = (cmap_properties_result){ .inserted = false, .ref = NULL };
-      break;
+      lse_object_unref(value);
+      return false;
   }
 
-  if (result.inserted) {
-    if (style->node) {
-      lse_node_on_style_property_change(style->node, prop);
-    }
-    return true;
-  } else {
-    lse_object_unref(value);
-    return false;
+  // the style owns the new value now. if the same object was set again, this drops the caller's extra ref.
+  lse_object_unref(replaced);
+
+  if (style->node) {
+    lse_node_on_style_property_change(style->node, prop);
   }
+
+  return true;
 }
 
 LSE_API bool LSE_CDECL lse_style_set_color(lse_style* style, lse_style_property prop, uint32_t value) {
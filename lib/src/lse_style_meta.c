@@ -194,6 +194,13 @@ static const char* k_str_font_kerning[] = {
 };
 
 
+static const char* k_str_will_change[] = {
+  "auto",
+  "transform",
+  "opacity",
+};
+
+
 static const char* k_str_anchor[] = {
   "top",
   "right",
@@ -379,10 +386,12 @@ static const property_info k_property_info[] = {
   { .type = LSE_STYLE_PROPERTY_TYPE_NUMBER, .layout = false, .enum_values_size = 0, },
   /* whiteSpace */
   { .type = LSE_STYLE_PROPERTY_TYPE_ENUM, .layout = false, .enum_values = k_str_white_space, .enum_values_size = 3, .enum_bit_width = 2, .enum_offset = 37, },
+  /* willChange */
+  { .type = LSE_STYLE_PROPERTY_TYPE_ENUM, .layout = false, .enum_values = k_str_will_change, .enum_values_size = 3, .enum_bit_width = 2, .enum_offset = 39, },
 };
 
 bool lse_style_meta_is_style_property(int32_t value) {
-  return value >= 0 && value < 71;
+  return value >= 0 && value < 72;
 }
 
 lse_style_property_type lse_style_meta_get_property_type(lse_style_property prop) {
@@ -532,9 +541,9 @@ int32_t lse_style_meta_get_enum(lse_style_property prop, uint64_t flags) {
 
 uint64_t lse_style_meta_set_enum(lse_style_property prop, int32_t enum_value, uint64_t flags) {
   if (k_property_info[prop].type == LSE_STYLE_PROPERTY_TYPE_ENUM && lse_style_meta_is_enum_value(prop, enum_value)) {
-    uint32_t mask_value = mask(k_property_info[prop].enum_bit_width, k_property_info[prop].enum_offset);
+    uint64_t mask_value = mask(k_property_info[prop].enum_bit_width, k_property_info[prop].enum_offset);
 
-    return ((flags & ~mask_value) | ((enum_value << k_property_info[prop].enum_offset) & (mask_value)));
+    return ((flags & ~mask_value) | (((uint64_t)enum_value << k_property_info[prop].enum_offset) & (mask_value)));
   }
 
   return flags;
@@ -549,7 +558,7 @@ bool lse_style_meta_is_unit(int32_t value) {
 }
 
 static uint64_t mask(uint64_t bitWidth, uint64_t offset) {
-  return ((1 << bitWidth) - 1) << offset;
+  return ((UINT64_C(1) << bitWidth) - 1) << offset;
 }
 
 static bool is_xanchor(const lse_style_value* numeric) {
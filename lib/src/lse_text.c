@@ -14,10 +14,26 @@
 #include "lse_text.h"
 
 #include "lse_font.h"
+#include "lse_object.h"
 #include "lse_util.h"
 #include <ctype.h>
 #include <stc/utf8.h>
 
+#define i_val lse_text_layout_line
+#define i_tag text_layout_lines
+#define i_opt c_no_clone | c_no_cmp | c_is_fwd
+#include <stc/cvec.h>
+
+#define i_val lse_text_layout_glyph
+#define i_tag text_layout_glyphs
+#define i_opt c_no_clone | c_no_cmp | c_is_fwd
+#include <stc/cvec.h>
+
+static int32_t get_line_limit(const lse_text_style* style, float line_height);
+static bool text_layout_matches(lse_text_layout* layout, lse_string* text, const lse_text_style* style, int32_t limit);
+static void text_layout_compute(lse_text_layout* layout, lse_string* text, const lse_text_style* style);
+static void text_layout_add_glyphs(lse_text_layout* layout, const lse_text_style* style, lse_text_layout_line* line);
+
 void lse_text_get_whitespace(const char* utf8, lse_text_whitespace* out) {
   const char* cursor = utf8;
   uint32_t codepoint;
@@ -46,7 +62,7 @@ void lse_text_measure(lse_string* str, const lse_text_style* text_style, lse_siz
   float longest = 0;
   int32_t line_count = 0;
   lse_text_line_info line_info;
-  int32_t max_lines = INT32_MAX;
+  int32_t max_lines;
   float line_height;
 
   *out = (lse_size){ 0 };
@@ -56,14 +72,7 @@ void lse_text_measure(lse_string* str, const lse_text_style* text_style, lse_siz
   }
 
   line_height = lse_font_get_line_height(text_style->font);
-
-  if (text_style->context_box.height > 0 && line_height > 0) {
-    max_lines = (int32_t)ceilf(text_style->context_box.height / line_height);
-  }
-
-  if (text_style->max_lines > 0) {
-    max_lines = lse_min(max_lines, text_style->max_lines);
-  }
+  max_lines = get_line_limit(text_style, line_height);
 
   while (*cursor) {
     lse_text_get_line(cursor, text_style, &line_info);
@@ -185,6 +194,77 @@ void lse_text_get_word(const char* str, const lse_text_style* style, lse_text_wo
   };
 }
 
+lse_text_layout lse_text_layout_init() {
+  return (lse_text_layout){
+    .lines = cvec_text_layout_lines_init(),
+    .glyphs = cvec_text_layout_glyphs_init(),
+  };
+}
+
+void lse_text_layout_drop(lse_text_layout* layout) {
+  if (layout) {
+    cvec_text_layout_lines_drop(&layout->lines);
+    cvec_text_layout_glyphs_drop(&layout->glyphs);
+    lse_unref(layout->text);
+    lse_unref(layout->font);
+    *layout = lse_text_layout_init();
+  }
+}
+
+bool lse_text_layout_update(lse_text_layout* layout, lse_string* text, const lse_text_style* style) {
+  int32_t line_limit;
+
+  if (!lse_font_use_font_size(style->font, style->font_size_px)) {
+    cvec_text_layout_lines_clear(&layout->lines);
+    cvec_text_layout_glyphs_clear(&layout->glyphs);
+    layout->size = (lse_size){ 0 };
+    layout->valid = false;
+
+    return true;
+  }
+
+  line_limit = get_line_limit(style, lse_font_get_line_height(style->font));
+
+  if (text_layout_matches(layout, text, style, line_limit)) {
+    return false;
+  }
+
+  lse_ref(text);
+  lse_unref(layout->text);
+  layout->text = text;
+
+  lse_ref(style->font);
+  lse_unref(layout->font);
+  layout->font = style->font;
+
+  layout->font_size = style->font_size_px;
+  layout->transform = style->transform;
+  layout->white_space = style->white_space;
+  layout->kerning_enabled = style->kerning_enabled;
+  layout->wrap_width = style->context_box.width;
+  layout->line_limit = line_limit;
+
+  text_layout_compute(layout, text, style);
+
+  return true;
+}
+
+void lse_text_layout_invalidate(lse_text_layout* layout) {
+  layout->valid = false;
+}
+
+size_t lse_text_layout_get_line_count(lse_text_layout* layout) {
+  return cvec_text_layout_lines_size(layout->lines);
+}
+
+const lse_text_layout_line* lse_text_layout_get_line(lse_text_layout* layout, size_t i) {
+  return cvec_text_layout_lines_at(&layout->lines, i);
+}
+
+const lse_text_layout_glyph* lse_text_layout_get_glyph(lse_text_layout* layout, size_t i) {
+  return cvec_text_layout_glyphs_at(&layout->glyphs, i);
+}
+
 uint32_t lse_text_peek(const char* utf8, const lse_text_style* style) {
   uint32_t codepoint = utf8_peek(utf8);
 
@@ -202,3 +282,121 @@ const char* lse_text_next(const char* utf8) {
   utf8_decode_t d = { UTF8_OK, 0 };
   return (const char*)utf8_next(&d, (const uint8_t*)utf8);
 }
+
+// @private
+static int32_t get_line_limit(const lse_text_style* style, float line_height) {
+  int32_t max_lines = INT32_MAX;
+
+  if (style->context_box.height > 0 && line_height > 0) {
+    max_lines = (int32_t)ceilf(style->context_box.height / line_height);
+  }
+
+  if (style->max_lines > 0) {
+    max_lines = lse_min(max_lines, style->max_lines);
+  }
+
+  return max_lines;
+}
+
+// @private
+static bool text_layout_matches(lse_text_layout* layout, lse_string* text, const lse_text_style* style, int32_t limit) {
+  float wrap_width = style->context_box.width;
+
+  if (!layout->valid || layout->text != text || layout->font != style->font
+      || !lse_equals_f(layout->font_size, style->font_size_px) || layout->transform != style->transform
+      || layout->white_space != style->white_space || layout->kerning_enabled != style->kerning_enabled) {
+    return false;
+  }
+
+  // a different line limit only matters if it cuts off lines or the layout was cut off by the old limit
+  if (layout->line_limit != limit
+      && (layout->truncated || (size_t)limit < cvec_text_layout_lines_size(layout->lines))) {
+    return false;
+  }
+
+  if (style->white_space == LSE_STYLE_WHITE_SPACE_PRE || lse_equals_f(layout->wrap_width, wrap_width)) {
+    return true;
+  }
+
+  // lines broken at the old wrap width break in the same places at any narrower wrap width the longest line fits in
+  return wrap_width >= layout->size.width && wrap_width <= layout->wrap_width;
+}
+
+// @private
+static void text_layout_compute(lse_text_layout* layout, lse_string* text, const lse_text_style* style) {
+  const char* str = lse_string_as_cstring(text);
+  const char* cursor = str;
+  lse_text_line_info line_info;
+  lse_text_layout_line* line;
+  float longest = 0;
+
+  cvec_text_layout_lines_clear(&layout->lines);
+  cvec_text_layout_glyphs_clear(&layout->glyphs);
+  layout->truncated = false;
+
+  while (*cursor) {
+    lse_text_get_line(cursor, style, &line_info);
+
+    cursor = line_info.next;
+
+    // trailing whitespace does not start a new line
+    if (!*cursor && line_info.width <= 0) {
+      break;
+    }
+
+    line = cvec_text_layout_lines_push_back(
+        &layout->lines,
+        (lse_text_layout_line){
+            .start = (int32_t)(line_info.start - str),
+            .end = (int32_t)(line_info.next - str),
+            .width = line_info.width,
+            .glyph_start = (int32_t)cvec_text_layout_glyphs_size(layout->glyphs),
+        });
+
+    text_layout_add_glyphs(layout, style, line);
+
+    if (line_info.width > longest) {
+      longest = line_info.width;
+    }
+
+    if (cvec_text_layout_lines_size(layout->lines) == (size_t)layout->line_limit) {
+      layout->truncated = (*cursor != '\0');
+      break;
+    }
+  }
+
+  layout->line_height = lse_font_get_line_height(style->font);
+  layout->ascent = lse_font_get_ascent(style->font);
+  layout->size = (lse_size){
+    .width = longest,
+    .height = (float)cvec_text_layout_lines_size(layout->lines) * layout->line_height,
+  };
+  layout->valid = true;
+}
+
+// @private
+static void text_layout_add_glyphs(lse_text_layout* layout, const lse_text_style* style, lse_text_layout_line* line) {
+  const char* str = lse_string_as_cstring(layout->text);
+  const char* cursor = str + line->start;
+  const char* end = str + line->end;
+  lse_font* font = style->font;
+  uint32_t codepoint;
+  uint32_t previous = 0;
+  float x = 0;
+
+  while (*cursor && cursor != end) {
+    codepoint = lse_text_peek(cursor, style);
+
+    x += lse_font_get_kerning(font, previous, codepoint);
+
+    if (codepoint > LSE_UNICODE_SPACE) {
+      cvec_text_layout_glyphs_push_back(&layout->glyphs, (lse_text_layout_glyph){ .codepoint = codepoint, .x = x });
+      line->glyph_count++;
+    }
+
+    x += lse_font_get_advance(font, codepoint);
+
+    previous = codepoint;
+    cursor = lse_text_next(cursor);
+  }
+}
@@ -16,6 +16,8 @@
 #include "lse_rect.h"
 #include "lse_types.h"
 
+#include <stc/forward.h>
+
 //
 // macros
 //
@@ -60,6 +62,53 @@ struct lse_text_word_info {
   bool has_leading_space;
 };
 
+struct lse_text_layout_line {
+  // byte offsets of the line in the text
+  int32_t start;
+  int32_t end;
+  float width;
+  // range of the line's glyphs in lse_text_layout.glyphs
+  int32_t glyph_start;
+  int32_t glyph_count;
+};
+
+struct lse_text_layout_glyph {
+  uint32_t codepoint;
+  // pen position relative to the start of the line
+  float x;
+};
+
+forward_cvec(cvec_text_layout_lines, lse_text_layout_line);
+forward_cvec(cvec_text_layout_glyphs, lse_text_layout_glyph);
+
+/**
+ * Line breaks and glyph positions of a string, computed once and shared by measurement (yoga) and painting.
+ *
+ * The layout remembers the inputs it was computed from: text, font, font size, text transform, white space, kerning,
+ * wrap width (context box width) and line limit (max lines and context box height). lse_text_layout_update() only
+ * recomputes when one of the inputs changes. Glyphs with nothing to draw (whitespace) are not stored.
+ */
+struct lse_text_layout {
+  // inputs
+  lse_string* text;
+  lse_font* font;
+  float font_size;
+  lse_style_text_transform transform;
+  lse_style_white_space white_space;
+  bool kerning_enabled;
+  float wrap_width;
+  int32_t line_limit;
+
+  // results
+  bool valid;
+  bool truncated;
+  lse_size size;
+  float line_height;
+  float ascent;
+  cvec_text_layout_lines lines;
+  cvec_text_layout_glyphs glyphs;
+};
+
 //
 // function prototypes
 //
@@ -116,5 +165,31 @@ void lse_text_get_whitespace(const char* str, lse_text_whitespace* out);
 
 void lse_text_get_word(const char* str, const lse_text_style* style, lse_text_word_info* out);
 
+lse_text_layout lse_text_layout_init();
+void lse_text_layout_drop(lse_text_layout* layout);
+
+/**
+ * Bring the layout up to date with text and style.
+ *
+ * If the layout was computed from the same inputs, it is reused as is. A layout is also reused when only the wrap width
+ * changed, but the new wrap width is between the longest line and the wrap width the layout was computed with, as the
+ * line breaks cannot change in that range. This is the common case of yoga measuring with an "at most" width followed
+ * by a paint at the resulting width.
+ *
+ * If the font is not ready, the layout is cleared (no lines, zero size).
+ *
+ * @return true if the layout was recomputed; false if the existing layout was reused
+ */
+bool lse_text_layout_update(lse_text_layout* layout, lse_string* text, const lse_text_style* style);
+
+/**
+ * Force the next lse_text_layout_update() to recompute, for changes the inputs do not capture (font finished loading).
+ */
+void lse_text_layout_invalidate(lse_text_layout* layout);
+
+size_t lse_text_layout_get_line_count(lse_text_layout* layout);
+const lse_text_layout_line* lse_text_layout_get_line(lse_text_layout* layout, size_t i);
+const lse_text_layout_glyph* lse_text_layout_get_glyph(lse_text_layout* layout, size_t i);
+
 uint32_t lse_text_peek(const char* utf8, const lse_text_style* style);
 const char* lse_text_next(const char* utf8);
\ No newline at end of file
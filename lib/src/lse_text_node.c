@@ -26,6 +26,7 @@ struct lse_text_node {
   lse_node_base base;
   lse_string* text;
   lse_font* font;
+  lse_text_layout layout;
 };
 
 static YGSize
@@ -40,6 +41,8 @@ static void constructor(lse_object* obj, void* arg) {
 
   lse_node_base_constructor(node, (lse_window*)arg);
 
+  ((lse_text_node*)node)->layout = lse_text_layout_init();
+
   YGNodeSetNodeType(base->yg_node, YGNodeTypeText);
   YGNodeSetMeasureFunc(base->yg_node, &measure);
 
@@ -52,6 +55,7 @@ static void destructor(lse_object* obj) {
   lse_text_node* self = (lse_text_node*)obj;
 
   lse_node_base_destructor(node);
+  lse_text_layout_drop(&self->layout);
   lse_unref(self->text);
 }
 
@@ -69,6 +73,7 @@ static void destroy(lse_node* node) {
     self->font = NULL;
   }
 
+  lse_text_layout_drop(&self->layout);
   lse_node_base_destroy(node);
 }
 
@@ -85,6 +90,12 @@ static void on_composite(lse_node* node, lse_graphics* graphics) {
   lse_graphics_draw_render_object(graphics, base->surface, lse_style_get_color_t(style, LSE_SP_COLOR));
 }
 
+// @override
+static bool get_opaque_rect(lse_node* node, lse_graphics* graphics, lse_rect_f* rect) {
+  // glyphs are anti-aliased
+  return false;
+}
+
 // @override
 static void on_paint(lse_node* node, lse_graphics* graphics) {
   lse_text_node* self = (lse_text_node*)node;
@@ -111,7 +122,8 @@ static void on_paint(lse_node* node, lse_graphics* graphics) {
   //  }
 
   if (lse_font_is_ready(self->font)) {
-    lse_graphics_queue_draw_text(graphics, &box, &text_style, self->text);
+    lse_text_layout_update(&self->layout, self->text, &text_style);
+    lse_graphics_queue_draw_text(graphics, &box, &text_style, &self->layout);
   }
 
   //  if (lse_style_has_border_layout(node)) {
@@ -142,9 +154,13 @@ static void on_style_resolve(lse_node* node) {
     }
   }
 
-  if (lse_node_has_flag(node, LSE_NODE_FLAG_BOUNDS | LSE_NODE_FLAG_TEXT | LSE_NODE_FLAG_COLOR)) {
+  if (lse_node_has_flag(node, LSE_NODE_FLAG_BOUNDS | LSE_NODE_FLAG_TEXT)) {
     lse_node_unset_flag(node, LSE_NODE_FLAG_BOUNDS | LSE_NODE_FLAG_TEXT | LSE_NODE_FLAG_COLOR);
     lse_node_request_paint(node);
+  } else if (lse_node_has_flag(node, LSE_NODE_FLAG_COLOR)) {
+    // the text surface is tinted with color at composite time
+    lse_node_unset_flag(node, LSE_NODE_FLAG_COLOR);
+    lse_node_request_composite(node);
   }
 }
 
@@ -200,7 +216,8 @@ measure(YGNodeRef nodeRef, float width, YGMeasureMode width_mode, float height,
             .height = height,
         });
 
-    lse_text_measure(self->text, &text_style, &size);
+    lse_text_layout_update(&self->layout, self->text, &text_style);
+    size = self->layout.size;
   } else {
     size = (lse_size){ 0 };
   }
@@ -278,6 +295,7 @@ LSE_API lse_string* LSE_CDECL lse_node_get_text(lse_node* node) {
 // @private
 static void on_font_event(const lse_font_event* e, void* observer) {
   if (e->state == LSE_RESOURCE_STATE_READY) {
+    lse_text_layout_invalidate(&((lse_text_node*)observer)->layout);
     YGNodeMarkDirty(lse_node_get_base(observer)->yg_node);
   }
 }
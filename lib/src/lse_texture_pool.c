@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_texture_pool.h"
+
+#define i_tag pooled_textures
+#define i_val lse_pooled_texture
+#define i_opt c_no_clone | c_no_cmp | c_is_fwd
+#include <stc/cvec.h>
+
+#define BYTES_PER_PIXEL 4
+#define SMALL_BUCKET_MAX 256
+#define SMALL_BUCKET_MIN 8
+#define LARGE_BUCKET_ALIGNMENT 64
+
+static int64_t get_byte_size(const lse_pooled_texture* texture);
+static void destroy_texture(lse_texture_pool* pool, const lse_pooled_texture* texture);
+
+lse_texture_pool lse_texture_pool_init(
+    lse_texture_pool_create_function create,
+    lse_texture_pool_destroy_function destroy,
+    void* user_data,
+    int64_t max_pooled_bytes) {
+  return (lse_texture_pool){
+    .create = create,
+    .destroy = destroy,
+    .user_data = user_data,
+    .max_pooled_bytes = max_pooled_bytes,
+    .textures = cvec_pooled_textures_init(),
+  };
+}
+
+void lse_texture_pool_drop(lse_texture_pool* pool) {
+  if (!pool) {
+    return;
+  }
+
+  c_foreach(it, cvec_pooled_textures, pool->textures) {
+    destroy_texture(pool, it.ref);
+  }
+
+  cvec_pooled_textures_drop(&pool->textures);
+  pool->textures = cvec_pooled_textures_init();
+  pool->stats.pooled_bytes = 0;
+}
+
+lse_pooled_texture lse_texture_pool_acquire(lse_texture_pool* pool, int32_t access, int32_t width, int32_t height) {
+  lse_pooled_texture texture = {
+    .access = access,
+    .width = lse_texture_pool_get_bucket_size(width),
+    .height = lse_texture_pool_get_bucket_size(height),
+  };
+  const lse_pooled_texture* candidate;
+
+  if (texture.width <= 0 || texture.height <= 0) {
+    return texture;
+  }
+
+  // most recently released first, as that texture is most likely to be the one the caller just gave back
+  for (size_t i = cvec_pooled_textures_size(pool->textures); i > 0; i--) {
+    candidate = cvec_pooled_textures_at(&pool->textures, i - 1);
+
+    if (candidate->access == texture.access && candidate->width == texture.width
+        && candidate->height == texture.height) {
+      texture = *candidate;
+      cvec_pooled_textures_erase_n(&pool->textures, i - 1, 1);
+      pool->stats.pooled_bytes -= get_byte_size(&texture);
+      pool->stats.hits++;
+
+      return texture;
+    }
+  }
+
+  pool->stats.misses++;
+  texture.handle = pool->create(pool->user_data, texture.access, texture.width, texture.height);
+
+  if (texture.handle) {
+    pool->stats.resident_bytes += get_byte_size(&texture);
+  }
+
+  return texture;
+}
+
+void lse_texture_pool_release(lse_texture_pool* pool, const lse_pooled_texture* texture) {
+  int64_t size;
+
+  if (!texture->handle) {
+    return;
+  }
+
+  size = get_byte_size(texture);
+
+  if (size > pool->max_pooled_bytes) {
+    destroy_texture(pool, texture);
+    return;
+  }
+
+  // make room by evicting the least recently released textures
+  while (pool->stats.pooled_bytes + size > pool->max_pooled_bytes) {
+    const lse_pooled_texture* oldest = cvec_pooled_textures_at(&pool->textures, 0);
+
+    pool->stats.pooled_bytes -= get_byte_size(oldest);
+    destroy_texture(pool, oldest);
+    cvec_pooled_textures_erase_n(&pool->textures, 0, 1);
+  }
+
+  cvec_pooled_textures_push_back(&pool->textures, *texture);
+  pool->stats.pooled_bytes += size;
+}
+
+int32_t lse_texture_pool_get_bucket_size(int32_t size) {
+  int32_t bucket;
+
+  if (size <= 0) {
+    return 0;
+  }
+
+  if (size > SMALL_BUCKET_MAX) {
+    return ((size + LARGE_BUCKET_ALIGNMENT - 1) / LARGE_BUCKET_ALIGNMENT) * LARGE_BUCKET_ALIGNMENT;
+  }
+
+  bucket = SMALL_BUCKET_MIN;
+
+  while (bucket < size) {
+    bucket <<= 1;
+  }
+
+  return bucket;
+}
+
+const lse_texture_pool_stats* lse_texture_pool_get_stats(lse_texture_pool* pool) {
+  return &pool->stats;
+}
+
+// @private
+static int64_t get_byte_size(const lse_pooled_texture* texture) {
+  return (int64_t)texture->width * (int64_t)texture->height * BYTES_PER_PIXEL;
+}
+
+// @private
+static void destroy_texture(lse_texture_pool* pool, const lse_pooled_texture* texture) {
+  pool->destroy(pool->user_data, texture->handle);
+  pool->stats.resident_bytes -= get_byte_size(texture);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include "lse_types.h"
+
+#include <stc/forward.h>
+
+typedef struct lse_pooled_texture lse_pooled_texture;
+typedef struct lse_texture_pool lse_texture_pool;
+typedef struct lse_texture_pool_stats lse_texture_pool_stats;
+
+typedef void* (*lse_texture_pool_create_function)(void* user_data, int32_t access, int32_t width, int32_t height);
+typedef void (*lse_texture_pool_destroy_function)(void* user_data, void* texture);
+
+struct lse_pooled_texture {
+  // backend texture or NULL
+  void* handle;
+  // backend specific access mode (static, render target, etc)
+  int32_t access;
+  // bucket dimensions of the texture. content is usually smaller and should be drawn with a src rect.
+  int32_t width;
+  int32_t height;
+};
+
+struct lse_texture_pool_stats {
+  uint64_t hits;
+  uint64_t misses;
+  // bytes of all textures created by the pool that have not been destroyed, borrowed or not
+  int64_t resident_bytes;
+  // bytes of textures waiting in the pool to be borrowed
+  int64_t pooled_bytes;
+};
+
+forward_cvec(cvec_pooled_textures, lse_pooled_texture);
+
+/**
+ * Recycles backend textures between render objects.
+ *
+ * Texture sizes are rounded up to buckets, so a texture can be reused by content that is a bit smaller or bigger than
+ * the content it was created for. When a render object is repainted at a slightly different size (resize, width
+ * animation, etc), the render object gets its texture back from the pool rather than a new allocation.
+ *
+ * The pool only does bookkeeping. The backend supplies create and destroy functions for the actual textures.
+ */
+struct lse_texture_pool {
+  lse_texture_pool_create_function create;
+  lse_texture_pool_destroy_function destroy;
+  void* user_data;
+  int64_t max_pooled_bytes;
+  // least recently released first
+  cvec_pooled_textures textures;
+  lse_texture_pool_stats stats;
+};
+
+lse_texture_pool lse_texture_pool_init(
+    lse_texture_pool_create_function create,
+    lse_texture_pool_destroy_function destroy,
+    void* user_data,
+    int64_t max_pooled_bytes);
+
+/**
+ * Destroy all pooled textures. Borrowed textures are not tracked and must be destroyed by their owners.
+ */
+void lse_texture_pool_drop(lse_texture_pool* pool);
+
+/**
+ * Borrow a texture that can hold width x height pixels.
+ *
+ * Returns a pooled texture of the same bucket and access if available. Otherwise, a new texture is created. On
+ * failure, the returned handle is NULL.
+ */
+lse_pooled_texture lse_texture_pool_acquire(lse_texture_pool* pool, int32_t access, int32_t width, int32_t height);
+
+/**
+ * Return a borrowed texture to the pool.
+ *
+ * If pooled textures exceed max_pooled_bytes, the least recently released textures are destroyed.
+ */
+void lse_texture_pool_release(lse_texture_pool* pool, const lse_pooled_texture* texture);
+
+/**
+ * Round a texture dimension up to its bucket: the next power of two up to 256px, then the next multiple of 64px.
+ */
+int32_t lse_texture_pool_get_bucket_size(int32_t size);
+
+const lse_texture_pool_stats* lse_texture_pool_get_stats(lse_texture_pool* pool);
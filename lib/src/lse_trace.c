@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_trace.h"
+
+#if LSE_CFG_TRACE
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// all spans are written from the main thread, so a single tid is used. async spans are grouped by id instead.
+#define TRACE_PID 1
+#define TRACE_TID 1
+
+static FILE* s_trace_file = NULL;
+static int32_t s_trace_open_count = 0;
+static bool s_trace_has_events = false;
+static uint64_t s_trace_next_id = 1;
+
+static void write_event_prefix(void);
+
+void lse_trace_open(void) {
+  const char* filename;
+
+  if (s_trace_open_count++ > 0) {
+    return;
+  }
+
+  filename = getenv(VAR_LSE_TRACE_FILE);
+
+  if (!filename || !filename[0]) {
+    return;
+  }
+
+  s_trace_file = fopen(filename, "w");
+
+  if (!s_trace_file) {
+    LSE_LOG_ERROR("cannot open trace file: %s", filename);
+    return;
+  }
+
+  s_trace_has_events = false;
+  fputs("[\n", s_trace_file);
+}
+
+void lse_trace_close(void) {
+  if (s_trace_open_count == 0 || --s_trace_open_count > 0) {
+    return;
+  }
+
+  if (s_trace_file) {
+    fputs("\n]\n", s_trace_file);
+    fclose(s_trace_file);
+    s_trace_file = NULL;
+  }
+}
+
+bool lse_trace_is_enabled(void) {
+  return s_trace_file != NULL;
+}
+
+void lse_trace_span(
+    const char* category,
+    const char* name,
+    double start_ms,
+    double end_ms,
+    const char* args_format,
+    ...) {
+  va_list args;
+
+  if (!s_trace_file) {
+    return;
+  }
+
+  write_event_prefix();
+  fprintf(
+      s_trace_file,
+      "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%i,\"tid\":%i",
+      name,
+      category,
+      start_ms * 1000.0,
+      (end_ms - start_ms) * 1000.0,
+      TRACE_PID,
+      TRACE_TID);
+
+  if (args_format) {
+    fputs(",\"args\":{", s_trace_file);
+    va_start(args, args_format);
+    vfprintf(s_trace_file, args_format, args);
+    va_end(args);
+    fputc('}', s_trace_file);
+  }
+
+  fputc('}', s_trace_file);
+}
+
+void lse_trace_async_span(const char* category, const char* name, uint64_t id, double start_ms, double end_ms) {
+  static const char phases[] = { 'b', 'e' };
+  const double timestamps[] = { start_ms, end_ms };
+
+  if (!s_trace_file) {
+    return;
+  }
+
+  for (int32_t i = 0; i < 2; i++) {
+    write_event_prefix();
+    fprintf(
+        s_trace_file,
+        "{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"id\":\"0x%llx\",\"ts\":%.3f,\"pid\":%i,\"tid\":%i}",
+        name,
+        category,
+        phases[i],
+        (unsigned long long)id,
+        timestamps[i] * 1000.0,
+        TRACE_PID,
+        TRACE_TID);
+  }
+}
+
+uint64_t lse_trace_next_id(void) {
+  return s_trace_next_id++;
+}
+
+// @private
+static void write_event_prefix(void) {
+  if (s_trace_has_events) {
+    fputs(",\n", s_trace_file);
+  } else {
+    s_trace_has_events = true;
+  }
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include "lse_cfg.h"
+#include "lse_types.h"
+
+/*
+ * Chrome trace_event export.
+ *
+ * When the library is built with LSE_CFG_TRACE and the VAR_LSE_TRACE_FILE environment variable names a file, spans
+ * are written to that file as a trace_event JSON array, which can be loaded in Perfetto or chrome://tracing. Without
+ * LSE_CFG_TRACE, the LSE_TRACE_* macros compile to nothing.
+ *
+ * Spans are written from the main thread only. Work done on the thread pool is timed on the pool thread and written
+ * when the task completes on the main thread.
+ */
+
+#if LSE_CFG_TRACE
+
+#include "lse_util.h"
+
+// declare VAR and set it to the span start time
+#define LSE_TRACE_BEGIN(VAR) const double VAR = lse_get_time_ms()
+// write a span from VAR until now
+#define LSE_TRACE_END(VAR, CATEGORY, NAME) lse_trace_span((CATEGORY), (NAME), (VAR), lse_get_time_ms(), NULL)
+// write a span from VAR until now, with a printf style fragment of the json args object
+#define LSE_TRACE_END_ARGS(VAR, CATEGORY, NAME, ARGS_FORMAT, ...)                                                      \
+  lse_trace_span((CATEGORY), (NAME), (VAR), lse_get_time_ms(), (ARGS_FORMAT), __VA_ARGS__)
+#define LSE_TRACE_OPEN() lse_trace_open()
+#define LSE_TRACE_CLOSE() lse_trace_close()
+
+/**
+ * Open the trace file named by the VAR_LSE_TRACE_FILE environment variable. Calls nest; the file is closed when the
+ * last lse_trace_open() is matched by lse_trace_close().
+ */
+void lse_trace_open(void);
+void lse_trace_close(void);
+bool lse_trace_is_enabled(void);
+
+/**
+ * Write a complete ("X") span on the main thread. Times are from lse_get_time_ms(). args_format can be NULL.
+ */
+void lse_trace_span(
+    const char* category,
+    const char* name,
+    double start_ms,
+    double end_ms,
+    const char* args_format,
+    ...);
+
+/**
+ * Write an async ("b" / "e") span. Async spans with the same category and id are grouped in one track, so overlapping
+ * spans, like concurrent thread pool tasks, stay readable.
+ */
+void lse_trace_async_span(const char* category, const char* name, uint64_t id, double start_ms, double end_ms);
+
+/**
+ * Get a new id for lse_trace_async_span().
+ */
+uint64_t lse_trace_next_id(void);
+
+#else
+
+#define LSE_TRACE_BEGIN(VAR)
+#define LSE_TRACE_END(VAR, CATEGORY, NAME)
+#define LSE_TRACE_END_ARGS(VAR, CATEGORY, NAME, ARGS_FORMAT, ...)
+#define LSE_TRACE_OPEN()
+#define LSE_TRACE_CLOSE()
+
+#endif
@@ -44,6 +44,9 @@ typedef struct lse_text_line_info lse_text_line_info;
 typedef struct lse_text_whitespace lse_text_whitespace;
 typedef struct lse_text_word_info lse_text_word_info;
 typedef struct lse_text_style lse_text_style;
+typedef struct lse_text_layout lse_text_layout;
+typedef struct lse_text_layout_line lse_text_layout_line;
+typedef struct lse_text_layout_glyph lse_text_layout_glyph;
 
 typedef enum {
   lse_display_mode_type = 128,
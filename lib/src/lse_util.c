@@ -11,11 +11,30 @@
  * specific language governing permissions and limitations under the License.
  */
 
+// clock_gettime() is hidden by strict c99 headers
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
 #include "lse_util.h"
 
 #include <math.h>
+#include <string.h>
 #include <Yoga.h>
 
+#if defined(_WIN32)
+#include <direct.h>
+#include <windows.h>
+#define getcwd _getcwd
+#define is_path_separator(C) ((C) == '/' || (C) == '\\')
+#define is_absolute_path(P) (is_path_separator((P)[0]) || ((P)[0] && (P)[1] == ':'))
+#else
+#include <time.h>
+#include <unistd.h>
+#define is_path_separator(C) ((C) == '/')
+#define is_absolute_path(P) is_path_separator((P)[0])
+#endif
+
 // TODO: make configurable (?)
 #define LSE_POINT_SCALE_FACTOR 1.f
 
@@ -87,3 +106,110 @@ float lse_clamp_f(float value, float lo, float hi) {
 const char* lse_ensure_string(const char* str) {
   return str ? str : "";
 }
+
+bool lse_normalize_path(const char* path, char* out, size_t out_size) {
+  size_t len;
+  size_t root;
+  size_t read;
+  size_t write;
+  size_t segment;
+
+  path = lse_ensure_string(path);
+
+  if (is_absolute_path(path)) {
+    len = strlen(path);
+
+    if (len >= out_size) {
+      return false;
+    }
+
+    memcpy(out, path, len + 1);
+  } else {
+    if (!getcwd(out, out_size)) {
+      return false;
+    }
+
+    len = strlen(out);
+
+    if (len + 1 + strlen(path) >= out_size) {
+      return false;
+    }
+
+    out[len++] = '/';
+    strcpy(out + len, path);
+  }
+
+  // keep the root ("/" or a drive letter) as is
+  root = (out[0] && out[1] == ':') ? 2 : 0;
+
+  if (is_path_separator(out[root])) {
+    out[root++] = '/';
+  }
+
+  read = write = root;
+
+  // segments are copied in place. write never passes read, because segments are only dropped or shortened.
+  while (out[read]) {
+    segment = read;
+
+    while (out[read] && !is_path_separator(out[read])) {
+      read++;
+    }
+
+    len = read - segment;
+
+    if (out[read]) {
+      read++;
+    }
+
+    if (len == 0 || (len == 1 && out[segment] == '.')) {
+      continue;
+    }
+
+    if (len == 2 && out[segment] == '.' && out[segment + 1] == '.') {
+      // drop the last written segment, but never the root
+      if (write > root) {
+        write--;
+
+        while (write > root && out[write - 1] != '/') {
+          write--;
+        }
+      }
+      continue;
+    }
+
+    memmove(out + write, out + segment, len);
+    write += len;
+    out[write++] = '/';
+  }
+
+  // trailing separator, unless the path is only the root
+  if (write > root && out[write - 1] == '/') {
+    write--;
+  }
+
+  out[write] = '\0';
+
+  return true;
+}
+
+double lse_get_time_ms(void) {
+#if defined(_WIN32)
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+
+  if (!frequency.QuadPart) {
+    QueryPerformanceFrequency(&frequency);
+  }
+
+  QueryPerformanceCounter(&counter);
+
+  return (double)counter.QuadPart * 1000.0 / (double)frequency.QuadPart;
+#else
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (double)now.tv_sec * 1000.0 + (double)now.tv_nsec / 1000000.0;
+#endif
+}
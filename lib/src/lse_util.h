@@ -47,3 +47,17 @@ float lse_snap_to_pixel_grid_f(float value);
 float lse_clamp_f(float value, float lo, float hi);
 
 const char* lse_ensure_string(const char* str);
+
+/**
+ * Convert a file path to an absolute path without "." or ".." segments and repeated separators.
+ *
+ * Relative paths are resolved against the current working directory. The path is normalized lexically, so it does not
+ * have to exist and symbolic links are not resolved. Returns false if the working directory cannot be determined or
+ * the result does not fit in out_size bytes.
+ */
+bool lse_normalize_path(const char* path, char* out, size_t out_size);
+
+/**
+ * Monotonic clock in milliseconds. Only differences between two readings are meaningful.
+ */
+double lse_get_time_ms(void);
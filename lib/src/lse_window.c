@@ -13,6 +13,7 @@
 
 #include "lse_window.h"
 
+#include "lse_animation.h"
 #include "lse_env.h"
 #include "lse_graphics.h"
 #include "lse_graphics_container.h"
@@ -34,13 +35,21 @@ struct lse_window {
   int32_t height;
   int32_t refresh_rate;
   uint32_t flags;
+  uint64_t skipped_frame_count;
+  // stats of the last presented frame
+  lse_render_stats render_stats;
+  uint32_t culled_node_count;
+  int32_t batch_depth;
 
   lse_graphics_container* graphics_container;
   lse_image_store* image_store;
+  lse_animator animator;
 
   lse_style_context style_context;
 };
 
+static void update_vsync_flag(lse_window* window, lse_graphics_base* graphics);
+
 static void on_image_removed(const lse_image_event* e, void* observer) {
   lse_window* window = observer;
   lse_graphics_container* container = window->graphics_container;
@@ -51,6 +60,18 @@ static void on_image_removed(const lse_image_event* e, void* observer) {
   }
 }
 
+static void on_image_reload(lse_image* image, void* user_data) {
+  lse_window* window = user_data;
+
+  lse_image_store_reload_image(window->image_store, image, LSE_IMAGE_STORE_ASYNC);
+}
+
+static void on_image_uploaded(lse_image* image, void* user_data) {
+  lse_window* window = user_data;
+
+  lse_image_store_on_image_uploaded(window->image_store, image, window);
+}
+
 static void constructor(lse_object* object, void* arg) {
   lse_window* self = (lse_window*)object;
 
@@ -61,8 +82,11 @@ static void constructor(lse_object* object, void* arg) {
   self->style_context.root_font_size_px = LSE_DEFAULT_FONT_SIZE_PX;
 
   self->title = lse_string_new_empty();
+  self->animator = lse_animator_init();
 
-  self->image_store = lse_new(lse_image_store, arg);
+  // decoded images are shared with the other windows of the env. the window keeps its own textures.
+  self->image_store = self->env->images;
+  lse_ref(self->image_store);
   lse_image_store_add_observer(self->image_store, self, &on_image_removed);
 }
 
@@ -91,11 +115,12 @@ void lse_window_destroy(lse_window* window) {
     return;
   }
 
+  lse_animator_drop(&window->animator);
+
   // TODO: this destroys the native scene graph, but not the js one. needs a fix.
   lse_node_destroy(window->root);
 
   lse_image_store_remove_observer(window->image_store, window);
-  lse_image_store_destroy(window->image_store);
 
   if (window->graphics_container) {
     lse_graphics_container_destroy(window->graphics_container);
@@ -120,6 +145,7 @@ LSE_API bool LSE_CDECL lse_window_is_destroyed(lse_window* window) {
 LSE_API lse_status LSE_CDECL lse_window_configure(lse_window* window, const lse_window_settings* settings) {
   lse_status status;
   lse_graphics_container* container;
+  lse_graphics_base* graphics;
 
   if (lse_window_is_destroyed(window)) {
     return LSE_ERR_EOL;
@@ -149,6 +175,17 @@ LSE_API lse_status LSE_CDECL lse_window_configure(lse_window* window, const lse_
   window->height = lse_graphics_container_get_height(container);
   window->graphics_container = container;
 
+  graphics = lse_graphics_get_base(lse_graphics_container_get_base(container)->graphics);
+  // evicted image textures are uploaded again from pixels decoded by the image store
+  lse_graphics_set_reload_image_callback((lse_graphics*)graphics, &on_image_reload, window);
+  lse_graphics_set_image_uploaded_callback((lse_graphics*)graphics, &on_image_uploaded, window);
+  window->refresh_rate = graphics->refresh_rate;
+  update_vsync_flag(window, graphics);
+
+  // one window per env: frames are paced to the display of the last configured window
+  lse_frame_pacer_set_display(
+      &window->env->frame_pacer, graphics->refresh_rate, graphics->is_vsync_enabled, graphics->can_set_vsync);
+
   lse_image_store_attach(window->image_store);
 
   window->style_context.view_width = (float)window->width;
@@ -158,6 +195,9 @@ LSE_API lse_status LSE_CDECL lse_window_configure(lse_window* window, const lse_
 
   lse_style_update_dynamic_units(window->root, true, false);
 
+  // the first frame must be presented, even if the scene graph is empty
+  lse_node_request_composite(window->root);
+
   return status;
 }
 
@@ -195,6 +235,74 @@ LSE_API uint32_t LSE_CDECL lse_window_get_flags(lse_window* window) {
   return window->flags;
 }
 
+LSE_API uint64_t LSE_CDECL lse_window_get_skipped_frame_count(lse_window* window) {
+  return window->skipped_frame_count;
+}
+
+LSE_API uint32_t LSE_CDECL lse_window_get_draw_call_count(lse_window* window) {
+  return (uint32_t)window->render_stats.draw_calls;
+}
+
+LSE_API uint32_t LSE_CDECL lse_window_get_culled_node_count(lse_window* window) {
+  return window->culled_node_count;
+}
+
+LSE_API void LSE_CDECL lse_window_get_render_stats(lse_window* window, bool cumulative, lse_render_stats* stats) {
+  lse_graphics_container* container = window->graphics_container;
+  lse_graphics* graphics = container ? lse_graphics_container_get_base(container)->graphics : NULL;
+
+  if (!cumulative) {
+    *stats = window->render_stats;
+  } else if (graphics) {
+    *stats = *lse_graphics_get_render_stats(graphics, true);
+  } else {
+    *stats = (lse_render_stats){ 0 };
+  }
+}
+
+LSE_API void LSE_CDECL lse_window_begin_batch(lse_window* window) {
+  window->batch_depth++;
+}
+
+LSE_API void LSE_CDECL lse_window_end_batch(lse_window* window) {
+  if (window->batch_depth == 0) {
+    return;
+  }
+
+  window->batch_depth--;
+
+  // run the layout and resolve deferred by the mutations in the batch
+  if (window->batch_depth == 0 && !lse_window_is_destroyed(window)) {
+    lse_root_node_inline_layout(window->root);
+  }
+}
+
+LSE_API int32_t LSE_CDECL lse_window_animate(
+    lse_window* window,
+    lse_node* node,
+    lse_style** keyframes,
+    const float* offsets,
+    size_t keyframe_count,
+    const lse_animation_settings* settings) {
+  if (lse_window_is_destroyed(window) || !node || lse_node_get_base(node)->window != window) {
+    return 0;
+  }
+
+  return lse_animator_add(&window->animator, node, keyframes, offsets, keyframe_count, settings);
+}
+
+LSE_API bool LSE_CDECL lse_window_cancel_animation(lse_window* window, int32_t animation_id) {
+  return lse_animator_cancel(&window->animator, animation_id);
+}
+
+LSE_API bool LSE_CDECL lse_window_is_animating(lse_window* window, int32_t animation_id) {
+  return lse_animator_has_animation(&window->animator, animation_id);
+}
+
+bool lse_window_is_batching(lse_window* window) {
+  return window->batch_depth > 0;
+}
+
 LSE_API lse_node* LSE_CDECL lse_window_create_node_from_tag(lse_window* window, const char* tag) {
   uint8_t type = lse_none_type;
 
@@ -211,23 +319,59 @@ LSE_API lse_node* LSE_CDECL lse_window_create_node_from_tag(lse_window* window,
   return type != lse_none_type ? (lse_node*)lse_object_new(type, window) : NULL;
 }
 
-void lse_window_present(lse_window* window) {
+bool lse_window_present(lse_window* window) {
   lse_graphics* graphics;
   lse_graphics_container* graphics_container = window->graphics_container;
 
   if (!graphics_container) {
-    return;
+    return false;
+  }
+
+  // animations write into node styles, so they run before the dirty check to schedule the frame they change
+  lse_animator_step(&window->animator, lse_get_time_ms());
+
+  // nothing changed since the last presented frame, so the screen is already up to date
+  if (!lse_root_node_is_dirty(window->root)) {
+    window->skipped_frame_count++;
+    return false;
   }
 
   graphics = lse_graphics_container_begin_frame(graphics_container);
 
   if (!graphics) {
-    return;
+    return false;
   }
 
+  lse_graphics_begin_render_stats(graphics);
+
   lse_root_node_update(window->root, graphics, (float)window->width, (float)window->height);
+  window->culled_node_count = lse_root_node_get_culled_node_count(window->root);
 
   lse_graphics_container_end_frame(graphics_container);
+
+  // read after end frame, as the backend may submit batched draws when the frame ends
+  window->render_stats = *lse_graphics_get_render_stats(graphics, false);
+
+  return true;
+}
+
+void lse_window_set_vsync(lse_window* window, bool enabled) {
+  lse_graphics_container* container = window->graphics_container;
+  lse_graphics* graphics = container ? lse_graphics_container_get_base(container)->graphics : NULL;
+
+  if (!graphics) {
+    return;
+  }
+
+  lse_graphics_set_vsync(graphics, enabled);
+  update_vsync_flag(window, lse_graphics_get_base(graphics));
+}
+
+void lse_window_invalidate(lse_window* window) {
+  // nothing was drawn without a graphics container, or the window was destroyed
+  if (window->graphics_container) {
+    lse_root_node_invalidate(window->root);
+  }
 }
 
 const lse_style_context* lse_window_get_style_context(lse_window* window) {
@@ -253,6 +397,14 @@ void lse_window_destroy_render_object(lse_window* window, lse_render_object* ren
   }
 }
 
+static void update_vsync_flag(lse_window* window, lse_graphics_base* graphics) {
+  if (graphics->is_vsync_enabled) {
+    window->flags |= LSE_WINDOW_FLAG_VSYNC;
+  } else {
+    window->flags &= ~LSE_WINDOW_FLAG_VSYNC;
+  }
+}
+
 // ////////////////////////////////////////////////////////////////////////////
 // Export type information for lse_object.c:register_types().
 // ////////////////////////////////////////////////////////////////////////////
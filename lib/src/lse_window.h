@@ -23,7 +23,16 @@ lse_env* lse_window_get_env(lse_window* window);
 
 lse_image_store* lse_window_get_image_store(lse_window* window);
 void lse_window_destroy(lse_window* window);
-void lse_window_present(lse_window* window);
+/**
+ * Draw and present the window if anything changed since the last frame. Returns true if a frame was presented.
+ */
+bool lse_window_present(lse_window* window);
+void lse_window_set_vsync(lse_window* window, bool enabled);
+/**
+ * Redraw the whole window in the next frame, e.g. after it was exposed or the renderer reset its render targets.
+ */
+void lse_window_invalidate(lse_window* window);
+bool lse_window_is_batching(lse_window* window);
 
 const lse_style_context* lse_window_get_style_context(lse_window* window);
 void lse_window_dispatch_root_font_size_change(lse_window* window, float root_font_size);
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_bench.h"
+
+#include <stdio.h>
+
+lse_bench_timer lse_bench_timer_start() {
+  return (lse_bench_timer){ .start = clock() };
+}
+
+void lse_bench_report(const char* name, size_t iterations, lse_bench_timer* timer) {
+  double elapsed_ms = ((double)(clock() - timer->start) * 1000.0) / CLOCKS_PER_SEC;
+
+  printf(
+      "%-40s %10zu iterations %10.2f ms %10.3f us/iteration\n",
+      name,
+      iterations,
+      elapsed_ms,
+      iterations ? (elapsed_ms * 1000.0) / (double)iterations : 0.0);
+}
+
+lse_env* lse_bench_env_new() {
+  lse_env* env = lse_env_new();
+  lse_settings settings = lse_settings_mock();
+
+  lse_env_configure(env, &settings);
+
+  return env;
+}
+
+void lse_bench_env_drop(lse_env* env) {
+  lse_env_destroy(env);
+  lse_unref(env);
+}
+
+int main(int argc, char* argv[]) {
+  lse_log_level_set(LSE_LOG_LEVEL_OFF);
+
+  lse_bench_text_measure();
+  lse_bench_tree_update();
+
+  return 0;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include <lse.h>
+#include <stddef.h>
+#include <time.h>
+
+//
+// Minimal micro benchmark helpers. Each benchmark is a function that runs a workload for a fixed number of
+// iterations and reports the per iteration time with lse_bench_report().
+//
+
+typedef struct lse_bench_timer lse_bench_timer;
+
+struct lse_bench_timer {
+  clock_t start;
+};
+
+lse_bench_timer lse_bench_timer_start();
+void lse_bench_report(const char* name, size_t iterations, lse_bench_timer* timer);
+
+lse_env* lse_bench_env_new();
+void lse_bench_env_drop(lse_env* env);
+
+//
+// benchmarks
+//
+
+void lse_bench_text_measure();
+void lse_bench_tree_update();
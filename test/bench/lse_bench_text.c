@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_bench.h"
+
+#include <lse_font.h>
+#include <lse_text.h>
+
+#define MEASURE_ITERATIONS 20000
+
+static const char* k_paragraph = "The quick brown fox jumps over the lazy dog. Pack my box with five dozen liquor jugs. "
+                                 "How vexingly quick daft zebras jump! Sphinx of black quartz, judge my vow.";
+
+static void run_measure(const char* name, lse_string* text, lse_text_style* style);
+
+/**
+ * Measure throughput of lse_text_measure() on a wrapped latin paragraph, with and without the font metrics cache.
+ *
+ * "uncached" is the FreeType lookup per codepoint path (the behavior before the metrics cache). "cached" is the same
+ * workload after the cache has been warmed.
+ */
+void lse_bench_text_measure() {
+  lse_env* env = lse_bench_env_new();
+  lse_string* text = lse_string_new(k_paragraph);
+  lse_text_style style = {
+    .font = lse_env_acquire_font(env, "default", LSE_STYLE_FONT_STYLE_NORMAL, LSE_STYLE_FONT_WEIGHT_NORMAL),
+    .font_size_px = 16,
+    .context_box = { 300.f, 1000.f },
+    .kerning_enabled = true,
+  };
+
+  lse_font_set_metrics_cache_enabled(style.font, false);
+  run_measure("text_measure uncached", text, &style);
+
+  lse_font_set_metrics_cache_enabled(style.font, true);
+  run_measure("text_measure cached", text, &style);
+
+  lse_unref(text);
+  lse_env_release_font(env, style.font);
+  lse_bench_env_drop(env);
+}
+
+// @private
+static void run_measure(const char* name, lse_string* text, lse_text_style* style) {
+  lse_size size;
+  lse_bench_timer timer = lse_bench_timer_start();
+
+  for (size_t i = 0; i < MEASURE_ITERATIONS; i++) {
+    lse_text_measure(text, style, &size);
+  }
+
+  lse_bench_report(name, MEASURE_ITERATIONS, &timer);
+}
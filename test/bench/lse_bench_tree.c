@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include "lse_bench.h"
+
+#include <lse_node.h>
+#include <lse_window.h>
+
+#define FRAME_ITERATIONS 10000
+// 10 + 100 + 1000 + 10000 nodes below the root
+#define TREE_FAN_OUT 10
+#define TREE_DEPTH 4
+#define TREE_LEAF_COUNT 10000
+
+typedef struct leaf_list leaf_list;
+
+struct leaf_list {
+  lse_node* nodes[TREE_LEAF_COUNT];
+  size_t count;
+};
+
+static void build_tree(lse_window* window, lse_node* parent, int32_t depth, leaf_list* leaves);
+
+/**
+ * Measure frame cost of a 10k node scene graph where a single leaf changes per frame.
+ *
+ * With descendant dirty bits, the resolve and paint walks only visit the path from the root to the changed leaf, so
+ * the per frame cost should stay flat as the tree grows.
+ */
+void lse_bench_tree_update() {
+  lse_env* env = lse_bench_env_new();
+  lse_window* window = lse_env_add_window(env);
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+  static leaf_list leaves;
+  lse_bench_timer timer;
+
+  lse_window_configure(window, &settings);
+  leaves.count = 0;
+  build_tree(window, lse_window_get_root(window), TREE_DEPTH, &leaves);
+
+  // settle the initial layout, resolve and paint of the whole tree
+  lse_window_present(window);
+
+  timer = lse_bench_timer_start();
+
+  for (size_t i = 0; i < FRAME_ITERATIONS; i++) {
+    lse_node_request_paint(leaves.nodes[i % leaves.count]);
+    lse_window_present(window);
+  }
+
+  lse_bench_report("tree_update paint one leaf", FRAME_ITERATIONS, &timer);
+
+  timer = lse_bench_timer_start();
+
+  for (size_t i = 0; i < FRAME_ITERATIONS; i++) {
+    lse_node_request_style_resolve(leaves.nodes[i % leaves.count], LSE_NODE_FLAG_COLOR);
+    lse_window_present(window);
+  }
+
+  lse_bench_report("tree_update resolve one leaf", FRAME_ITERATIONS, &timer);
+
+  lse_unref(window);
+  lse_bench_env_drop(env);
+}
+
+// @private
+static void build_tree(lse_window* window, lse_node* parent, int32_t depth, leaf_list* leaves) {
+  for (int32_t i = 0; i < TREE_FAN_OUT; i++) {
+    lse_node* node = lse_window_create_node_from_tag(window, LSE_NODE_TAG_BOX);
+
+    lse_node_append(parent, node);
+
+    if (depth > 1) {
+      build_tree(window, node, depth - 1, leaves);
+    } else {
+      leaves->nodes[leaves->count++] = node;
+    }
+
+    // the scene graph holds the remaining reference
+    lse_unref(node);
+  }
+}
@@ -18,6 +18,29 @@
 
 #include <lse_test.h>
 
+extern void* lse_animation_before_each(const MunitParameter params[], void* user_data);
+extern void lse_animation_after_each(void* fixture);
+extern const char* test_lse_animator_add_1_description;
+extern MunitResult test_lse_animator_add_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_add_2_description;
+extern MunitResult test_lse_animator_add_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_step_1_description;
+extern MunitResult test_lse_animator_step_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_step_2_description;
+extern MunitResult test_lse_animator_step_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_step_3_description;
+extern MunitResult test_lse_animator_step_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_step_4_description;
+extern MunitResult test_lse_animator_step_4(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_step_5_description;
+extern MunitResult test_lse_animator_step_5(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_step_6_description;
+extern MunitResult test_lse_animator_step_6(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_cancel_1_description;
+extern MunitResult test_lse_animator_cancel_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_animator_cancel_2_description;
+extern MunitResult test_lse_animator_cancel_2(const MunitParameter params[], void* fixture);
+
 extern void* lse_array_before_each(const MunitParameter params[], void* user_data);
 extern void lse_array_after_each(void* fixture);
 extern const char* test_lse_array_new_1_description;
@@ -47,6 +70,8 @@ extern const char* test_lse_env_get_display_name_2_description;
 extern MunitResult test_lse_env_get_display_name_2(const MunitParameter params[], void* fixture);
 extern const char* test_lse_env_get_current_display_mode_1_description;
 extern MunitResult test_lse_env_get_current_display_mode_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_env_get_image_cache_stats_1_description;
+extern MunitResult test_lse_env_get_image_cache_stats_1(const MunitParameter params[], void* fixture);
 extern const char* test_lse_env_get_current_display_mode_2_description;
 extern MunitResult test_lse_env_get_current_display_mode_2(const MunitParameter params[], void* fixture);
 extern const char* test_lse_env_get_desktop_display_mode_1_description;
@@ -93,6 +118,14 @@ extern const char* test_lse_font_set_error_1_description;
 extern MunitResult test_lse_font_set_error_1(const MunitParameter params[], void* fixture);
 extern const char* test_lse_font_set_loading_1_description;
 extern MunitResult test_lse_font_set_loading_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_font_get_glyph_surface_1_description;
+extern MunitResult test_lse_font_get_glyph_surface_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_font_get_glyph_surface_2_description;
+extern MunitResult test_lse_font_get_glyph_surface_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_font_get_glyph_surface_3_description;
+extern MunitResult test_lse_font_get_glyph_surface_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_font_get_glyph_surface_4_description;
+extern MunitResult test_lse_font_get_glyph_surface_4(const MunitParameter params[], void* fixture);
 
 extern void* lse_font_store_before_each(const MunitParameter params[], void* user_data);
 extern void lse_font_store_after_each(void* fixture);
@@ -111,6 +144,59 @@ extern MunitResult test_lse_font_store_add_font_2(const MunitParameter params[],
 extern const char* test_lse_font_store_add_font_3_description;
 extern MunitResult test_lse_font_store_add_font_3(const MunitParameter params[], void* fixture);
 
+extern void* lse_frame_pacer_before_each(const MunitParameter params[], void* user_data);
+extern void lse_frame_pacer_after_each(void* fixture);
+extern const char* test_lse_frame_pacer_init_1_description;
+extern MunitResult test_lse_frame_pacer_init_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_pacer_set_display_1_description;
+extern MunitResult test_lse_frame_pacer_set_display_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_pacer_set_display_2_description;
+extern MunitResult test_lse_frame_pacer_set_display_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_pacer_set_display_3_description;
+extern MunitResult test_lse_frame_pacer_set_display_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_pacer_end_frame_1_description;
+extern MunitResult test_lse_frame_pacer_end_frame_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_pacer_end_frame_2_description;
+extern MunitResult test_lse_frame_pacer_end_frame_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_pacer_end_frame_3_description;
+extern MunitResult test_lse_frame_pacer_end_frame_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_pacer_end_frame_4_description;
+extern MunitResult test_lse_frame_pacer_end_frame_4(const MunitParameter params[], void* fixture);
+
+extern void* lse_frame_timing_before_each(const MunitParameter params[], void* user_data);
+extern void lse_frame_timing_after_each(void* fixture);
+extern const char* test_lse_frame_timing_get_stats_1_description;
+extern MunitResult test_lse_frame_timing_get_stats_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_timing_get_stats_2_description;
+extern MunitResult test_lse_frame_timing_get_stats_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_timing_get_stats_3_description;
+extern MunitResult test_lse_frame_timing_get_stats_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_timing_add_1_description;
+extern MunitResult test_lse_frame_timing_add_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_frame_timing_skip_frame_1_description;
+extern MunitResult test_lse_frame_timing_skip_frame_1(const MunitParameter params[], void* fixture);
+
+extern void* lse_glyph_atlas_before_each(const MunitParameter params[], void* user_data);
+extern void lse_glyph_atlas_after_each(void* fixture);
+extern const char* test_lse_glyph_atlas_insert_1_description;
+extern MunitResult test_lse_glyph_atlas_insert_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_insert_2_description;
+extern MunitResult test_lse_glyph_atlas_insert_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_insert_3_description;
+extern MunitResult test_lse_glyph_atlas_insert_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_insert_4_description;
+extern MunitResult test_lse_glyph_atlas_insert_4(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_insert_5_description;
+extern MunitResult test_lse_glyph_atlas_insert_5(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_reset_1_description;
+extern MunitResult test_lse_glyph_atlas_reset_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_find_1_description;
+extern MunitResult test_lse_glyph_atlas_find_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_remove_1_description;
+extern MunitResult test_lse_glyph_atlas_remove_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_glyph_atlas_matches_1_description;
+extern MunitResult test_lse_glyph_atlas_matches_1(const MunitParameter params[], void* fixture);
+
 extern void* lse_image_before_each(const MunitParameter params[], void* user_data);
 extern void lse_image_after_each(void* fixture);
 extern const char* test_lse_image_constructor_1_description;
@@ -119,6 +205,8 @@ extern const char* test_lse_image_set_loading_1_description;
 extern MunitResult test_lse_image_set_loading_1(const MunitParameter params[], void* fixture);
 extern const char* test_lse_image_set_ready_1_description;
 extern MunitResult test_lse_image_set_ready_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_set_ready_2_description;
+extern MunitResult test_lse_image_set_ready_2(const MunitParameter params[], void* fixture);
 extern const char* test_lse_image_set_error_1_description;
 extern MunitResult test_lse_image_set_error_1(const MunitParameter params[], void* fixture);
 
@@ -134,10 +222,40 @@ extern const char* test_lse_image_store_acquire_4_description;
 extern MunitResult test_lse_image_store_acquire_4(const MunitParameter params[], void* fixture);
 extern const char* test_lse_image_store_acquire_5_description;
 extern MunitResult test_lse_image_store_acquire_5(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_acquire_6_description;
+extern MunitResult test_lse_image_store_acquire_6(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_acquire_at_size_1_description;
+extern MunitResult test_lse_image_store_acquire_at_size_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_acquire_at_size_2_description;
+extern MunitResult test_lse_image_store_acquire_at_size_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_acquire_at_size_3_description;
+extern MunitResult test_lse_image_store_acquire_at_size_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_acquire_at_size_4_description;
+extern MunitResult test_lse_image_store_acquire_at_size_4(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_acquire_at_size_5_description;
+extern MunitResult test_lse_image_store_acquire_at_size_5(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_acquire_at_size_6_description;
+extern MunitResult test_lse_image_store_acquire_at_size_6(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_retain_3_description;
+extern MunitResult test_lse_image_store_retain_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_get_decode_bucket_1_description;
+extern MunitResult test_lse_image_store_get_decode_bucket_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_get_decode_bucket_2_description;
+extern MunitResult test_lse_image_store_get_decode_bucket_2(const MunitParameter params[], void* fixture);
 extern const char* test_lse_image_store_release_1_description;
 extern MunitResult test_lse_image_store_release_1(const MunitParameter params[], void* fixture);
 extern const char* test_lse_image_store_release_2_description;
 extern MunitResult test_lse_image_store_release_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_reload_1_description;
+extern MunitResult test_lse_image_store_reload_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_retain_1_description;
+extern MunitResult test_lse_image_store_retain_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_retain_2_description;
+extern MunitResult test_lse_image_store_retain_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_on_image_uploaded_1_description;
+extern MunitResult test_lse_image_store_on_image_uploaded_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_image_store_on_image_uploaded_2_description;
+extern MunitResult test_lse_image_store_on_image_uploaded_2(const MunitParameter params[], void* fixture);
 
 extern void* lse_node_before_each(const MunitParameter params[], void* user_data);
 extern void lse_node_after_each(void* fixture);
@@ -153,6 +271,22 @@ extern const char* test_lse_node_insert_before_1_description;
 extern MunitResult test_lse_node_insert_before_1(const MunitParameter params[], void* fixture);
 extern const char* test_lse_node_remove_child_1_description;
 extern MunitResult test_lse_node_remove_child_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_request_paint_1_description;
+extern MunitResult test_lse_node_request_paint_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_request_style_resolve_1_description;
+extern MunitResult test_lse_node_request_style_resolve_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_on_yoga_layout_event_1_description;
+extern MunitResult test_lse_node_on_yoga_layout_event_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_on_yoga_layout_event_2_description;
+extern MunitResult test_lse_node_on_yoga_layout_event_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_on_style_resolve_1_description;
+extern MunitResult test_lse_node_on_style_resolve_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_request_composite_1_description;
+extern MunitResult test_lse_node_request_composite_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_request_group_composite_1_description;
+extern MunitResult test_lse_node_request_group_composite_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_node_set_src_1_description;
+extern MunitResult test_lse_node_set_src_1(const MunitParameter params[], void* fixture);
 
 extern void* lse_object_before_each(const MunitParameter params[], void* user_data);
 extern void lse_object_after_each(void* fixture);
@@ -163,6 +297,38 @@ extern MunitResult test_lse_object_new_2(const MunitParameter params[], void* fi
 extern const char* test_lse_object_ref_1_description;
 extern MunitResult test_lse_object_ref_1(const MunitParameter params[], void* fixture);
 
+extern void* lse_rect_before_each(const MunitParameter params[], void* user_data);
+extern void lse_rect_after_each(void* fixture);
+extern const char* test_lse_rect_f_union_1_description;
+extern MunitResult test_lse_rect_f_union_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_rect_f_union_2_description;
+extern MunitResult test_lse_rect_f_union_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_rect_f_intersects_1_description;
+extern MunitResult test_lse_rect_f_intersects_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_rect_f_intersect_1_description;
+extern MunitResult test_lse_rect_f_intersect_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_rect_f_round_out_1_description;
+extern MunitResult test_lse_rect_f_round_out_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_rect_f_round_in_1_description;
+extern MunitResult test_lse_rect_f_round_in_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_rect_f_contains_1_description;
+extern MunitResult test_lse_rect_f_contains_1(const MunitParameter params[], void* fixture);
+
+extern void* lse_sdl_graphics_before_each(const MunitParameter params[], void* user_data);
+extern void lse_sdl_graphics_after_each(void* fixture);
+extern const char* test_lse_sdl_graphics_batch_1_description;
+extern MunitResult test_lse_sdl_graphics_batch_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_sdl_graphics_batch_2_description;
+extern MunitResult test_lse_sdl_graphics_batch_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_sdl_graphics_batch_3_description;
+extern MunitResult test_lse_sdl_graphics_batch_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_sdl_graphics_batch_4_description;
+extern MunitResult test_lse_sdl_graphics_batch_4(const MunitParameter params[], void* fixture);
+extern const char* test_lse_sdl_graphics_batch_5_description;
+extern MunitResult test_lse_sdl_graphics_batch_5(const MunitParameter params[], void* fixture);
+extern const char* test_lse_sdl_graphics_batch_6_description;
+extern MunitResult test_lse_sdl_graphics_batch_6(const MunitParameter params[], void* fixture);
+
 extern void* lse_string_before_each(const MunitParameter params[], void* user_data);
 extern void lse_string_after_each(void* fixture);
 extern const char* test_lse_string_new_1_description;
@@ -226,6 +392,33 @@ extern const char* test_lse_text_measure_2_description;
 extern MunitResult test_lse_text_measure_2(const MunitParameter params[], void* fixture);
 extern const char* test_lse_text_measure_3_description;
 extern MunitResult test_lse_text_measure_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_text_measure_4_description;
+extern MunitResult test_lse_text_measure_4(const MunitParameter params[], void* fixture);
+extern const char* test_lse_text_layout_update_1_description;
+extern MunitResult test_lse_text_layout_update_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_text_layout_update_2_description;
+extern MunitResult test_lse_text_layout_update_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_text_layout_update_3_description;
+extern MunitResult test_lse_text_layout_update_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_text_layout_update_4_description;
+extern MunitResult test_lse_text_layout_update_4(const MunitParameter params[], void* fixture);
+extern const char* test_lse_text_layout_update_5_description;
+extern MunitResult test_lse_text_layout_update_5(const MunitParameter params[], void* fixture);
+
+extern void* lse_texture_pool_before_each(const MunitParameter params[], void* user_data);
+extern void lse_texture_pool_after_each(void* fixture);
+extern const char* test_lse_texture_pool_get_bucket_size_1_description;
+extern MunitResult test_lse_texture_pool_get_bucket_size_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_texture_pool_get_bucket_size_2_description;
+extern MunitResult test_lse_texture_pool_get_bucket_size_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_texture_pool_acquire_1_description;
+extern MunitResult test_lse_texture_pool_acquire_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_texture_pool_acquire_2_description;
+extern MunitResult test_lse_texture_pool_acquire_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_texture_pool_acquire_3_description;
+extern MunitResult test_lse_texture_pool_acquire_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_texture_pool_release_1_description;
+extern MunitResult test_lse_texture_pool_release_1(const MunitParameter params[], void* fixture);
 
 extern void* lse_window_before_each(const MunitParameter params[], void* user_data);
 extern void lse_window_after_each(void* fixture);
@@ -235,14 +428,45 @@ extern const char* test_lse_window_reset_1_description;
 extern MunitResult test_lse_window_reset_1(const MunitParameter params[], void* fixture);
 extern const char* test_lse_window_reset_2_description;
 extern MunitResult test_lse_window_reset_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_window_present_1_description;
+extern MunitResult test_lse_window_present_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_window_present_2_description;
+extern MunitResult test_lse_window_present_2(const MunitParameter params[], void* fixture);
+extern const char* test_lse_window_present_3_description;
+extern MunitResult test_lse_window_present_3(const MunitParameter params[], void* fixture);
+extern const char* test_lse_window_invalidate_1_description;
+extern MunitResult test_lse_window_invalidate_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_window_get_render_stats_1_description;
+extern MunitResult test_lse_window_get_render_stats_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_window_begin_batch_1_description;
+extern MunitResult test_lse_window_begin_batch_1(const MunitParameter params[], void* fixture);
+extern const char* test_lse_window_get_image_store_1_description;
+extern MunitResult test_lse_window_get_image_store_1(const MunitParameter params[], void* fixture);
 
 #define STRINGIFY(SYM) #SYM
 
 MunitSuite lse_test_runner_suite_init() {
-  MunitSuite* suites = (MunitSuite*)calloc(14 + 1, sizeof(MunitSuite));
+  MunitSuite* suites = (MunitSuite*)calloc(21 + 1, sizeof(MunitSuite));
   size_t suites_push_index = 0;
 
   lse_test_info tests_0 [] = {
+      { .name = STRINGIFY(test_lse_animator_add_1), .desc = test_lse_animator_add_1_description, .test = test_lse_animator_add_1 },
+      { .name = STRINGIFY(test_lse_animator_add_2), .desc = test_lse_animator_add_2_description, .test = test_lse_animator_add_2 },
+      { .name = STRINGIFY(test_lse_animator_step_1), .desc = test_lse_animator_step_1_description, .test = test_lse_animator_step_1 },
+      { .name = STRINGIFY(test_lse_animator_step_2), .desc = test_lse_animator_step_2_description, .test = test_lse_animator_step_2 },
+      { .name = STRINGIFY(test_lse_animator_step_3), .desc = test_lse_animator_step_3_description, .test = test_lse_animator_step_3 },
+      { .name = STRINGIFY(test_lse_animator_step_4), .desc = test_lse_animator_step_4_description, .test = test_lse_animator_step_4 },
+      { .name = STRINGIFY(test_lse_animator_step_5), .desc = test_lse_animator_step_5_description, .test = test_lse_animator_step_5 },
+      { .name = STRINGIFY(test_lse_animator_step_6), .desc = test_lse_animator_step_6_description, .test = test_lse_animator_step_6 },
+      { .name = STRINGIFY(test_lse_animator_cancel_1), .desc = test_lse_animator_cancel_1_description, .test = test_lse_animator_cancel_1 },
+      { .name = STRINGIFY(test_lse_animator_cancel_2), .desc = test_lse_animator_cancel_2_description, .test = test_lse_animator_cancel_2 },
+  };
+  MunitTestSetup tests_0_before_each = &lse_animation_before_each;
+  MunitTestTearDown tests_0_after_each = &lse_animation_after_each;
+
+  suites[suites_push_index++] = lse_test_suite_init(tests_0, sizeof(tests_0) / sizeof(tests_0[0]), tests_0_before_each, tests_0_after_each);
+
+  lse_test_info tests_1 [] = {
       { .name = STRINGIFY(test_lse_array_new_1), .desc = test_lse_array_new_1_description, .test = test_lse_array_new_1 },
       { .name = STRINGIFY(test_lse_array_new_2), .desc = test_lse_array_new_2_description, .test = test_lse_array_new_2 },
       { .name = STRINGIFY(test_lse_array_new_empty_1), .desc = test_lse_array_new_empty_1_description, .test = test_lse_array_new_empty_1 },
@@ -250,18 +474,19 @@ MunitSuite lse_test_runner_suite_init() {
       { .name = STRINGIFY(test_lse_array_get_1), .desc = test_lse_array_get_1_description, .test = test_lse_array_get_1 },
       { .name = STRINGIFY(test_lse_array_get_2), .desc = test_lse_array_get_2_description, .test = test_lse_array_get_2 },
   };
-  MunitTestSetup tests_0_before_each = &lse_array_before_each;
-  MunitTestTearDown tests_0_after_each = &lse_array_after_each;
+  MunitTestSetup tests_1_before_each = &lse_array_before_each;
+  MunitTestTearDown tests_1_after_each = &lse_array_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_0, sizeof(tests_0) / sizeof(tests_0[0]), tests_0_before_each, tests_0_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_1, sizeof(tests_1) / sizeof(tests_1[0]), tests_1_before_each, tests_1_after_each);
 
-  lse_test_info tests_1 [] = {
+  lse_test_info tests_2 [] = {
       { .name = STRINGIFY(test_lse_env_get_video_driver_1), .desc = test_lse_env_get_video_driver_1_description, .test = test_lse_env_get_video_driver_1 },
       { .name = STRINGIFY(test_lse_env_get_video_driver_2), .desc = test_lse_env_get_video_driver_2_description, .test = test_lse_env_get_video_driver_2 },
       { .name = STRINGIFY(test_lse_env_get_video_driver_count_1), .desc = test_lse_env_get_video_driver_count_1_description, .test = test_lse_env_get_video_driver_count_1 },
       { .name = STRINGIFY(test_lse_env_get_display_name_1), .desc = test_lse_env_get_display_name_1_description, .test = test_lse_env_get_display_name_1 },
       { .name = STRINGIFY(test_lse_env_get_display_name_2), .desc = test_lse_env_get_display_name_2_description, .test = test_lse_env_get_display_name_2 },
       { .name = STRINGIFY(test_lse_env_get_current_display_mode_1), .desc = test_lse_env_get_current_display_mode_1_description, .test = test_lse_env_get_current_display_mode_1 },
+      { .name = STRINGIFY(test_lse_env_get_image_cache_stats_1), .desc = test_lse_env_get_image_cache_stats_1_description, .test = test_lse_env_get_image_cache_stats_1 },
       { .name = STRINGIFY(test_lse_env_get_current_display_mode_2), .desc = test_lse_env_get_current_display_mode_2_description, .test = test_lse_env_get_current_display_mode_2 },
       { .name = STRINGIFY(test_lse_env_get_desktop_display_mode_1), .desc = test_lse_env_get_desktop_display_mode_1_description, .test = test_lse_env_get_desktop_display_mode_1 },
       { .name = STRINGIFY(test_lse_env_get_desktop_display_mode_2), .desc = test_lse_env_get_desktop_display_mode_2_description, .test = test_lse_env_get_desktop_display_mode_2 },
@@ -276,33 +501,37 @@ MunitSuite lse_test_runner_suite_init() {
       { .name = STRINGIFY(test_lse_env_get_renderer_info_2), .desc = test_lse_env_get_renderer_info_2_description, .test = test_lse_env_get_renderer_info_2 },
       { .name = STRINGIFY(test_lse_env_find_closest_display_mode_1), .desc = test_lse_env_find_closest_display_mode_1_description, .test = test_lse_env_find_closest_display_mode_1 },
   };
-  MunitTestSetup tests_1_before_each = &lse_env_before_each;
-  MunitTestTearDown tests_1_after_each = &lse_env_after_each;
+  MunitTestSetup tests_2_before_each = &lse_env_before_each;
+  MunitTestTearDown tests_2_after_each = &lse_env_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_1, sizeof(tests_1) / sizeof(tests_1[0]), tests_1_before_each, tests_1_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_2, sizeof(tests_2) / sizeof(tests_2[0]), tests_2_before_each, tests_2_after_each);
 
-  lse_test_info tests_2 [] = {
+  lse_test_info tests_3 [] = {
       { .name = STRINGIFY(test_lse_event_observers_add_1), .desc = test_lse_event_observers_add_1_description, .test = test_lse_event_observers_add_1 },
       { .name = STRINGIFY(test_lse_event_observers_remove_1), .desc = test_lse_event_observers_remove_1_description, .test = test_lse_event_observers_remove_1 },
       { .name = STRINGIFY(test_lse_event_observers_dispatch_1), .desc = test_lse_event_observers_dispatch_1_description, .test = test_lse_event_observers_dispatch_1 },
   };
-  MunitTestSetup tests_2_before_each = &lse_event_observers_before_each;
-  MunitTestTearDown tests_2_after_each = &lse_event_observers_after_each;
+  MunitTestSetup tests_3_before_each = &lse_event_observers_before_each;
+  MunitTestTearDown tests_3_after_each = &lse_event_observers_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_2, sizeof(tests_2) / sizeof(tests_2[0]), tests_2_before_each, tests_2_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_3, sizeof(tests_3) / sizeof(tests_3[0]), tests_3_before_each, tests_3_after_each);
 
-  lse_test_info tests_3 [] = {
+  lse_test_info tests_4 [] = {
       { .name = STRINGIFY(test_lse_font_constructor_1), .desc = test_lse_font_constructor_1_description, .test = test_lse_font_constructor_1 },
       { .name = STRINGIFY(test_lse_font_set_ready_1), .desc = test_lse_font_set_ready_1_description, .test = test_lse_font_set_ready_1 },
       { .name = STRINGIFY(test_lse_font_set_error_1), .desc = test_lse_font_set_error_1_description, .test = test_lse_font_set_error_1 },
       { .name = STRINGIFY(test_lse_font_set_loading_1), .desc = test_lse_font_set_loading_1_description, .test = test_lse_font_set_loading_1 },
+      { .name = STRINGIFY(test_lse_font_get_glyph_surface_1), .desc = test_lse_font_get_glyph_surface_1_description, .test = test_lse_font_get_glyph_surface_1 },
+      { .name = STRINGIFY(test_lse_font_get_glyph_surface_2), .desc = test_lse_font_get_glyph_surface_2_description, .test = test_lse_font_get_glyph_surface_2 },
+      { .name = STRINGIFY(test_lse_font_get_glyph_surface_3), .desc = test_lse_font_get_glyph_surface_3_description, .test = test_lse_font_get_glyph_surface_3 },
+      { .name = STRINGIFY(test_lse_font_get_glyph_surface_4), .desc = test_lse_font_get_glyph_surface_4_description, .test = test_lse_font_get_glyph_surface_4 },
   };
-  MunitTestSetup tests_3_before_each = &lse_font_before_each;
-  MunitTestTearDown tests_3_after_each = &lse_font_after_each;
+  MunitTestSetup tests_4_before_each = &lse_font_before_each;
+  MunitTestTearDown tests_4_after_each = &lse_font_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_3, sizeof(tests_3) / sizeof(tests_3[0]), tests_3_before_each, tests_3_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_4, sizeof(tests_4) / sizeof(tests_4[0]), tests_4_before_each, tests_4_after_each);
 
-  lse_test_info tests_4 [] = {
+  lse_test_info tests_5 [] = {
       { .name = STRINGIFY(test_lse_font_store_acquire_font_1), .desc = test_lse_font_store_acquire_font_1_description, .test = test_lse_font_store_acquire_font_1 },
       { .name = STRINGIFY(test_lse_font_store_acquire_font_2), .desc = test_lse_font_store_acquire_font_2_description, .test = test_lse_font_store_acquire_font_2 },
       { .name = STRINGIFY(test_lse_font_store_release_font_1), .desc = test_lse_font_store_release_font_1_description, .test = test_lse_font_store_release_font_1 },
@@ -311,72 +540,166 @@ MunitSuite lse_test_runner_suite_init() {
       { .name = STRINGIFY(test_lse_font_store_add_font_2), .desc = test_lse_font_store_add_font_2_description, .test = test_lse_font_store_add_font_2 },
       { .name = STRINGIFY(test_lse_font_store_add_font_3), .desc = test_lse_font_store_add_font_3_description, .test = test_lse_font_store_add_font_3 },
   };
-  MunitTestSetup tests_4_before_each = &lse_font_store_before_each;
-  MunitTestTearDown tests_4_after_each = &lse_font_store_after_each;
+  MunitTestSetup tests_5_before_each = &lse_font_store_before_each;
+  MunitTestTearDown tests_5_after_each = &lse_font_store_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_4, sizeof(tests_4) / sizeof(tests_4[0]), tests_4_before_each, tests_4_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_5, sizeof(tests_5) / sizeof(tests_5[0]), tests_5_before_each, tests_5_after_each);
 
-  lse_test_info tests_5 [] = {
+  lse_test_info tests_6 [] = {
+      { .name = STRINGIFY(test_lse_frame_pacer_init_1), .desc = test_lse_frame_pacer_init_1_description, .test = test_lse_frame_pacer_init_1 },
+      { .name = STRINGIFY(test_lse_frame_pacer_set_display_1), .desc = test_lse_frame_pacer_set_display_1_description, .test = test_lse_frame_pacer_set_display_1 },
+      { .name = STRINGIFY(test_lse_frame_pacer_set_display_2), .desc = test_lse_frame_pacer_set_display_2_description, .test = test_lse_frame_pacer_set_display_2 },
+      { .name = STRINGIFY(test_lse_frame_pacer_set_display_3), .desc = test_lse_frame_pacer_set_display_3_description, .test = test_lse_frame_pacer_set_display_3 },
+      { .name = STRINGIFY(test_lse_frame_pacer_end_frame_1), .desc = test_lse_frame_pacer_end_frame_1_description, .test = test_lse_frame_pacer_end_frame_1 },
+      { .name = STRINGIFY(test_lse_frame_pacer_end_frame_2), .desc = test_lse_frame_pacer_end_frame_2_description, .test = test_lse_frame_pacer_end_frame_2 },
+      { .name = STRINGIFY(test_lse_frame_pacer_end_frame_3), .desc = test_lse_frame_pacer_end_frame_3_description, .test = test_lse_frame_pacer_end_frame_3 },
+      { .name = STRINGIFY(test_lse_frame_pacer_end_frame_4), .desc = test_lse_frame_pacer_end_frame_4_description, .test = test_lse_frame_pacer_end_frame_4 },
+  };
+  MunitTestSetup tests_6_before_each = &lse_frame_pacer_before_each;
+  MunitTestTearDown tests_6_after_each = &lse_frame_pacer_after_each;
+
+  suites[suites_push_index++] = lse_test_suite_init(tests_6, sizeof(tests_6) / sizeof(tests_6[0]), tests_6_before_each, tests_6_after_each);
+
+  lse_test_info tests_7 [] = {
+      { .name = STRINGIFY(test_lse_frame_timing_get_stats_1), .desc = test_lse_frame_timing_get_stats_1_description, .test = test_lse_frame_timing_get_stats_1 },
+      { .name = STRINGIFY(test_lse_frame_timing_get_stats_2), .desc = test_lse_frame_timing_get_stats_2_description, .test = test_lse_frame_timing_get_stats_2 },
+      { .name = STRINGIFY(test_lse_frame_timing_get_stats_3), .desc = test_lse_frame_timing_get_stats_3_description, .test = test_lse_frame_timing_get_stats_3 },
+      { .name = STRINGIFY(test_lse_frame_timing_add_1), .desc = test_lse_frame_timing_add_1_description, .test = test_lse_frame_timing_add_1 },
+      { .name = STRINGIFY(test_lse_frame_timing_skip_frame_1), .desc = test_lse_frame_timing_skip_frame_1_description, .test = test_lse_frame_timing_skip_frame_1 },
+  };
+  MunitTestSetup tests_7_before_each = &lse_frame_timing_before_each;
+  MunitTestTearDown tests_7_after_each = &lse_frame_timing_after_each;
+
+  suites[suites_push_index++] = lse_test_suite_init(tests_7, sizeof(tests_7) / sizeof(tests_7[0]), tests_7_before_each, tests_7_after_each);
+
+  lse_test_info tests_8 [] = {
+      { .name = STRINGIFY(test_lse_glyph_atlas_insert_1), .desc = test_lse_glyph_atlas_insert_1_description, .test = test_lse_glyph_atlas_insert_1 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_insert_2), .desc = test_lse_glyph_atlas_insert_2_description, .test = test_lse_glyph_atlas_insert_2 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_insert_3), .desc = test_lse_glyph_atlas_insert_3_description, .test = test_lse_glyph_atlas_insert_3 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_insert_4), .desc = test_lse_glyph_atlas_insert_4_description, .test = test_lse_glyph_atlas_insert_4 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_insert_5), .desc = test_lse_glyph_atlas_insert_5_description, .test = test_lse_glyph_atlas_insert_5 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_reset_1), .desc = test_lse_glyph_atlas_reset_1_description, .test = test_lse_glyph_atlas_reset_1 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_find_1), .desc = test_lse_glyph_atlas_find_1_description, .test = test_lse_glyph_atlas_find_1 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_remove_1), .desc = test_lse_glyph_atlas_remove_1_description, .test = test_lse_glyph_atlas_remove_1 },
+      { .name = STRINGIFY(test_lse_glyph_atlas_matches_1), .desc = test_lse_glyph_atlas_matches_1_description, .test = test_lse_glyph_atlas_matches_1 },
+  };
+  MunitTestSetup tests_8_before_each = &lse_glyph_atlas_before_each;
+  MunitTestTearDown tests_8_after_each = &lse_glyph_atlas_after_each;
+
+  suites[suites_push_index++] = lse_test_suite_init(tests_8, sizeof(tests_8) / sizeof(tests_8[0]), tests_8_before_each, tests_8_after_each);
+
+  lse_test_info tests_9 [] = {
       { .name = STRINGIFY(test_lse_image_constructor_1), .desc = test_lse_image_constructor_1_description, .test = test_lse_image_constructor_1 },
       { .name = STRINGIFY(test_lse_image_set_loading_1), .desc = test_lse_image_set_loading_1_description, .test = test_lse_image_set_loading_1 },
       { .name = STRINGIFY(test_lse_image_set_ready_1), .desc = test_lse_image_set_ready_1_description, .test = test_lse_image_set_ready_1 },
+      { .name = STRINGIFY(test_lse_image_set_ready_2), .desc = test_lse_image_set_ready_2_description, .test = test_lse_image_set_ready_2 },
       { .name = STRINGIFY(test_lse_image_set_error_1), .desc = test_lse_image_set_error_1_description, .test = test_lse_image_set_error_1 },
   };
-  MunitTestSetup tests_5_before_each = &lse_image_before_each;
-  MunitTestTearDown tests_5_after_each = &lse_image_after_each;
+  MunitTestSetup tests_9_before_each = &lse_image_before_each;
+  MunitTestTearDown tests_9_after_each = &lse_image_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_5, sizeof(tests_5) / sizeof(tests_5[0]), tests_5_before_each, tests_5_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_9, sizeof(tests_9) / sizeof(tests_9[0]), tests_9_before_each, tests_9_after_each);
 
-  lse_test_info tests_6 [] = {
+  lse_test_info tests_10 [] = {
       { .name = STRINGIFY(test_lse_image_store_acquire_1), .desc = test_lse_image_store_acquire_1_description, .test = test_lse_image_store_acquire_1 },
       { .name = STRINGIFY(test_lse_image_store_acquire_2), .desc = test_lse_image_store_acquire_2_description, .test = test_lse_image_store_acquire_2 },
       { .name = STRINGIFY(test_lse_image_store_acquire_3), .desc = test_lse_image_store_acquire_3_description, .test = test_lse_image_store_acquire_3 },
       { .name = STRINGIFY(test_lse_image_store_acquire_4), .desc = test_lse_image_store_acquire_4_description, .test = test_lse_image_store_acquire_4 },
       { .name = STRINGIFY(test_lse_image_store_acquire_5), .desc = test_lse_image_store_acquire_5_description, .test = test_lse_image_store_acquire_5 },
+      { .name = STRINGIFY(test_lse_image_store_acquire_6), .desc = test_lse_image_store_acquire_6_description, .test = test_lse_image_store_acquire_6 },
+      { .name = STRINGIFY(test_lse_image_store_acquire_at_size_1), .desc = test_lse_image_store_acquire_at_size_1_description, .test = test_lse_image_store_acquire_at_size_1 },
+      { .name = STRINGIFY(test_lse_image_store_acquire_at_size_2), .desc = test_lse_image_store_acquire_at_size_2_description, .test = test_lse_image_store_acquire_at_size_2 },
+      { .name = STRINGIFY(test_lse_image_store_acquire_at_size_3), .desc = test_lse_image_store_acquire_at_size_3_description, .test = test_lse_image_store_acquire_at_size_3 },
+      { .name = STRINGIFY(test_lse_image_store_acquire_at_size_4), .desc = test_lse_image_store_acquire_at_size_4_description, .test = test_lse_image_store_acquire_at_size_4 },
+      { .name = STRINGIFY(test_lse_image_store_acquire_at_size_5), .desc = test_lse_image_store_acquire_at_size_5_description, .test = test_lse_image_store_acquire_at_size_5 },
+      { .name = STRINGIFY(test_lse_image_store_acquire_at_size_6), .desc = test_lse_image_store_acquire_at_size_6_description, .test = test_lse_image_store_acquire_at_size_6 },
+      { .name = STRINGIFY(test_lse_image_store_retain_3), .desc = test_lse_image_store_retain_3_description, .test = test_lse_image_store_retain_3 },
+      { .name = STRINGIFY(test_lse_image_store_get_decode_bucket_1), .desc = test_lse_image_store_get_decode_bucket_1_description, .test = test_lse_image_store_get_decode_bucket_1 },
+      { .name = STRINGIFY(test_lse_image_store_get_decode_bucket_2), .desc = test_lse_image_store_get_decode_bucket_2_description, .test = test_lse_image_store_get_decode_bucket_2 },
       { .name = STRINGIFY(test_lse_image_store_release_1), .desc = test_lse_image_store_release_1_description, .test = test_lse_image_store_release_1 },
       { .name = STRINGIFY(test_lse_image_store_release_2), .desc = test_lse_image_store_release_2_description, .test = test_lse_image_store_release_2 },
+      { .name = STRINGIFY(test_lse_image_store_reload_1), .desc = test_lse_image_store_reload_1_description, .test = test_lse_image_store_reload_1 },
+      { .name = STRINGIFY(test_lse_image_store_retain_1), .desc = test_lse_image_store_retain_1_description, .test = test_lse_image_store_retain_1 },
+      { .name = STRINGIFY(test_lse_image_store_retain_2), .desc = test_lse_image_store_retain_2_description, .test = test_lse_image_store_retain_2 },
+      { .name = STRINGIFY(test_lse_image_store_on_image_uploaded_1), .desc = test_lse_image_store_on_image_uploaded_1_description, .test = test_lse_image_store_on_image_uploaded_1 },
+      { .name = STRINGIFY(test_lse_image_store_on_image_uploaded_2), .desc = test_lse_image_store_on_image_uploaded_2_description, .test = test_lse_image_store_on_image_uploaded_2 },
   };
-  MunitTestSetup tests_6_before_each = &lse_image_store_before_each;
-  MunitTestTearDown tests_6_after_each = &lse_image_store_after_each;
+  MunitTestSetup tests_10_before_each = &lse_image_store_before_each;
+  MunitTestTearDown tests_10_after_each = &lse_image_store_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_6, sizeof(tests_6) / sizeof(tests_6[0]), tests_6_before_each, tests_6_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_10, sizeof(tests_10) / sizeof(tests_10[0]), tests_10_before_each, tests_10_after_each);
 
-  lse_test_info tests_7 [] = {
+  lse_test_info tests_11 [] = {
       { .name = STRINGIFY(test_lse_node_get_parent_1), .desc = test_lse_node_get_parent_1_description, .test = test_lse_node_get_parent_1 },
       { .name = STRINGIFY(test_lse_node_get_child_count_1), .desc = test_lse_node_get_child_count_1_description, .test = test_lse_node_get_child_count_1 },
       { .name = STRINGIFY(test_lse_node_get_child_at_1), .desc = test_lse_node_get_child_at_1_description, .test = test_lse_node_get_child_at_1 },
       { .name = STRINGIFY(test_lse_node_append_1), .desc = test_lse_node_append_1_description, .test = test_lse_node_append_1 },
       { .name = STRINGIFY(test_lse_node_insert_before_1), .desc = test_lse_node_insert_before_1_description, .test = test_lse_node_insert_before_1 },
       { .name = STRINGIFY(test_lse_node_remove_child_1), .desc = test_lse_node_remove_child_1_description, .test = test_lse_node_remove_child_1 },
+      { .name = STRINGIFY(test_lse_node_request_paint_1), .desc = test_lse_node_request_paint_1_description, .test = test_lse_node_request_paint_1 },
+      { .name = STRINGIFY(test_lse_node_request_style_resolve_1), .desc = test_lse_node_request_style_resolve_1_description, .test = test_lse_node_request_style_resolve_1 },
+      { .name = STRINGIFY(test_lse_node_on_yoga_layout_event_1), .desc = test_lse_node_on_yoga_layout_event_1_description, .test = test_lse_node_on_yoga_layout_event_1 },
+      { .name = STRINGIFY(test_lse_node_on_yoga_layout_event_2), .desc = test_lse_node_on_yoga_layout_event_2_description, .test = test_lse_node_on_yoga_layout_event_2 },
+      { .name = STRINGIFY(test_lse_node_on_style_resolve_1), .desc = test_lse_node_on_style_resolve_1_description, .test = test_lse_node_on_style_resolve_1 },
+      { .name = STRINGIFY(test_lse_node_request_composite_1), .desc = test_lse_node_request_composite_1_description, .test = test_lse_node_request_composite_1 },
+      { .name = STRINGIFY(test_lse_node_request_group_composite_1), .desc = test_lse_node_request_group_composite_1_description, .test = test_lse_node_request_group_composite_1 },
+      { .name = STRINGIFY(test_lse_node_set_src_1), .desc = test_lse_node_set_src_1_description, .test = test_lse_node_set_src_1 },
   };
-  MunitTestSetup tests_7_before_each = &lse_node_before_each;
-  MunitTestTearDown tests_7_after_each = &lse_node_after_each;
+  MunitTestSetup tests_11_before_each = &lse_node_before_each;
+  MunitTestTearDown tests_11_after_each = &lse_node_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_7, sizeof(tests_7) / sizeof(tests_7[0]), tests_7_before_each, tests_7_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_11, sizeof(tests_11) / sizeof(tests_11[0]), tests_11_before_each, tests_11_after_each);
 
-  lse_test_info tests_8 [] = {
+  lse_test_info tests_12 [] = {
       { .name = STRINGIFY(test_lse_object_new_1), .desc = test_lse_object_new_1_description, .test = test_lse_object_new_1 },
       { .name = STRINGIFY(test_lse_object_new_2), .desc = test_lse_object_new_2_description, .test = test_lse_object_new_2 },
       { .name = STRINGIFY(test_lse_object_ref_1), .desc = test_lse_object_ref_1_description, .test = test_lse_object_ref_1 },
   };
-  MunitTestSetup tests_8_before_each = &lse_object_before_each;
-  MunitTestTearDown tests_8_after_each = &lse_object_after_each;
+  MunitTestSetup tests_12_before_each = &lse_object_before_each;
+  MunitTestTearDown tests_12_after_each = &lse_object_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_8, sizeof(tests_8) / sizeof(tests_8[0]), tests_8_before_each, tests_8_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_12, sizeof(tests_12) / sizeof(tests_12[0]), tests_12_before_each, tests_12_after_each);
 
-  lse_test_info tests_9 [] = {
+  lse_test_info tests_13 [] = {
+      { .name = STRINGIFY(test_lse_rect_f_union_1), .desc = test_lse_rect_f_union_1_description, .test = test_lse_rect_f_union_1 },
+      { .name = STRINGIFY(test_lse_rect_f_union_2), .desc = test_lse_rect_f_union_2_description, .test = test_lse_rect_f_union_2 },
+      { .name = STRINGIFY(test_lse_rect_f_intersects_1), .desc = test_lse_rect_f_intersects_1_description, .test = test_lse_rect_f_intersects_1 },
+      { .name = STRINGIFY(test_lse_rect_f_intersect_1), .desc = test_lse_rect_f_intersect_1_description, .test = test_lse_rect_f_intersect_1 },
+      { .name = STRINGIFY(test_lse_rect_f_round_out_1), .desc = test_lse_rect_f_round_out_1_description, .test = test_lse_rect_f_round_out_1 },
+      { .name = STRINGIFY(test_lse_rect_f_round_in_1), .desc = test_lse_rect_f_round_in_1_description, .test = test_lse_rect_f_round_in_1 },
+      { .name = STRINGIFY(test_lse_rect_f_contains_1), .desc = test_lse_rect_f_contains_1_description, .test = test_lse_rect_f_contains_1 },
+  };
+  MunitTestSetup tests_13_before_each = &lse_rect_before_each;
+  MunitTestTearDown tests_13_after_each = &lse_rect_after_each;
+
+  suites[suites_push_index++] = lse_test_suite_init(tests_13, sizeof(tests_13) / sizeof(tests_13[0]), tests_13_before_each, tests_13_after_each);
+
+  lse_test_info tests_14 [] = {
+      { .name = STRINGIFY(test_lse_sdl_graphics_batch_1), .desc = test_lse_sdl_graphics_batch_1_description, .test = test_lse_sdl_graphics_batch_1 },
+      { .name = STRINGIFY(test_lse_sdl_graphics_batch_2), .desc = test_lse_sdl_graphics_batch_2_description, .test = test_lse_sdl_graphics_batch_2 },
+      { .name = STRINGIFY(test_lse_sdl_graphics_batch_3), .desc = test_lse_sdl_graphics_batch_3_description, .test = test_lse_sdl_graphics_batch_3 },
+      { .name = STRINGIFY(test_lse_sdl_graphics_batch_4), .desc = test_lse_sdl_graphics_batch_4_description, .test = test_lse_sdl_graphics_batch_4 },
+      { .name = STRINGIFY(test_lse_sdl_graphics_batch_5), .desc = test_lse_sdl_graphics_batch_5_description, .test = test_lse_sdl_graphics_batch_5 },
+      { .name = STRINGIFY(test_lse_sdl_graphics_batch_6), .desc = test_lse_sdl_graphics_batch_6_description, .test = test_lse_sdl_graphics_batch_6 },
+  };
+  MunitTestSetup tests_14_before_each = &lse_sdl_graphics_before_each;
+  MunitTestTearDown tests_14_after_each = &lse_sdl_graphics_after_each;
+
+  suites[suites_push_index++] = lse_test_suite_init(tests_14, sizeof(tests_14) / sizeof(tests_14[0]), tests_14_before_each, tests_14_after_each);
+
+  lse_test_info tests_15 [] = {
       { .name = STRINGIFY(test_lse_string_new_1), .desc = test_lse_string_new_1_description, .test = test_lse_string_new_1 },
       { .name = STRINGIFY(test_lse_string_new_2), .desc = test_lse_string_new_2_description, .test = test_lse_string_new_2 },
       { .name = STRINGIFY(test_lse_string_new_3), .desc = test_lse_string_new_3_description, .test = test_lse_string_new_3 },
       { .name = STRINGIFY(test_lse_string_new_with_size_1), .desc = test_lse_string_new_with_size_1_description, .test = test_lse_string_new_with_size_1 },
       { .name = STRINGIFY(test_lse_string_new_with_size_2), .desc = test_lse_string_new_with_size_2_description, .test = test_lse_string_new_with_size_2 },
   };
-  MunitTestSetup tests_9_before_each = &lse_string_before_each;
-  MunitTestTearDown tests_9_after_each = &lse_string_after_each;
+  MunitTestSetup tests_15_before_each = &lse_string_before_each;
+  MunitTestTearDown tests_15_after_each = &lse_string_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_9, sizeof(tests_9) / sizeof(tests_9[0]), tests_9_before_each, tests_9_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_15, sizeof(tests_15) / sizeof(tests_15[0]), tests_15_before_each, tests_15_after_each);
 
-  lse_test_info tests_10 [] = {
+  lse_test_info tests_16 [] = {
       { .name = STRINGIFY(test_lse_style_new_1), .desc = test_lse_style_new_1_description, .test = test_lse_style_new_1 },
       { .name = STRINGIFY(test_lse_style_from_string_1), .desc = test_lse_style_from_string_1_description, .test = test_lse_style_from_string_1 },
       { .name = STRINGIFY(test_lse_style_from_string_2), .desc = test_lse_style_from_string_2_description, .test = test_lse_style_from_string_2 },
@@ -387,12 +710,12 @@ MunitSuite lse_test_runner_suite_init() {
       { .name = STRINGIFY(test_lse_style_transform_new_1), .desc = test_lse_style_transform_new_1_description, .test = test_lse_style_transform_new_1 },
       { .name = STRINGIFY(test_lse_style_transform_new_2), .desc = test_lse_style_transform_new_2_description, .test = test_lse_style_transform_new_2 },
   };
-  MunitTestSetup tests_10_before_each = &lse_style_before_each;
-  MunitTestTearDown tests_10_after_each = &lse_style_after_each;
+  MunitTestSetup tests_16_before_each = &lse_style_before_each;
+  MunitTestTearDown tests_16_after_each = &lse_style_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_10, sizeof(tests_10) / sizeof(tests_10[0]), tests_10_before_each, tests_10_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_16, sizeof(tests_16) / sizeof(tests_16[0]), tests_16_before_each, tests_16_after_each);
 
-  lse_test_info tests_11 [] = {
+  lse_test_info tests_17 [] = {
       { .name = STRINGIFY(test_lse_style_meta_set_enum_1), .desc = test_lse_style_meta_set_enum_1_description, .test = test_lse_style_meta_set_enum_1 },
       { .name = STRINGIFY(test_lse_style_meta_set_enum_2), .desc = test_lse_style_meta_set_enum_2_description, .test = test_lse_style_meta_set_enum_2 },
       { .name = STRINGIFY(test_lse_style_meta_set_enum_3), .desc = test_lse_style_meta_set_enum_3_description, .test = test_lse_style_meta_set_enum_3 },
@@ -403,30 +726,56 @@ MunitSuite lse_test_runner_suite_init() {
       { .name = STRINGIFY(test_lse_style_meta_from_string_2), .desc = test_lse_style_meta_from_string_2_description, .test = test_lse_style_meta_from_string_2 },
       { .name = STRINGIFY(test_lse_style_meta_from_string_3), .desc = test_lse_style_meta_from_string_3_description, .test = test_lse_style_meta_from_string_3 },
   };
-  MunitTestSetup tests_11_before_each = NULL;
-  MunitTestTearDown tests_11_after_each = NULL;
+  MunitTestSetup tests_17_before_each = NULL;
+  MunitTestTearDown tests_17_after_each = NULL;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_11, sizeof(tests_11) / sizeof(tests_11[0]), tests_11_before_each, tests_11_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_17, sizeof(tests_17) / sizeof(tests_17[0]), tests_17_before_each, tests_17_after_each);
 
-  lse_test_info tests_12 [] = {
+  lse_test_info tests_18 [] = {
       { .name = STRINGIFY(test_lse_text_measure_1), .desc = test_lse_text_measure_1_description, .test = test_lse_text_measure_1 },
       { .name = STRINGIFY(test_lse_text_measure_2), .desc = test_lse_text_measure_2_description, .test = test_lse_text_measure_2 },
       { .name = STRINGIFY(test_lse_text_measure_3), .desc = test_lse_text_measure_3_description, .test = test_lse_text_measure_3 },
+      { .name = STRINGIFY(test_lse_text_measure_4), .desc = test_lse_text_measure_4_description, .test = test_lse_text_measure_4 },
+      { .name = STRINGIFY(test_lse_text_layout_update_1), .desc = test_lse_text_layout_update_1_description, .test = test_lse_text_layout_update_1 },
+      { .name = STRINGIFY(test_lse_text_layout_update_2), .desc = test_lse_text_layout_update_2_description, .test = test_lse_text_layout_update_2 },
+      { .name = STRINGIFY(test_lse_text_layout_update_3), .desc = test_lse_text_layout_update_3_description, .test = test_lse_text_layout_update_3 },
+      { .name = STRINGIFY(test_lse_text_layout_update_4), .desc = test_lse_text_layout_update_4_description, .test = test_lse_text_layout_update_4 },
+      { .name = STRINGIFY(test_lse_text_layout_update_5), .desc = test_lse_text_layout_update_5_description, .test = test_lse_text_layout_update_5 },
   };
-  MunitTestSetup tests_12_before_each = &lse_text_before_each;
-  MunitTestTearDown tests_12_after_each = &lse_text_after_each;
+  MunitTestSetup tests_18_before_each = &lse_text_before_each;
+  MunitTestTearDown tests_18_after_each = &lse_text_after_each;
+
+  suites[suites_push_index++] = lse_test_suite_init(tests_18, sizeof(tests_18) / sizeof(tests_18[0]), tests_18_before_each, tests_18_after_each);
+
+  lse_test_info tests_19 [] = {
+      { .name = STRINGIFY(test_lse_texture_pool_get_bucket_size_1), .desc = test_lse_texture_pool_get_bucket_size_1_description, .test = test_lse_texture_pool_get_bucket_size_1 },
+      { .name = STRINGIFY(test_lse_texture_pool_get_bucket_size_2), .desc = test_lse_texture_pool_get_bucket_size_2_description, .test = test_lse_texture_pool_get_bucket_size_2 },
+      { .name = STRINGIFY(test_lse_texture_pool_acquire_1), .desc = test_lse_texture_pool_acquire_1_description, .test = test_lse_texture_pool_acquire_1 },
+      { .name = STRINGIFY(test_lse_texture_pool_acquire_2), .desc = test_lse_texture_pool_acquire_2_description, .test = test_lse_texture_pool_acquire_2 },
+      { .name = STRINGIFY(test_lse_texture_pool_acquire_3), .desc = test_lse_texture_pool_acquire_3_description, .test = test_lse_texture_pool_acquire_3 },
+      { .name = STRINGIFY(test_lse_texture_pool_release_1), .desc = test_lse_texture_pool_release_1_description, .test = test_lse_texture_pool_release_1 },
+  };
+  MunitTestSetup tests_19_before_each = &lse_texture_pool_before_each;
+  MunitTestTearDown tests_19_after_each = &lse_texture_pool_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_12, sizeof(tests_12) / sizeof(tests_12[0]), tests_12_before_each, tests_12_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_19, sizeof(tests_19) / sizeof(tests_19[0]), tests_19_before_each, tests_19_after_each);
 
-  lse_test_info tests_13 [] = {
+  lse_test_info tests_20 [] = {
       { .name = STRINGIFY(test_lse_window_get_root), .desc = test_lse_window_get_root_description, .test = test_lse_window_get_root },
       { .name = STRINGIFY(test_lse_window_reset_1), .desc = test_lse_window_reset_1_description, .test = test_lse_window_reset_1 },
       { .name = STRINGIFY(test_lse_window_reset_2), .desc = test_lse_window_reset_2_description, .test = test_lse_window_reset_2 },
+      { .name = STRINGIFY(test_lse_window_present_1), .desc = test_lse_window_present_1_description, .test = test_lse_window_present_1 },
+      { .name = STRINGIFY(test_lse_window_present_2), .desc = test_lse_window_present_2_description, .test = test_lse_window_present_2 },
+      { .name = STRINGIFY(test_lse_window_present_3), .desc = test_lse_window_present_3_description, .test = test_lse_window_present_3 },
+      { .name = STRINGIFY(test_lse_window_invalidate_1), .desc = test_lse_window_invalidate_1_description, .test = test_lse_window_invalidate_1 },
+      { .name = STRINGIFY(test_lse_window_get_render_stats_1), .desc = test_lse_window_get_render_stats_1_description, .test = test_lse_window_get_render_stats_1 },
+      { .name = STRINGIFY(test_lse_window_begin_batch_1), .desc = test_lse_window_begin_batch_1_description, .test = test_lse_window_begin_batch_1 },
+      { .name = STRINGIFY(test_lse_window_get_image_store_1), .desc = test_lse_window_get_image_store_1_description, .test = test_lse_window_get_image_store_1 },
   };
-  MunitTestSetup tests_13_before_each = &lse_window_before_each;
-  MunitTestTearDown tests_13_after_each = &lse_window_after_each;
+  MunitTestSetup tests_20_before_each = &lse_window_before_each;
+  MunitTestTearDown tests_20_after_each = &lse_window_after_each;
 
-  suites[suites_push_index++] = lse_test_suite_init(tests_13, sizeof(tests_13) / sizeof(tests_13[0]), tests_13_before_each, tests_13_after_each);
+  suites[suites_push_index++] = lse_test_suite_init(tests_20, sizeof(tests_20) / sizeof(tests_20[0]), tests_20_before_each, tests_20_after_each);
 
   return (MunitSuite) {
       .prefix = "",
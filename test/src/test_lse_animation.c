@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include <lse_animation.h>
+
+#include <lse_array.h>
+#include <lse_node.h>
+#include <lse_test.h>
+
+struct lse_test_fixture {
+  lse_env* env;
+  lse_window* window;
+  lse_node* node;
+  lse_animator animator;
+  lse_style* from;
+  lse_style* to;
+};
+
+static const lse_animation_settings k_linear_100ms = {
+  .duration = 100,
+  .iterations = 1,
+  .easing = LSE_ANIMATION_EASING_LINEAR,
+};
+
+static lse_style_value px(float value);
+static float get_opacity(lse_node* node);
+
+BEFORE_EACH(lse_animation) {
+  fixture->env = lse_test_env_new();
+  fixture->window = lse_env_add_window(fixture->env);
+  fixture->node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+  fixture->animator = lse_animator_init();
+  fixture->from = lse_style_new();
+  fixture->to = lse_style_new();
+
+  lse_node_append(lse_window_get_root(fixture->window), fixture->node);
+}
+
+AFTER_EACH(lse_animation) {
+  lse_animator_drop(&fixture->animator);
+  lse_unref(fixture->from);
+  lse_unref(fixture->to);
+  lse_unref(fixture->node);
+  lse_unref(fixture->window);
+  lse_test_env_drop(fixture->env);
+}
+
+TEST_CASE(lse_animator_add_1, "should add a track per animatable property") {
+  lse_style* keyframes[] = { fixture->from, fixture->to };
+
+  lse_style_set_numeric(fixture->from, LSE_SP_OPACITY, &(lse_style_value){ .value = 0, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_numeric(fixture->to, LSE_SP_OPACITY, &(lse_style_value){ .value = 1, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_color(fixture->to, LSE_SP_BACKGROUND_COLOR, 0xFFFFFFFF);
+  lse_style_set_numeric(fixture->to, LSE_SP_WIDTH, &(lse_style_value){ .value = 100, .unit = LSE_STYLE_UNIT_PX });
+
+  int32_t id = lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 2, &k_linear_100ms);
+
+  munit_assert_int32(id, >, 0);
+  munit_assert_size(lse_animator_get_track_count(&fixture->animator), ==, 2);
+  munit_assert_true(lse_animator_has_animation(&fixture->animator, id));
+}
+
+TEST_CASE(lse_animator_add_2, "should not add tracks without animatable properties") {
+  lse_style* keyframes[] = { fixture->to };
+
+  lse_style_set_numeric(fixture->to, LSE_SP_WIDTH, &(lse_style_value){ .value = 100, .unit = LSE_STYLE_UNIT_PX });
+
+  munit_assert_int32(lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 1, &k_linear_100ms), ==, 0);
+  munit_assert_size(lse_animator_get_track_count(&fixture->animator), ==, 0);
+}
+
+TEST_CASE(lse_animator_step_1, "should interpolate opacity and finish at the last keyframe") {
+  lse_style* keyframes[] = { fixture->from, fixture->to };
+
+  lse_style_set_numeric(fixture->from, LSE_SP_OPACITY, &(lse_style_value){ .value = 0, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_numeric(fixture->to, LSE_SP_OPACITY, &(lse_style_value){ .value = 1, .unit = LSE_STYLE_UNIT_PX });
+  lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 2, &k_linear_100ms);
+
+  munit_assert_true(lse_animator_step(&fixture->animator, 1000));
+  munit_assert_double_equal(get_opacity(fixture->node), 0, 4);
+
+  munit_assert_true(lse_animator_step(&fixture->animator, 1050));
+  munit_assert_double_equal(get_opacity(fixture->node), 0.5f, 4);
+
+  munit_assert_false(lse_animator_step(&fixture->animator, 1200));
+  munit_assert_double_equal(get_opacity(fixture->node), 1, 4);
+  munit_assert_size(lse_animator_get_track_count(&fixture->animator), ==, 0);
+}
+
+TEST_CASE(lse_animator_step_2, "should animate from the current value when there is no keyframe at offset 0") {
+  lse_style* keyframes[] = { fixture->to };
+
+  lse_style_set_numeric(
+      lse_node_get_style(fixture->node),
+      LSE_SP_OPACITY,
+      &(lse_style_value){ .value = 0.2f, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_numeric(fixture->to, LSE_SP_OPACITY, &(lse_style_value){ .value = 1, .unit = LSE_STYLE_UNIT_PX });
+  lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 1, &k_linear_100ms);
+
+  lse_animator_step(&fixture->animator, 0);
+  munit_assert_double_equal(get_opacity(fixture->node), 0.2f, 4);
+
+  lse_animator_step(&fixture->animator, 50);
+  munit_assert_double_equal(get_opacity(fixture->node), 0.6f, 4);
+}
+
+TEST_CASE(lse_animator_step_3, "should interpolate each color channel") {
+  lse_style* keyframes[] = { fixture->from, fixture->to };
+
+  lse_style_set_color(fixture->from, LSE_SP_BACKGROUND_COLOR, 0x00FF2000);
+  lse_style_set_color(fixture->to, LSE_SP_BACKGROUND_COLOR, 0xFF0040FF);
+  lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 2, &k_linear_100ms);
+
+  lse_animator_step(&fixture->animator, 0);
+  lse_animator_step(&fixture->animator, 50);
+
+  munit_assert_uint32(lse_style_get_color(lse_node_get_style(fixture->node), LSE_SP_BACKGROUND_COLOR), ==, 0x80803080);
+}
+
+TEST_CASE(lse_animator_step_4, "should update the node transform in place") {
+  lse_style* keyframes[] = { fixture->from, fixture->to };
+  lse_style_transform transform;
+  lse_object* first;
+  lse_style_transform* current;
+
+  lse_style_transform_translate(px(0), px(0), &transform);
+  lse_style_set_object(fixture->from, LSE_SP_TRANSFORM, lse_style_transform_new(&transform, 1));
+  lse_style_transform_translate(px(100), px(-20), &transform);
+  lse_style_set_object(fixture->to, LSE_SP_TRANSFORM, lse_style_transform_new(&transform, 1));
+  lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 2, &k_linear_100ms);
+
+  lse_animator_step(&fixture->animator, 0);
+  first = lse_style_get_object(lse_node_get_style(fixture->node), LSE_SP_TRANSFORM);
+
+  lse_animator_step(&fixture->animator, 25);
+  current = lse_array_at((lse_array*)lse_style_get_object(lse_node_get_style(fixture->node), LSE_SP_TRANSFORM), 0);
+
+  munit_assert_ptr_equal(lse_style_get_object(lse_node_get_style(fixture->node), LSE_SP_TRANSFORM), first);
+  munit_assert_int(current->op, ==, LSE_STYLE_TRANSFORM_TRANSLATE);
+  munit_assert_double_equal(current->a.value, 25, 4);
+  munit_assert_double_equal(current->b.value, -5, 4);
+  munit_assert_true(lse_node_has_flag(fixture->node, LSE_NODE_FLAG_GROUP));
+}
+
+TEST_CASE(lse_animator_step_5, "should reverse every other iteration when alternate is set") {
+  lse_style* keyframes[] = { fixture->from, fixture->to };
+  lse_animation_settings settings = { .duration = 100, .iterations = 2, .alternate = true };
+
+  lse_style_set_numeric(fixture->from, LSE_SP_OPACITY, &(lse_style_value){ .value = 0, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_numeric(fixture->to, LSE_SP_OPACITY, &(lse_style_value){ .value = 1, .unit = LSE_STYLE_UNIT_PX });
+  lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 2, &settings);
+
+  lse_animator_step(&fixture->animator, 0);
+  lse_animator_step(&fixture->animator, 125);
+  munit_assert_double_equal(get_opacity(fixture->node), 0.75f, 4);
+
+  munit_assert_false(lse_animator_step(&fixture->animator, 250));
+  munit_assert_double_equal(get_opacity(fixture->node), 0, 4);
+}
+
+TEST_CASE(lse_animator_step_6, "should wait for the delay before writing values") {
+  lse_style* keyframes[] = { fixture->from, fixture->to };
+  lse_animation_settings settings = { .duration = 100, .delay = 50, .iterations = 1 };
+
+  lse_style_set_numeric(fixture->from, LSE_SP_OPACITY, &(lse_style_value){ .value = 0, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_numeric(fixture->to, LSE_SP_OPACITY, &(lse_style_value){ .value = 1, .unit = LSE_STYLE_UNIT_PX });
+  lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 2, &settings);
+
+  lse_animator_step(&fixture->animator, 0);
+  lse_animator_step(&fixture->animator, 40);
+  munit_assert_false(lse_style_has_property(lse_node_get_style(fixture->node), LSE_SP_OPACITY));
+
+  lse_animator_step(&fixture->animator, 100);
+  munit_assert_double_equal(get_opacity(fixture->node), 0.5f, 4);
+}
+
+TEST_CASE(lse_animator_cancel_1, "should remove tracks and keep the last written value") {
+  lse_style* keyframes[] = { fixture->from, fixture->to };
+
+  lse_style_set_numeric(fixture->from, LSE_SP_OPACITY, &(lse_style_value){ .value = 0, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_numeric(fixture->to, LSE_SP_OPACITY, &(lse_style_value){ .value = 1, .unit = LSE_STYLE_UNIT_PX });
+
+  int32_t id = lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 2, &k_linear_100ms);
+
+  lse_animator_step(&fixture->animator, 0);
+  lse_animator_step(&fixture->animator, 50);
+
+  munit_assert_true(lse_animator_cancel(&fixture->animator, id));
+  munit_assert_false(lse_animator_has_animation(&fixture->animator, id));
+  munit_assert_false(lse_animator_step(&fixture->animator, 100));
+  munit_assert_double_equal(get_opacity(fixture->node), 0.5f, 4);
+}
+
+TEST_CASE(lse_animator_cancel_2, "should replace a running animation of the same property") {
+  lse_style* keyframes[] = { fixture->to };
+
+  lse_style_set_numeric(fixture->to, LSE_SP_OPACITY, &(lse_style_value){ .value = 1, .unit = LSE_STYLE_UNIT_PX });
+
+  int32_t first = lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 1, &k_linear_100ms);
+  int32_t second = lse_animator_add(&fixture->animator, fixture->node, keyframes, NULL, 1, &k_linear_100ms);
+
+  munit_assert_int32(first, !=, second);
+  munit_assert_false(lse_animator_has_animation(&fixture->animator, first));
+  munit_assert_true(lse_animator_has_animation(&fixture->animator, second));
+  munit_assert_size(lse_animator_get_track_count(&fixture->animator), ==, 1);
+}
+
+static lse_style_value px(float value) {
+  return (lse_style_value){ .value = value, .unit = LSE_STYLE_UNIT_PX };
+}
+
+static float get_opacity(lse_node* node) {
+  return lse_style_get_numeric(lse_node_get_style(node), LSE_SP_OPACITY)->value;
+}
@@ -13,6 +13,7 @@
 
 #include <lse_env.h>
 
+#include <lse_cfg.h>
 #include <lse_object.h>
 #include <lse_test.h>
 
@@ -105,6 +106,17 @@ TEST_CASE(lse_env_get_current_display_mode_1, "should get current display mode f
   assert_display_mode(&mode, 1280, 720, 60);
 }
 
+TEST_CASE(lse_env_get_image_cache_stats_1, "should return image cache budget with no resident images") {
+  lse_image_cache_stats stats;
+
+  lse_env_get_image_cache_stats(fixture->env, &stats);
+
+  munit_assert_int32(stats.image_count, ==, 0);
+  munit_assert_int64(stats.resident_bytes, ==, 0);
+  munit_assert_int64(stats.budget_bytes, ==, LSE_CFG_IMAGE_CACHE_BUDGET);
+  munit_assert_uint64(stats.evictions, ==, 0);
+}
+
 TEST_CASE(lse_env_get_current_display_mode_2, "should return false for invalid index") {
   lse_display_mode mode;
 
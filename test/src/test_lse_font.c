@@ -22,6 +22,8 @@
 
 struct lse_test_fixture {
   lse_font* font;
+  lse_env* env;
+  lse_font* env_font;
 };
 
 //
@@ -48,6 +50,7 @@ static void* s_mock_observer = (void*)(intptr_t)1;
 
 static lse_font_info font_info_init();
 static void font_event_callback(const lse_font_event* e, void* observer);
+static lse_font* acquire_builtin_font(lse_test_fixture* fixture);
 
 BEFORE_EACH(lse_font) {
 }
@@ -59,6 +62,11 @@ AFTER_EACH(lse_font) {
   s_callback_state = LSE_RESOURCE_STATE_INIT;
 
   lse_unref(fixture->font);
+
+  if (fixture->env) {
+    lse_env_release_font(fixture->env, fixture->env_font);
+    lse_test_env_drop(fixture->env);
+  }
 }
 
 TEST_CASE(lse_font_constructor_1, "should create new font in the INIT state") {
@@ -120,6 +128,88 @@ TEST_CASE(lse_font_set_loading_1, "should move font to the ERROR state") {
   munit_assert_false(s_callback_called);
 }
 
+TEST_CASE(lse_font_get_glyph_surface_1, "should rasterize glyph on first use and reuse it after") {
+  lse_font* font = acquire_builtin_font(fixture);
+  lse_glyph_surface first;
+  lse_glyph_surface second;
+  lse_glyph_cache_stats stats;
+
+  munit_assert_true(lse_font_get_glyph_surface(font, 'A', &first));
+  munit_assert_true(lse_font_get_glyph_surface(font, 'A', &second));
+
+  lse_font_get_glyph_cache_stats(font, &stats);
+
+  munit_assert_uint64(stats.misses, ==, 1);
+  munit_assert_uint64(stats.hits, ==, 1);
+  munit_assert_size(stats.glyph_count, ==, 1);
+  munit_assert_size(stats.resident_bytes, ==, (size_t)(first.surface.width * first.surface.height));
+  munit_assert_ptr_equal(first.surface.buffer, second.surface.buffer);
+  munit_assert_int32(first.surface.width, >, 0);
+  munit_assert_int32(first.surface.height, >, 0);
+}
+
+TEST_CASE(lse_font_get_glyph_surface_2, "should cache glyphs per font size") {
+  lse_font* font = acquire_builtin_font(fixture);
+  lse_glyph_surface small;
+  lse_glyph_surface large;
+  lse_glyph_cache_stats stats;
+
+  munit_assert_true(lse_font_get_glyph_surface(font, 'A', &small));
+  lse_font_use_font_size(font, 32);
+  munit_assert_true(lse_font_get_glyph_surface(font, 'A', &large));
+
+  lse_font_get_glyph_cache_stats(font, &stats);
+
+  munit_assert_uint64(stats.misses, ==, 2);
+  munit_assert_size(stats.glyph_count, ==, 2);
+  munit_assert_int32(large.surface.height, >, small.surface.height);
+}
+
+TEST_CASE(lse_font_get_glyph_surface_3, "should evict least recently used glyph when over budget") {
+  lse_font* font = acquire_builtin_font(fixture);
+  lse_glyph_surface glyph;
+  lse_glyph_cache_stats stats;
+
+  munit_assert_true(lse_font_get_glyph_surface(font, 'A', &glyph));
+  lse_font_set_glyph_cache_budget(font, (size_t)(glyph.surface.width * glyph.surface.height));
+  munit_assert_true(lse_font_get_glyph_surface(font, 'B', &glyph));
+
+  lse_font_get_glyph_cache_stats(font, &stats);
+
+  munit_assert_uint64(stats.evictions, ==, 1);
+  munit_assert_size(stats.glyph_count, ==, 1);
+  munit_assert_size(stats.resident_bytes, ==, (size_t)(glyph.surface.width * glyph.surface.height));
+
+  // A was evicted, so it is a miss
+  munit_assert_true(lse_font_get_glyph_surface(font, 'A', &glyph));
+  lse_font_get_glyph_cache_stats(font, &stats);
+  munit_assert_uint64(stats.misses, ==, 3);
+}
+
+TEST_CASE(lse_font_get_glyph_surface_4, "should return false for whitespace") {
+  lse_font* font = acquire_builtin_font(fixture);
+  lse_glyph_surface glyph;
+  lse_glyph_cache_stats stats;
+
+  munit_assert_false(lse_font_get_glyph_surface(font, ' ', &glyph));
+
+  lse_font_get_glyph_cache_stats(font, &stats);
+
+  munit_assert_size(stats.glyph_count, ==, 0);
+}
+
+// @private
+static lse_font* acquire_builtin_font(lse_test_fixture* fixture) {
+  fixture->env = lse_test_env_new();
+  fixture->env_font =
+      lse_env_acquire_font(fixture->env, TEST_FAMILY, LSE_STYLE_FONT_STYLE_NORMAL, LSE_STYLE_FONT_WEIGHT_NORMAL);
+
+  munit_assert_not_null(fixture->env_font);
+  munit_assert_true(lse_font_use_font_size(fixture->env_font, 16));
+
+  return fixture->env_font;
+}
+
 // @private
 static lse_font_info font_info_init() {
   return (lse_font_info){
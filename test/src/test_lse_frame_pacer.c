@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include <lse_frame_pacer.h>
+
+#include <lse_test.h>
+
+//
+// types
+//
+
+struct lse_test_fixture {
+  lse_frame_pacer pacer;
+};
+
+BEFORE_EACH(lse_frame_pacer) {
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_ON, 0);
+}
+
+AFTER_EACH(lse_frame_pacer) {
+}
+
+TEST_CASE(lse_frame_pacer_init_1, "should start the first frame immediately") {
+  munit_assert_double(lse_frame_pacer_get_delay(&fixture->pacer, 100.0), ==, 0.0);
+  munit_assert_double_equal(fixture->pacer.frame_interval, 1000.0 / LSE_CFG_FRAME_RATE, 6);
+}
+
+TEST_CASE(lse_frame_pacer_set_display_1, "should round fps limit to a whole number of refreshes with vsync") {
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_ON, 25);
+  lse_frame_pacer_set_display(&fixture->pacer, 75, true, true);
+
+  munit_assert_double_equal(fixture->pacer.frame_interval, 40.0, 6);
+
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_ON, 60);
+  lse_frame_pacer_set_display(&fixture->pacer, 75, true, true);
+
+  munit_assert_double_equal(fixture->pacer.frame_interval, 2000.0 / 75.0, 6);
+
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_ON, 50);
+  lse_frame_pacer_set_display(&fixture->pacer, 50, true, true);
+
+  munit_assert_double_equal(fixture->pacer.frame_interval, 20.0, 6);
+}
+
+TEST_CASE(lse_frame_pacer_set_display_2, "should use fps limit as is without vsync") {
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_OFF, 60);
+  lse_frame_pacer_set_display(&fixture->pacer, 75, false, true);
+
+  munit_assert_double_equal(fixture->pacer.frame_interval, 1000.0 / 60.0, 6);
+}
+
+TEST_CASE(lse_frame_pacer_set_display_3, "should fall back to current vsync state when vsync cannot be changed") {
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_ADAPTIVE, 0);
+  lse_frame_pacer_set_display(&fixture->pacer, 60, true, false);
+
+  munit_assert_int(fixture->pacer.vsync_mode, ==, LSE_VSYNC_MODE_ON);
+}
+
+TEST_CASE(lse_frame_pacer_end_frame_1, "should schedule next frame before the next vertical blank with vsync") {
+  lse_frame_pacer_set_display(&fixture->pacer, 50, true, true);
+
+  // 10ms frame, 6ms of it blocked in present
+  lse_frame_pacer_end_frame(&fixture->pacer, 100.0, 6.0, true, 110.0);
+
+  munit_assert_double_equal(
+      lse_frame_pacer_get_delay(&fixture->pacer, 110.0),
+      20.0 - fixture->pacer.cost_estimate - LSE_CFG_FRAME_PACING_MARGIN,
+      6);
+  munit_assert_double(fixture->pacer.cost_estimate, >, 0.0);
+  munit_assert_double(fixture->pacer.cost_estimate, <=, 4.0);
+}
+
+TEST_CASE(lse_frame_pacer_end_frame_2, "should schedule frames on fixed deadlines without vsync") {
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_OFF, 50);
+  lse_frame_pacer_set_display(&fixture->pacer, 60, false, true);
+
+  lse_frame_pacer_end_frame(&fixture->pacer, 100.0, 0.0, true, 105.0);
+  munit_assert_double_equal(lse_frame_pacer_get_delay(&fixture->pacer, 105.0), 15.0, 6);
+
+  lse_frame_pacer_end_frame(&fixture->pacer, 120.0, 0.0, false, 121.0);
+  munit_assert_double_equal(lse_frame_pacer_get_delay(&fixture->pacer, 121.0), 19.0, 6);
+}
+
+TEST_CASE(lse_frame_pacer_end_frame_3, "should not catch up on missed deadlines") {
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_OFF, 50);
+
+  lse_frame_pacer_end_frame(&fixture->pacer, 100.0, 0.0, true, 175.0);
+
+  munit_assert_double(lse_frame_pacer_get_delay(&fixture->pacer, 175.0), ==, 0.0);
+
+  lse_frame_pacer_end_frame(&fixture->pacer, 175.0, 0.0, true, 180.0);
+
+  munit_assert_double_equal(lse_frame_pacer_get_delay(&fixture->pacer, 180.0), 15.0, 6);
+}
+
+TEST_CASE(lse_frame_pacer_end_frame_4, "should turn vsync off after long frames and back on after short frames") {
+  double t = 0;
+  int32_t i;
+
+  fixture->pacer = lse_frame_pacer_init(LSE_VSYNC_MODE_ADAPTIVE, 0);
+  lse_frame_pacer_set_display(&fixture->pacer, 50, true, true);
+
+  munit_assert_false(lse_frame_pacer_end_frame(&fixture->pacer, t, 0.0, true, t + 30.0));
+  t += 30.0;
+  munit_assert_false(lse_frame_pacer_end_frame(&fixture->pacer, t, 0.0, true, t + 30.0));
+  t += 30.0;
+  munit_assert_true(lse_frame_pacer_end_frame(&fixture->pacer, t, 0.0, true, t + 30.0));
+  t += 30.0;
+  munit_assert_false(fixture->pacer.is_vsync_enabled);
+
+  for (i = 0; i < 100 && !fixture->pacer.is_vsync_enabled; i++) {
+    lse_frame_pacer_end_frame(&fixture->pacer, t, 0.0, true, t + 5.0);
+    t += 20.0;
+  }
+
+  munit_assert_true(fixture->pacer.is_vsync_enabled);
+}
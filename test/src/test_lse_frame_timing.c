@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include <lse_frame_timing.h>
+
+#include <lse_test.h>
+
+//
+// types
+//
+
+struct lse_test_fixture {
+  lse_frame_timing timing;
+};
+
+BEFORE_EACH(lse_frame_timing) {
+  fixture->timing = (lse_frame_timing){ 0 };
+}
+
+AFTER_EACH(lse_frame_timing) {
+}
+
+TEST_CASE(lse_frame_timing_get_stats_1, "should return zeroed stats when no frames have been recorded") {
+  lse_frame_stats stats;
+
+  lse_frame_timing_get_stats(&fixture->timing, &stats);
+
+  munit_assert_uint32(stats.frame_count, ==, 0);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_FRAME].avg, ==, 0.f);
+}
+
+TEST_CASE(lse_frame_timing_get_stats_2, "should compute min, avg and p99 per phase") {
+  lse_frame_stats stats;
+
+  for (int32_t i = 1; i <= 100; i++) {
+    lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_PAINT, (double)i);
+    lse_frame_timing_end_frame(&fixture->timing);
+  }
+
+  lse_frame_timing_get_stats(&fixture->timing, &stats);
+
+  munit_assert_uint32(stats.frame_count, ==, 100);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_PAINT].min, ==, 1.f);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_PAINT].avg, ==, 50.5f);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_PAINT].p99, ==, 99.f);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_LAYOUT].p99, ==, 0.f);
+}
+
+TEST_CASE(lse_frame_timing_get_stats_3, "should only use the most recent frames") {
+  lse_frame_stats stats;
+
+  lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_FRAME, 1000.0);
+  lse_frame_timing_end_frame(&fixture->timing);
+
+  for (int32_t i = 0; i < LSE_CFG_FRAME_HISTORY; i++) {
+    lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_FRAME, 2.0);
+    lse_frame_timing_end_frame(&fixture->timing);
+  }
+
+  lse_frame_timing_get_stats(&fixture->timing, &stats);
+
+  munit_assert_uint32(stats.frame_count, ==, LSE_CFG_FRAME_HISTORY);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_FRAME].min, ==, 2.f);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_FRAME].p99, ==, 2.f);
+}
+
+TEST_CASE(lse_frame_timing_add_1, "should accumulate phase time within a frame") {
+  lse_frame_stats stats;
+
+  lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_UPLOAD, 1.5);
+  lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_UPLOAD, 2.5);
+  lse_frame_timing_end_frame(&fixture->timing);
+
+  lse_frame_timing_get_stats(&fixture->timing, &stats);
+
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_UPLOAD].avg, ==, 4.f);
+}
+
+TEST_CASE(lse_frame_timing_skip_frame_1, "should count skipped frames as idle and keep them out of the stats") {
+  lse_frame_stats stats;
+
+  lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_FRAME, 10.0);
+  lse_frame_timing_end_frame(&fixture->timing);
+
+  for (int32_t i = 0; i < 3; i++) {
+    lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_EVENTS, 0.1);
+    lse_frame_timing_add(&fixture->timing, LSE_FRAME_PHASE_FRAME, 0.1);
+    lse_frame_timing_skip_frame(&fixture->timing);
+  }
+
+  lse_frame_timing_get_stats(&fixture->timing, &stats);
+
+  munit_assert_uint32(stats.frame_count, ==, 1);
+  munit_assert_uint64(stats.idle_frame_count, ==, 3);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_FRAME].min, ==, 10.f);
+  munit_assert_float(stats.phases[LSE_FRAME_PHASE_EVENTS].avg, ==, 0.f);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include <lse_glyph_atlas.h>
+
+#include <lse_test.h>
+
+//
+// types
+//
+
+struct lse_test_fixture {
+  lse_glyph_atlas atlas;
+};
+
+//
+// constants
+//
+
+const float TEST_FONT_SIZE = 16.f;
+const int32_t TEST_PAGE_SIZE = 32;
+const int32_t TEST_MAX_PAGES = 2;
+
+BEFORE_EACH(lse_glyph_atlas) {
+  fixture->atlas = lse_glyph_atlas_init(NULL, TEST_FONT_SIZE, TEST_PAGE_SIZE, TEST_MAX_PAGES);
+}
+
+AFTER_EACH(lse_glyph_atlas) {
+  lse_glyph_atlas_drop(&fixture->atlas);
+}
+
+TEST_CASE(lse_glyph_atlas_insert_1, "should pack glyphs left to right on a shelf") {
+  const lse_atlas_glyph* a = lse_glyph_atlas_insert(&fixture->atlas, 'a', 10, 12, 1, 11);
+  const lse_atlas_glyph* b = lse_glyph_atlas_insert(&fixture->atlas, 'b', 10, 8, 2, 7);
+
+  munit_assert_int32(a->page, ==, 0);
+  munit_assert_int32(a->rect.x, ==, 0);
+  munit_assert_int32(a->rect.y, ==, 0);
+  munit_assert_int32(a->rect.width, ==, 10);
+  munit_assert_int32(a->rect.height, ==, 12);
+  munit_assert_int32(a->x_offset, ==, 1);
+  munit_assert_int32(a->y_offset, ==, 11);
+
+  munit_assert_int32(b->page, ==, 0);
+  munit_assert_int32(b->rect.x, ==, 11);
+  munit_assert_int32(b->rect.y, ==, 0);
+}
+
+TEST_CASE(lse_glyph_atlas_insert_2, "should start a new shelf when the current shelf is full") {
+  lse_glyph_atlas_insert(&fixture->atlas, 'a', 20, 12, 0, 0);
+
+  const lse_atlas_glyph* b = lse_glyph_atlas_insert(&fixture->atlas, 'b', 20, 8, 0, 0);
+
+  munit_assert_int32(b->page, ==, 0);
+  munit_assert_int32(b->rect.x, ==, 0);
+  munit_assert_int32(b->rect.y, ==, 13);
+}
+
+TEST_CASE(lse_glyph_atlas_insert_3, "should start a new page when the current page is full") {
+  lse_glyph_atlas_insert(&fixture->atlas, 'a', 30, 30, 0, 0);
+
+  const lse_atlas_glyph* b = lse_glyph_atlas_insert(&fixture->atlas, 'b', 10, 10, 0, 0);
+
+  munit_assert_int32(b->page, ==, 1);
+  munit_assert_int32(b->rect.x, ==, 0);
+  munit_assert_int32(b->rect.y, ==, 0);
+  munit_assert_int32(fixture->atlas.page_count, ==, 2);
+}
+
+TEST_CASE(lse_glyph_atlas_insert_4, "should not record glyph and mark atlas full when max pages is exceeded") {
+  lse_glyph_atlas_insert(&fixture->atlas, 'a', 30, 30, 0, 0);
+  lse_glyph_atlas_insert(&fixture->atlas, 'b', 30, 30, 0, 0);
+
+  munit_assert_null(lse_glyph_atlas_insert(&fixture->atlas, 'c', 10, 10, 0, 0));
+  munit_assert_null(lse_glyph_atlas_find(&fixture->atlas, 'c'));
+  munit_assert_true(fixture->atlas.is_full);
+  munit_assert_int32(fixture->atlas.page_count, ==, TEST_MAX_PAGES);
+}
+
+TEST_CASE(lse_glyph_atlas_insert_5, "should record zero sized glyphs, but not oversized glyphs") {
+  const lse_atlas_glyph* space = lse_glyph_atlas_insert(&fixture->atlas, ' ', 0, 0, 0, 0);
+
+  munit_assert_int32(space->page, ==, LSE_GLYPH_ATLAS_NO_PAGE);
+  munit_assert_null(lse_glyph_atlas_insert(&fixture->atlas, 'W', TEST_PAGE_SIZE, 10, 0, 0));
+  munit_assert_null(lse_glyph_atlas_find(&fixture->atlas, 'W'));
+  munit_assert_false(fixture->atlas.is_full);
+  munit_assert_int32(fixture->atlas.page_count, ==, 0);
+}
+
+TEST_CASE(lse_glyph_atlas_reset_1, "should pack from the first page again after reset") {
+  lse_glyph_atlas_insert(&fixture->atlas, 'a', 30, 30, 0, 0);
+  lse_glyph_atlas_insert(&fixture->atlas, 'b', 30, 30, 0, 0);
+  lse_glyph_atlas_insert(&fixture->atlas, 'c', 10, 10, 0, 0);
+
+  lse_glyph_atlas_reset(&fixture->atlas);
+
+  const lse_atlas_glyph* c = lse_glyph_atlas_insert(&fixture->atlas, 'c', 10, 10, 0, 0);
+
+  munit_assert_null(lse_glyph_atlas_find(&fixture->atlas, 'a'));
+  munit_assert_false(fixture->atlas.is_full);
+  munit_assert_int32(c->page, ==, 0);
+  munit_assert_int32(c->rect.x, ==, 0);
+  munit_assert_int32(c->rect.y, ==, 0);
+}
+
+TEST_CASE(lse_glyph_atlas_find_1, "should find inserted glyph") {
+  lse_glyph_atlas_insert(&fixture->atlas, 'a', 10, 12, 0, 0);
+
+  const lse_atlas_glyph* a = lse_glyph_atlas_find(&fixture->atlas, 'a');
+
+  munit_assert_not_null(a);
+  munit_assert_int32(a->rect.width, ==, 10);
+  munit_assert_null(lse_glyph_atlas_find(&fixture->atlas, 'b'));
+}
+
+TEST_CASE(lse_glyph_atlas_remove_1, "should forget a removed glyph, but keep the others") {
+  lse_glyph_atlas_insert(&fixture->atlas, 'a', 10, 12, 0, 0);
+  lse_glyph_atlas_insert(&fixture->atlas, 'b', 10, 12, 0, 0);
+
+  lse_glyph_atlas_remove(&fixture->atlas, 'a');
+
+  munit_assert_null(lse_glyph_atlas_find(&fixture->atlas, 'a'));
+  munit_assert_not_null(lse_glyph_atlas_find(&fixture->atlas, 'b'));
+}
+
+TEST_CASE(lse_glyph_atlas_matches_1, "should match font and font size") {
+  munit_assert_true(lse_glyph_atlas_matches(&fixture->atlas, NULL, TEST_FONT_SIZE));
+  munit_assert_false(lse_glyph_atlas_matches(&fixture->atlas, NULL, TEST_FONT_SIZE + 1.f));
+}
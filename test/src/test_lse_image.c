@@ -88,7 +88,7 @@ TEST_CASE(lse_image_set_ready_1, "should move image to READY state") {
 
   lse_image_add_observer(fixture->image, s_mock_observer, &image_event_callback);
   // TODO: send pixels?
-  lse_image_set_ready(fixture->image, NULL, NULL, TEST_IMAGE_WIDTH, TEST_IMAGE_HEIGHT, TEST_IMAGE_FORMAT);
+  lse_image_set_ready(fixture->image, NULL, NULL, TEST_IMAGE_WIDTH, TEST_IMAGE_HEIGHT, TEST_IMAGE_FORMAT, false);
   lse_image_remove_observer(fixture->image, s_mock_observer);
 
   munit_assert_int32(lse_image_get_state(fixture->image), ==, LSE_RESOURCE_STATE_READY);
@@ -102,6 +102,16 @@ TEST_CASE(lse_image_set_ready_1, "should move image to READY state") {
   munit_assert_int32(s_callback_state, ==, LSE_RESOURCE_STATE_READY);
 }
 
+TEST_CASE(lse_image_set_ready_2, "should record whether image pixels are opaque") {
+  fixture->image = lse_new(lse_image, lse_string_new(TEST_URI));
+
+  munit_assert_false(lse_image_is_opaque(fixture->image));
+
+  lse_image_set_ready(fixture->image, NULL, NULL, TEST_IMAGE_WIDTH, TEST_IMAGE_HEIGHT, TEST_IMAGE_FORMAT, true);
+
+  munit_assert_true(lse_image_is_opaque(fixture->image));
+}
+
 TEST_CASE(lse_image_set_error_1, "should move image to READY state") {
   fixture->image = lse_new(lse_image, lse_string_new(TEST_URI));
 
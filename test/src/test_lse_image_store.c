@@ -13,6 +13,8 @@
 
 #include <lse_image_store.h>
 
+#include <lse_env.h>
+#include <lse_image.h>
 #include <lse_object.h>
 #include <lse_test.h>
 
@@ -39,6 +41,7 @@ struct lse_test_fixture {
 #define IMAGE_FILE_SVG_HEIGHT 300
 #define IMAGE_FILE_BAD_FORMAT "assets/not_an_image.txt"
 #define IMAGE_FILE_DOES_NOT_EXIST "does_not_exist"
+#define IMAGE_FILE_PNG_BYTES (IMAGE_FILE_PNG_WIDTH * IMAGE_FILE_PNG_HEIGHT * 4)
 
 BEFORE_EACH(lse_image_store) {
   fixture->env = lse_env_new();
@@ -101,6 +104,150 @@ TEST_CASE(lse_image_store_acquire_5, "should return stored image if uri has alre
   munit_assert_ptr_equal(fixture->image_1, fixture->image_2);
 }
 
+TEST_CASE(lse_image_store_acquire_6, "should return the same image for equivalent file paths") {
+  fixture->image_1 =
+      lse_image_store_acquire_image(fixture->store, lse_string_new("./" IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+  fixture->image_2 =
+      lse_image_store_acquire_image(fixture->store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+
+  munit_assert_not_null(fixture->image_1);
+  munit_assert_ptr_equal(fixture->image_1, fixture->image_2);
+  munit_assert_int32(lse_image_get_state(fixture->image_1), ==, LSE_RESOURCE_STATE_READY);
+  munit_assert_ptr_equal(lse_image_store_get_image(fixture->store, "assets/../" IMAGE_FILE_PNG), fixture->image_1);
+}
+
+TEST_CASE(lse_image_store_acquire_at_size_1, "should downsample image to cover the decode size bucket") {
+  fixture->image_1 = lse_image_store_acquire_image_at_size(
+      fixture->store, lse_string_new(IMAGE_FILE_PNG), 100, 100, LSE_IMAGE_STORE_SYNC);
+
+  munit_assert_not_null(fixture->image_1);
+  munit_assert_int32(lse_image_get_state(fixture->image_1), ==, LSE_RESOURCE_STATE_READY);
+  munit_assert_int32(lse_image_get_width(fixture->image_1), ==, IMAGE_FILE_PNG_WIDTH);
+  munit_assert_int32(lse_image_get_height(fixture->image_1), ==, IMAGE_FILE_PNG_HEIGHT);
+  munit_assert_int32(lse_image_get_decode_width(fixture->image_1), ==, 128);
+  munit_assert_int32(lse_image_get_decode_height(fixture->image_1), ==, 128);
+  munit_assert_int32(lse_image_get_pixel_width(fixture->image_1), ==, 171);
+  munit_assert_int32(lse_image_get_pixel_height(fixture->image_1), ==, 128);
+}
+
+TEST_CASE(lse_image_store_acquire_at_size_2, "should rasterize svg at the decode size bucket") {
+  fixture->image_1 = lse_image_store_acquire_image_at_size(
+      fixture->store, lse_string_new(IMAGE_FILE_SVG), 100, 100, LSE_IMAGE_STORE_SYNC);
+
+  munit_assert_int32(lse_image_get_state(fixture->image_1), ==, LSE_RESOURCE_STATE_READY);
+  munit_assert_int32(lse_image_get_width(fixture->image_1), ==, IMAGE_FILE_SVG_WIDTH);
+  munit_assert_int32(lse_image_get_pixel_width(fixture->image_1), ==, 128);
+  munit_assert_int32(lse_image_get_pixel_height(fixture->image_1), ==, 128);
+}
+
+TEST_CASE(lse_image_store_acquire_at_size_3, "should share one image between display sizes in the same bucket") {
+  fixture->image_1 = lse_image_store_acquire_image_at_size(
+      fixture->store, lse_string_new(IMAGE_FILE_PNG), 100, 100, LSE_IMAGE_STORE_SYNC);
+  fixture->image_2 = lse_image_store_acquire_image_at_size(
+      fixture->store, lse_string_new(IMAGE_FILE_PNG), 120, 90, LSE_IMAGE_STORE_SYNC);
+
+  munit_assert_ptr_equal(fixture->image_1, fixture->image_2);
+}
+
+TEST_CASE(lse_image_store_acquire_at_size_4, "should keep full size and decode size images separate") {
+  fixture->image_1 = lse_image_store_acquire_image_at_size(
+      fixture->store, lse_string_new(IMAGE_FILE_PNG), 100, 100, LSE_IMAGE_STORE_SYNC);
+  fixture->image_2 =
+      lse_image_store_acquire_image(fixture->store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+
+  munit_assert_ptr_not_equal(fixture->image_1, fixture->image_2);
+  munit_assert_int32(lse_image_get_pixel_width(fixture->image_2), ==, IMAGE_FILE_PNG_WIDTH);
+  munit_assert_true(lse_image_store_has_uri(fixture->store, fixture->image_1, IMAGE_FILE_PNG));
+  munit_assert_true(lse_image_store_has_uri(fixture->store, fixture->image_2, IMAGE_FILE_PNG));
+}
+
+TEST_CASE(lse_image_store_acquire_at_size_5, "should rasterize svg above its intrinsic size") {
+  fixture->image_1 = lse_image_store_acquire_image_at_size(
+      fixture->store, lse_string_new(IMAGE_FILE_SVG), 1000, 1000, LSE_IMAGE_STORE_SYNC);
+
+  munit_assert_int32(lse_image_get_state(fixture->image_1), ==, LSE_RESOURCE_STATE_READY);
+  munit_assert_true(lse_image_is_scalable(fixture->image_1));
+  munit_assert_int32(lse_image_get_width(fixture->image_1), ==, IMAGE_FILE_SVG_WIDTH);
+  munit_assert_int32(lse_image_get_pixel_width(fixture->image_1), ==, 1024);
+  munit_assert_int32(lse_image_get_pixel_height(fixture->image_1), ==, 1024);
+}
+
+TEST_CASE(lse_image_store_acquire_at_size_6, "should keep parsed svg while any decode size of the uri is in store") {
+  lse_image_store* store = (lse_image_store*)lse_object_new(lse_image_store_type, fixture->env);
+  lse_image_store_stats stats;
+
+  fixture->env->render_settings.image_store_budget = 0;
+
+  fixture->image_1 =
+      lse_image_store_acquire_image_at_size(store, lse_string_new(IMAGE_FILE_SVG), 100, 100, LSE_IMAGE_STORE_SYNC);
+  fixture->image_2 =
+      lse_image_store_acquire_image_at_size(store, lse_string_new(IMAGE_FILE_SVG), 500, 500, LSE_IMAGE_STORE_SYNC);
+
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_int32(lse_image_get_pixel_width(fixture->image_2), ==, 512);
+  munit_assert_int32(stats.svg_count, ==, 1);
+
+  fixture->image_1 = lse_image_store_release_image(store, fixture->image_1);
+
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_int32(stats.svg_count, ==, 1);
+
+  fixture->image_2 = lse_image_store_release_image(store, fixture->image_2);
+
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_int32(stats.svg_count, ==, 0);
+
+  lse_image_store_destroy(store);
+  lse_unref(store);
+}
+
+TEST_CASE(lse_image_store_retain_3, "should evict oldest released decode sizes of a uri over the variant limit") {
+  lse_image_store* store = (lse_image_store*)lse_object_new(lse_image_store_type, fixture->env);
+  lse_image_store_stats stats;
+  lse_image* image;
+
+  fixture->env->render_settings.image_store_budget = IMAGE_FILE_PNG_BYTES;
+
+  for (int32_t size = 32; size <= 128; size *= 2) {
+    image = lse_image_store_acquire_image_at_size(
+        store, lse_string_new(IMAGE_FILE_PNG), size, size, LSE_IMAGE_STORE_SYNC);
+    lse_image_store_release_image(store, image);
+  }
+
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_int32(stats.retained_count, ==, 2);
+  munit_assert_uint64(stats.evictions, ==, 1);
+
+  lse_image_store_destroy(store);
+  lse_unref(store);
+}
+
+TEST_CASE(lse_image_store_get_decode_bucket_1, "should round display size up to a power of two bucket") {
+  int32_t width;
+  int32_t height;
+
+  lse_image_store_get_decode_bucket(100, 20, 640, 480, &width, &height);
+  munit_assert_int32(width, ==, 128);
+  munit_assert_int32(height, ==, 32);
+
+  lse_image_store_get_decode_bucket(1, 1, 0, 0, &width, &height);
+  munit_assert_int32(width, ==, 16);
+  munit_assert_int32(height, ==, 16);
+}
+
+TEST_CASE(lse_image_store_get_decode_bucket_2, "should return full size bucket when image would not be downsampled") {
+  int32_t width;
+  int32_t height;
+
+  lse_image_store_get_decode_bucket(600, 400, 640, 480, &width, &height);
+  munit_assert_int32(width, ==, 0);
+  munit_assert_int32(height, ==, 0);
+
+  lse_image_store_get_decode_bucket(0, 100, 640, 480, &width, &height);
+  munit_assert_int32(width, ==, 0);
+  munit_assert_int32(height, ==, 0);
+}
+
 TEST_CASE(lse_image_store_release_1, "should remove image from store") {
   fixture->image_1 =
       lse_image_store_acquire_image(fixture->store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
@@ -116,3 +263,105 @@ TEST_CASE(lse_image_store_release_1, "should remove image from store") {
 TEST_CASE(lse_image_store_release_2, "should be no-op for null image") {
   munit_assert_null(lse_image_store_release_image(fixture->store, NULL));
 }
+
+TEST_CASE(lse_image_store_reload_1, "should decode image again after pixels are released") {
+  fixture->image_1 =
+      lse_image_store_acquire_image(fixture->store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+
+  lse_image_release_pixels(fixture->image_1);
+  munit_assert_null(lse_image_get_pixels(fixture->image_1));
+
+  lse_image_store_reload_image(fixture->store, fixture->image_1, LSE_IMAGE_STORE_SYNC);
+
+  munit_assert_not_null(lse_image_get_pixels(fixture->image_1));
+  munit_assert_int32(lse_image_get_state(fixture->image_1), ==, LSE_RESOURCE_STATE_READY);
+  munit_assert_int32(lse_image_get_width(fixture->image_1), ==, IMAGE_FILE_PNG_WIDTH);
+}
+
+TEST_CASE(lse_image_store_retain_1, "should return retained image without decoding after last release") {
+  lse_image_store* store = (lse_image_store*)lse_object_new(lse_image_store_type, fixture->env);
+  lse_image_store_stats stats;
+  lse_image* image;
+
+  fixture->env->render_settings.image_store_budget = IMAGE_FILE_PNG_BYTES;
+
+  fixture->image_1 = lse_image_store_acquire_image(store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+  image = fixture->image_1;
+  fixture->image_1 = lse_image_store_release_image(store, fixture->image_1);
+
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_ptr_equal(lse_image_store_get_image(store, IMAGE_FILE_PNG), image);
+  munit_assert_int32(stats.retained_count, ==, 1);
+  munit_assert_int64(stats.retained_bytes, ==, IMAGE_FILE_PNG_BYTES);
+
+  fixture->image_1 = lse_image_store_acquire_image(store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_ptr_equal(fixture->image_1, image);
+  munit_assert_int32(lse_image_get_state(fixture->image_1), ==, LSE_RESOURCE_STATE_READY);
+  munit_assert_uint64(stats.hits, ==, 1);
+  munit_assert_uint64(stats.misses, ==, 1);
+  munit_assert_int32(stats.retained_count, ==, 0);
+  munit_assert_int64(stats.retained_bytes, ==, 0);
+
+  fixture->image_1 = lse_image_store_release_image(store, fixture->image_1);
+  lse_image_store_destroy(store);
+  lse_unref(store);
+}
+
+TEST_CASE(lse_image_store_retain_2, "should evict least recently released image when over budget") {
+  lse_image_store* store = (lse_image_store*)lse_object_new(lse_image_store_type, fixture->env);
+  lse_image_store_stats stats;
+
+  fixture->env->render_settings.image_store_budget = IMAGE_FILE_PNG_BYTES;
+
+  fixture->image_1 = lse_image_store_acquire_image(store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+  fixture->image_2 = lse_image_store_acquire_image(store, lse_string_new(IMAGE_FILE_SVG), LSE_IMAGE_STORE_SYNC);
+  fixture->image_1 = lse_image_store_release_image(store, fixture->image_1);
+  fixture->image_2 = lse_image_store_release_image(store, fixture->image_2);
+
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_null(lse_image_store_get_image(store, IMAGE_FILE_PNG));
+  munit_assert_not_null(lse_image_store_get_image(store, IMAGE_FILE_SVG));
+  munit_assert_uint64(stats.evictions, ==, 1);
+  munit_assert_int32(stats.retained_count, ==, 1);
+
+  lse_image_store_destroy(store);
+  lse_unref(store);
+}
+
+TEST_CASE(lse_image_store_on_image_uploaded_1, "should keep pixels until every consumer has uploaded them") {
+  char window_1;
+  char window_2;
+
+  fixture->image_1 =
+      lse_image_store_acquire_image(fixture->store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+  lse_image_store_add_consumer(fixture->store, fixture->image_1, &window_1);
+  lse_image_store_add_consumer(fixture->store, fixture->image_1, &window_2);
+
+  lse_image_store_on_image_uploaded(fixture->store, fixture->image_1, &window_1);
+  munit_assert_not_null(lse_image_get_pixels(fixture->image_1));
+
+  lse_image_store_on_image_uploaded(fixture->store, fixture->image_1, &window_2);
+  munit_assert_null(lse_image_get_pixels(fixture->image_1));
+
+  lse_image_store_remove_consumer(fixture->store, fixture->image_1, &window_1);
+  lse_image_store_remove_consumer(fixture->store, fixture->image_1, &window_2);
+}
+
+TEST_CASE(lse_image_store_on_image_uploaded_2, "should release pixels when the last consumer waiting for them leaves") {
+  char window_1;
+  char window_2;
+
+  fixture->image_1 =
+      lse_image_store_acquire_image(fixture->store, lse_string_new(IMAGE_FILE_PNG), LSE_IMAGE_STORE_SYNC);
+  lse_image_store_add_consumer(fixture->store, fixture->image_1, &window_1);
+  lse_image_store_add_consumer(fixture->store, fixture->image_1, &window_2);
+
+  lse_image_store_on_image_uploaded(fixture->store, fixture->image_1, &window_1);
+  lse_image_store_remove_consumer(fixture->store, fixture->image_1, &window_2);
+
+  munit_assert_null(lse_image_get_pixels(fixture->image_1));
+
+  lse_image_store_remove_consumer(fixture->store, fixture->image_1, &window_1);
+}
@@ -11,14 +11,47 @@
  * specific language governing permissions and limitations under the License.
  */
 
+#include <lse_node.h>
+
+#include <lse_image.h>
+#include <lse_image_store.h>
 #include <lse_test.h>
+#include <lse_window.h>
+
+#define IMAGE_FILE_PNG "assets/640x480.png"
+
+struct lse_test_fixture {
+  lse_env* env;
+  lse_window* window;
+};
+
+// runs thread pool tasks to completion on the calling thread. the pool context is the env, for the complete callback.
+// like any pool, it finalizes user_data itself. NULL is returned, as there is nothing left to cancel.
+static lse_thread_pool_task* run_task(
+    lse_thread_pool* pool,
+    const char* name,
+    lse_thread_pool_work_callback work,
+    lse_thread_pool_complete_callback complete,
+    void* user_data,
+    lse_thread_pool_user_data_finalize finalize) {
+  work(user_data);
+  complete((lse_env*)pool, user_data);
+  finalize(user_data);
 
-struct lse_test_fixture {};
+  return NULL;
+}
+
+static void free_pool(lse_thread_pool* pool) {
+}
 
 BEFORE_EACH(lse_node) {
+  fixture->env = lse_test_env_new();
+  fixture->window = lse_env_add_window(fixture->env);
 }
 
 AFTER_EACH(lse_node) {
+  lse_unref(fixture->window);
+  lse_test_env_drop(fixture->env);
 }
 
 TEST_CASE(lse_node_get_parent_1, "should ...") {
@@ -38,3 +71,173 @@ TEST_CASE(lse_node_insert_before_1, "should ...") {
 
 TEST_CASE(lse_node_remove_child_1, "should ...") {
 }
+
+TEST_CASE(lse_node_request_paint_1, "should mark ancestors with descendant paint") {
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* parent = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+  lse_node* child = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_node_append(root, parent);
+  lse_node_append(parent, child);
+  lse_node_unset_flag(root, LSE_NODE_FLAG_DESCENDANT_PAINT);
+  lse_node_unset_flag(parent, LSE_NODE_FLAG_PAINT | LSE_NODE_FLAG_DESCENDANT_PAINT);
+  lse_node_unset_flag(child, LSE_NODE_FLAG_PAINT);
+
+  lse_node_request_paint(child);
+
+  munit_assert_true(lse_node_has_flag(child, LSE_NODE_FLAG_PAINT));
+  munit_assert_false(lse_node_has_flag(parent, LSE_NODE_FLAG_PAINT));
+  munit_assert_true(lse_node_has_flag(parent, LSE_NODE_FLAG_DESCENDANT_PAINT));
+  munit_assert_true(lse_node_has_flag(root, LSE_NODE_FLAG_DESCENDANT_PAINT));
+
+  lse_unref(child);
+  lse_unref(parent);
+}
+
+TEST_CASE(lse_node_request_style_resolve_1, "should resolve a dirty subtree when it is appended") {
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* parent = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+  lse_node* child = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_node_append(parent, child);
+  lse_node_request_style_resolve(child, LSE_NODE_FLAG_COLOR);
+
+  munit_assert_true(lse_node_has_flag(parent, LSE_NODE_FLAG_DESCENDANT_RESOLVE));
+
+  // append runs an inline layout, which should reach the child through the newly marked ancestors
+  lse_node_append(root, parent);
+
+  munit_assert_false(lse_node_has_flag(child, LSE_NODE_FLAG_RESOLVE));
+  munit_assert_false(lse_node_has_flag(parent, LSE_NODE_FLAG_DESCENDANT_RESOLVE));
+  munit_assert_false(lse_node_has_flag(root, LSE_NODE_FLAG_DESCENDANT_RESOLVE));
+
+  lse_unref(child);
+  lse_unref(parent);
+}
+
+TEST_CASE(lse_node_on_yoga_layout_event_1, "should request composite when only the position changed") {
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_node_append(root, node);
+  lse_node_unset_flag(node, LSE_NODE_FLAG_GROUP | LSE_NODE_FLAG_RESOLVE | LSE_NODE_FLAG_BOUNDS);
+
+  lse_node_on_yoga_layout_event(lse_node_get_base(node)->yg_node, 0);
+
+  munit_assert_true(lse_node_has_flag(node, LSE_NODE_FLAG_GROUP));
+  munit_assert_false(lse_node_has_flag(node, LSE_NODE_FLAG_RESOLVE));
+  munit_assert_false(lse_node_has_flag(node, LSE_NODE_FLAG_BOUNDS));
+
+  lse_unref(node);
+}
+
+TEST_CASE(lse_node_on_yoga_layout_event_2, "should request bounds resolve when the size changed") {
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_node_append(root, node);
+  lse_node_unset_flag(node, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_RESOLVE | LSE_NODE_FLAG_BOUNDS);
+  lse_node_get_base(node)->layout_size.width = 100;
+
+  lse_node_on_yoga_layout_event(lse_node_get_base(node)->yg_node, 0);
+
+  munit_assert_true(lse_node_has_flag(node, LSE_NODE_FLAG_RESOLVE));
+  munit_assert_true(lse_node_has_flag(node, LSE_NODE_FLAG_BOUNDS));
+
+  lse_unref(node);
+}
+
+TEST_CASE(lse_node_on_style_resolve_1, "should composite, not repaint, a text color change") {
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_TEXT);
+
+  lse_node_append(root, node);
+  lse_node_unset_flag(node, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_PAINT);
+
+  lse_node_request_style_resolve(node, LSE_NODE_FLAG_COLOR);
+  lse_root_node_inline_layout(root);
+
+  munit_assert_true(lse_node_has_flag(node, LSE_NODE_FLAG_COMPOSITE));
+  munit_assert_false(lse_node_has_flag(node, LSE_NODE_FLAG_PAINT));
+  munit_assert_false(lse_node_has_flag(node, LSE_NODE_FLAG_COLOR));
+
+  lse_unref(node);
+}
+
+TEST_CASE(lse_node_request_composite_1, "should mark ancestors with descendant composite") {
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* parent = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+  lse_node* child = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_node_append(root, parent);
+  lse_node_append(parent, child);
+  lse_node_unset_flag(root, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+  lse_node_unset_flag(parent, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+  lse_node_unset_flag(child, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_GROUP);
+
+  lse_node_request_composite(child);
+
+  munit_assert_true(lse_node_has_flag(child, LSE_NODE_FLAG_COMPOSITE));
+  munit_assert_false(lse_node_has_flag(parent, LSE_NODE_FLAG_COMPOSITE));
+  munit_assert_true(lse_node_has_flag(parent, LSE_NODE_FLAG_DESCENDANT_COMPOSITE));
+  munit_assert_true(lse_node_has_flag(root, LSE_NODE_FLAG_DESCENDANT_COMPOSITE));
+  munit_assert_true(lse_node_has_flag(root, LSE_NODE_FLAG_COMPOSITE));
+
+  lse_unref(child);
+  lse_unref(parent);
+}
+
+TEST_CASE(lse_node_request_group_composite_1, "should schedule a composite without invalidating content") {
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* parent = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_node_append(root, parent);
+  lse_node_unset_flag(root, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_DESCENDANT_COMPOSITE);
+  lse_node_unset_flag(parent, LSE_NODE_FLAG_COMPOSITE | LSE_NODE_FLAG_GROUP);
+
+  lse_node_request_group_composite(parent);
+
+  munit_assert_true(lse_node_has_flag(parent, LSE_NODE_FLAG_GROUP));
+  munit_assert_false(lse_node_has_flag(parent, LSE_NODE_FLAG_COMPOSITE));
+  munit_assert_true(lse_node_has_flag(root, LSE_NODE_FLAG_DESCENDANT_COMPOSITE));
+  munit_assert_true(lse_node_has_flag(root, LSE_NODE_FLAG_COMPOSITE));
+
+  lse_unref(parent);
+}
+
+TEST_CASE(lse_node_set_src_1, "should decode an image set before layout at the size of its box") {
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_IMAGE);
+  lse_image_store* store = lse_window_get_image_store(fixture->window);
+  lse_image_store_stats stats;
+  lse_image* image;
+
+  lse_env_set_thread_pool(fixture->env, (lse_thread_pool*)fixture->env, &run_task, NULL, &free_pool);
+  lse_window_configure(fixture->window, &settings);
+  lse_style_set_numeric(
+      lse_node_get_style(node), LSE_SP_WIDTH, &(lse_style_value){ .value = 100, .unit = LSE_STYLE_UNIT_PX });
+  lse_style_set_numeric(
+      lse_node_get_style(node), LSE_SP_HEIGHT, &(lse_style_value){ .value = 100, .unit = LSE_STYLE_UNIT_PX });
+
+  munit_assert_true(lse_node_set_src(node, lse_string_new(IMAGE_FILE_PNG)));
+  munit_assert_string_equal(lse_string_as_cstring(lse_node_get_src(node)), IMAGE_FILE_PNG);
+
+  lse_node_append(root, node);
+  lse_window_present(fixture->window);
+  lse_window_present(fixture->window);
+
+  // one decode, downsampled to cover the 128 x 128 bucket of the box. the full size image was never decoded.
+  lse_image_store_get_stats(store, &stats);
+  munit_assert_uint64(stats.misses, ==, 1);
+  munit_assert_null(lse_image_store_get_image(store, IMAGE_FILE_PNG));
+
+  image = lse_image_store_get_image(store, IMAGE_FILE_PNG "@128x128");
+  munit_assert_not_null(image);
+  munit_assert_int32(lse_image_get_state(image), ==, LSE_RESOURCE_STATE_READY);
+  munit_assert_int32(lse_image_get_pixel_width(image), ==, 171);
+  munit_assert_int32(lse_image_get_pixel_height(image), ==, 128);
+
+  lse_node_destroy(node);
+  lse_unref(node);
+}
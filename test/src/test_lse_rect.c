@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include <lse_rect.h>
+
+#include <lse_test.h>
+
+struct lse_test_fixture {};
+
+BEFORE_EACH(lse_rect) {
+}
+
+AFTER_EACH(lse_rect) {
+}
+
+TEST_CASE(lse_rect_f_union_1, "should return rect containing both rects") {
+  lse_rect_f a = { 10, 10, 10, 10 };
+  lse_rect_f b = { 0, 15, 5, 20 };
+  lse_rect_f result = lse_rect_f_union(&a, &b);
+
+  munit_assert_float(result.x, ==, 0);
+  munit_assert_float(result.y, ==, 10);
+  munit_assert_float(result.width, ==, 20);
+  munit_assert_float(result.height, ==, 25);
+}
+
+TEST_CASE(lse_rect_f_union_2, "should ignore empty rects") {
+  lse_rect_f a = { 10, 10, 10, 10 };
+  lse_rect_f empty = { 0 };
+  lse_rect_f result = lse_rect_f_union(&empty, &a);
+
+  munit_assert_true(lse_rect_f_equals(&result, &a));
+
+  result = lse_rect_f_union(&a, &empty);
+  munit_assert_true(lse_rect_f_equals(&result, &a));
+
+  result = lse_rect_f_union(&empty, &empty);
+  munit_assert_true(lse_rect_f_is_empty(&result));
+}
+
+TEST_CASE(lse_rect_f_intersects_1, "should test rect intersection") {
+  lse_rect_f a = { 0, 0, 10, 10 };
+  lse_rect_f overlapping = { 5, 5, 10, 10 };
+  lse_rect_f adjacent = { 10, 0, 10, 10 };
+  lse_rect_f empty = { 2, 2, 0, 0 };
+
+  munit_assert_true(lse_rect_f_intersects(&a, &overlapping));
+  munit_assert_false(lse_rect_f_intersects(&a, &adjacent));
+  munit_assert_false(lse_rect_f_intersects(&a, &empty));
+}
+
+TEST_CASE(lse_rect_f_intersect_1, "should return overlapping area of rects") {
+  lse_rect_f a = { 0, 0, 10, 10 };
+  lse_rect_f b = { 5, -5, 10, 10 };
+  lse_rect_f result = lse_rect_f_intersect(&a, &b);
+
+  munit_assert_float(result.x, ==, 5);
+  munit_assert_float(result.y, ==, 0);
+  munit_assert_float(result.width, ==, 5);
+  munit_assert_float(result.height, ==, 5);
+
+  result = lse_rect_f_intersect(&a, &(lse_rect_f){ 20, 20, 10, 10 });
+  munit_assert_true(lse_rect_f_is_empty(&result));
+}
+
+TEST_CASE(lse_rect_f_round_out_1, "should expand rect to whole pixels") {
+  lse_rect_f result = lse_rect_f_round_out(&(lse_rect_f){ 0.5f, 1.25f, 10.f, 2.5f });
+
+  munit_assert_float(result.x, ==, 0);
+  munit_assert_float(result.y, ==, 1);
+  munit_assert_float(result.width, ==, 11);
+  munit_assert_float(result.height, ==, 3);
+}
+
+TEST_CASE(lse_rect_f_round_in_1, "should shrink rect to whole pixels") {
+  lse_rect_f result = lse_rect_f_round_in(&(lse_rect_f){ 0.5f, 1.25f, 10.f, 2.5f });
+
+  munit_assert_float(result.x, ==, 1);
+  munit_assert_float(result.y, ==, 2);
+  munit_assert_float(result.width, ==, 9);
+  munit_assert_float(result.height, ==, 1);
+
+  result = lse_rect_f_round_in(&(lse_rect_f){ 0.25f, 0.25f, 0.5f, 0.5f });
+  munit_assert_true(lse_rect_f_is_empty(&result));
+}
+
+TEST_CASE(lse_rect_f_contains_1, "should check if a rect lies inside another rect") {
+  lse_rect_f a = { 0, 0, 10, 10 };
+
+  munit_assert_true(lse_rect_f_contains(&a, &(lse_rect_f){ 0, 0, 10, 10 }));
+  munit_assert_true(lse_rect_f_contains(&a, &(lse_rect_f){ 2, 2, 5, 5 }));
+  munit_assert_false(lse_rect_f_contains(&a, &(lse_rect_f){ 5, 5, 10, 10 }));
+  munit_assert_false(lse_rect_f_contains(&a, &(lse_rect_f){ 0 }));
+}
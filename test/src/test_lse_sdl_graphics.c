@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include <lse_graphics.h>
+
+#include <lse_env.h>
+#include <lse_object.h>
+#include <lse_test.h>
+#include <string.h>
+
+//
+// types
+//
+
+struct lse_test_fixture {
+  lse_env* env;
+  lse_graphics* graphics;
+  // the env of a mock config has no sdl library. the fake functions below stand in for the renderer.
+  lse_sdl saved_sdl;
+};
+
+typedef struct test_texture {
+  int width;
+  int height;
+} test_texture;
+
+//
+// constants
+//
+
+// a 4x4 grid of 40x40 cells
+const int32_t TEST_GRID_SIZE = 4;
+#define TEST_CELL_SIZE 40.f
+const lse_rect_f TEST_CELL_RECT = { 0, 0, TEST_CELL_SIZE, TEST_CELL_SIZE };
+const lse_color TEST_OPAQUE_COLOR = { .value = 0xFF0000FF };
+const lse_color TEST_TRANSLUCENT_COLOR = { .value = 0xFF000080 };
+
+//
+// fake sdl renderer
+//
+
+static int32_t s_render_geometry_calls = 0;
+static int s_renderer = 0;
+
+static SDL_Renderer* SDLCALL test_create_renderer(SDL_Window* window, int index, Uint32 flags) {
+  return (SDL_Renderer*)&s_renderer;
+}
+
+static void SDLCALL test_destroy_renderer(SDL_Renderer* renderer) {
+}
+
+static int SDLCALL test_get_renderer_info(SDL_Renderer* renderer, SDL_RendererInfo* info) {
+  *info = (SDL_RendererInfo){ .num_texture_formats = 1, .texture_formats = { SDL_PIXELFORMAT_RGBA32 } };
+  return 0;
+}
+
+static int SDLCALL test_get_renderer_output_size(SDL_Renderer* renderer, int* w, int* h) {
+  *w = 1280;
+  *h = 720;
+  return 0;
+}
+
+static int SDLCALL test_get_window_display_index(SDL_Window* window) {
+  return 0;
+}
+
+static int SDLCALL test_get_current_display_mode(int display_index, SDL_DisplayMode* mode) {
+  return -1;
+}
+
+static const char* SDLCALL test_get_pixel_format_name(Uint32 format) {
+  return "SDL_PIXELFORMAT_RGBA32";
+}
+
+static const char* SDLCALL test_get_error(void) {
+  return "";
+}
+
+static SDL_Texture* SDLCALL test_create_texture(SDL_Renderer* renderer, Uint32 format, int access, int w, int h) {
+  test_texture* texture = malloc(sizeof(test_texture));
+
+  texture->width = w;
+  texture->height = h;
+
+  return (SDL_Texture*)texture;
+}
+
+static void SDLCALL test_destroy_texture(SDL_Texture* texture) {
+  free(texture);
+}
+
+static int SDLCALL test_query_texture(SDL_Texture* texture, Uint32* format, int* access, int* w, int* h) {
+  *w = ((test_texture*)texture)->width;
+  *h = ((test_texture*)texture)->height;
+  return 0;
+}
+
+static int SDLCALL test_update_texture(SDL_Texture* texture, const SDL_Rect* rect, const void* pixels, int pitch) {
+  return 0;
+}
+
+static int SDLCALL test_set_texture_blend_mode(SDL_Texture* texture, SDL_BlendMode mode) {
+  return 0;
+}
+
+static int SDLCALL test_set_texture_color_mod(SDL_Texture* texture, Uint8 r, Uint8 g, Uint8 b) {
+  return 0;
+}
+
+static int SDLCALL test_set_texture_alpha_mod(SDL_Texture* texture, Uint8 a) {
+  return 0;
+}
+
+static int SDLCALL test_render_set_clip_rect(SDL_Renderer* renderer, const SDL_Rect* rect) {
+  return 0;
+}
+
+static void SDLCALL test_render_present(SDL_Renderer* renderer) {
+}
+
+static int SDLCALL test_render_copy_ex(
+    SDL_Renderer* renderer,
+    SDL_Texture* texture,
+    const SDL_Rect* src_rect,
+    const SDL_Rect* dest_rect,
+    const double angle,
+    const SDL_Point* center,
+    const SDL_RendererFlip flip) {
+  return 0;
+}
+
+static int SDLCALL test_render_geometry(
+    SDL_Renderer* renderer,
+    SDL_Texture* texture,
+    const SDL_Vertex* vertices,
+    int num_vertices,
+    const int* indices,
+    int num_indices) {
+  s_render_geometry_calls++;
+  return 0;
+}
+
+static void install_test_sdl(lse_sdl* sdl) {
+  memset(sdl, 0, sizeof(lse_sdl));
+
+  sdl->SDL_CreateRenderer = &test_create_renderer;
+  sdl->SDL_DestroyRenderer = &test_destroy_renderer;
+  sdl->SDL_GetRendererInfo = &test_get_renderer_info;
+  sdl->SDL_GetRendererOutputSize = &test_get_renderer_output_size;
+  sdl->SDL_GetWindowDisplayIndex = &test_get_window_display_index;
+  sdl->SDL_GetCurrentDisplayMode = &test_get_current_display_mode;
+  sdl->SDL_GetPixelFormatName = &test_get_pixel_format_name;
+  sdl->SDL_GetError = &test_get_error;
+  sdl->SDL_CreateTexture = &test_create_texture;
+  sdl->SDL_DestroyTexture = &test_destroy_texture;
+  sdl->SDL_QueryTexture = &test_query_texture;
+  sdl->SDL_UpdateTexture = &test_update_texture;
+  sdl->SDL_SetTextureBlendMode = &test_set_texture_blend_mode;
+  sdl->SDL_SetTextureColorMod = &test_set_texture_color_mod;
+  sdl->SDL_SetTextureAlphaMod = &test_set_texture_alpha_mod;
+  sdl->SDL_RenderSetClipRect = &test_render_set_clip_rect;
+  sdl->SDL_RenderPresent = &test_render_present;
+  sdl->SDL_RenderCopyEx = &test_render_copy_ex;
+  sdl->SDL_RenderGeometry = &test_render_geometry;
+}
+
+//
+// helpers
+//
+
+static lse_graphics* create_graphics(struct lse_test_fixture* fixture, bool batch_geometry) {
+  lse_graphics* graphics = (lse_graphics*)lse_object_new(lse_sdl_graphics_type, fixture->env);
+
+  fixture->env->render_settings.batch_geometry = batch_geometry;
+  munit_assert_int(lse_graphics_configure(graphics, NULL), ==, LSE_OK);
+
+  lse_graphics_reset_state(graphics);
+  lse_graphics_begin_render_stats(graphics);
+  lse_graphics_begin(graphics);
+
+  return graphics;
+}
+
+static lse_render_object* create_fill_rect(lse_graphics* graphics, lse_rect_f rect, lse_color color) {
+  lse_graphics_begin_queue(graphics);
+  lse_graphics_queue_fill_rect(graphics, &rect, color);
+
+  return lse_graphics_end_queue(graphics, (int32_t)rect.width, (int32_t)rect.height, NULL);
+}
+
+static lse_render_object* create_rounded_rect(lse_graphics* graphics, lse_rect_f rect) {
+  lse_border_radius corners = { 4, 4, 4, 4 };
+
+  lse_graphics_begin_queue(graphics);
+  lse_graphics_queue_rounded_rect(graphics, &rect, &corners, TEST_OPAQUE_COLOR, 0, TEST_OPAQUE_COLOR);
+
+  return lse_graphics_end_queue(graphics, (int32_t)rect.width, (int32_t)rect.height, NULL);
+}
+
+static void draw_grid(lse_graphics* graphics, lse_render_object* cell) {
+  lse_matrix matrix;
+
+  for (int32_t y = 0; y < TEST_GRID_SIZE; y++) {
+    for (int32_t x = 0; x < TEST_GRID_SIZE; x++) {
+      matrix = lse_matrix_init_translate((float)x * TEST_CELL_SIZE, (float)y * TEST_CELL_SIZE);
+      lse_graphics_set_matrix(graphics, &matrix);
+      lse_graphics_draw_render_object(graphics, cell, TEST_OPAQUE_COLOR);
+    }
+  }
+
+  matrix = lse_matrix_init();
+  lse_graphics_set_matrix(graphics, &matrix);
+}
+
+static uint64_t end_frame_draw_calls(lse_graphics* graphics) {
+  lse_graphics_end(graphics);
+
+  return lse_graphics_get_render_stats(graphics, false)->draw_calls;
+}
+
+BEFORE_EACH(lse_sdl_graphics) {
+  fixture->env = lse_test_env_new();
+  fixture->saved_sdl = fixture->env->sdl;
+  install_test_sdl(&fixture->env->sdl);
+  s_render_geometry_calls = 0;
+}
+
+AFTER_EACH(lse_sdl_graphics) {
+  if (fixture->graphics) {
+    lse_graphics_destroy(fixture->graphics);
+    lse_unref(fixture->graphics);
+  }
+
+  fixture->env->sdl = fixture->saved_sdl;
+  lse_test_env_drop(fixture->env);
+}
+
+TEST_CASE(lse_sdl_graphics_batch_1, "should draw a grid of same texture quads with one draw call") {
+  lse_graphics* graphics = fixture->graphics = create_graphics(fixture, true);
+  lse_render_object* cell = create_fill_rect(graphics, TEST_CELL_RECT, TEST_OPAQUE_COLOR);
+
+  draw_grid(graphics, cell);
+
+  munit_assert_uint64(end_frame_draw_calls(graphics), ==, 1);
+  munit_assert_int32(s_render_geometry_calls, ==, 1);
+
+  lse_graphics_destroy_render_object(graphics, cell);
+}
+
+TEST_CASE(lse_sdl_graphics_batch_2, "should draw one call per quad when geometry batching is disabled") {
+  lse_graphics* graphics = fixture->graphics = create_graphics(fixture, false);
+  lse_render_object* cell = create_fill_rect(graphics, TEST_CELL_RECT, TEST_OPAQUE_COLOR);
+
+  draw_grid(graphics, cell);
+
+  munit_assert_uint64(end_frame_draw_calls(graphics), ==, TEST_GRID_SIZE * TEST_GRID_SIZE);
+  munit_assert_int32(s_render_geometry_calls, ==, 0);
+
+  lse_graphics_destroy_render_object(graphics, cell);
+}
+
+TEST_CASE(lse_sdl_graphics_batch_3, "should break the batch on texture change") {
+  lse_graphics* graphics = fixture->graphics = create_graphics(fixture, true);
+  // translucent, so the fill rects blend like the rounded rect texture and only the texture differs
+  lse_render_object* fill = create_fill_rect(graphics, TEST_CELL_RECT, TEST_TRANSLUCENT_COLOR);
+  lse_render_object* rounded = create_rounded_rect(graphics, TEST_CELL_RECT);
+
+  munit_assert_not_null(rounded);
+
+  lse_graphics_draw_render_object(graphics, fill, TEST_TRANSLUCENT_COLOR);
+  lse_graphics_draw_render_object(graphics, fill, TEST_TRANSLUCENT_COLOR);
+  lse_graphics_draw_render_object(graphics, rounded, TEST_OPAQUE_COLOR);
+  lse_graphics_draw_render_object(graphics, fill, TEST_TRANSLUCENT_COLOR);
+
+  munit_assert_uint64(end_frame_draw_calls(graphics), ==, 3);
+  munit_assert_int32(s_render_geometry_calls, ==, 3);
+
+  lse_graphics_destroy_render_object(graphics, fill);
+  lse_graphics_destroy_render_object(graphics, rounded);
+}
+
+TEST_CASE(lse_sdl_graphics_batch_4, "should break the batch on blend mode change") {
+  lse_graphics* graphics = fixture->graphics = create_graphics(fixture, true);
+  lse_render_object* fill = create_fill_rect(graphics, TEST_CELL_RECT, TEST_OPAQUE_COLOR);
+
+  // same fill texture: opaque draws skip blending, translucent draws blend
+  lse_graphics_draw_render_object(graphics, fill, TEST_OPAQUE_COLOR);
+  lse_graphics_draw_render_object(graphics, fill, TEST_OPAQUE_COLOR);
+  lse_graphics_draw_render_object(graphics, fill, TEST_TRANSLUCENT_COLOR);
+  lse_graphics_draw_render_object(graphics, fill, TEST_OPAQUE_COLOR);
+
+  munit_assert_uint64(end_frame_draw_calls(graphics), ==, 3);
+  munit_assert_int32(s_render_geometry_calls, ==, 3);
+
+  lse_graphics_destroy_render_object(graphics, fill);
+}
+
+TEST_CASE(lse_sdl_graphics_batch_5, "should break the batch on clip rect change") {
+  lse_graphics* graphics = fixture->graphics = create_graphics(fixture, true);
+  lse_render_object* fill = create_fill_rect(graphics, TEST_CELL_RECT, TEST_OPAQUE_COLOR);
+
+  lse_graphics_draw_render_object(graphics, fill, TEST_OPAQUE_COLOR);
+  lse_graphics_draw_render_object(graphics, fill, TEST_OPAQUE_COLOR);
+  lse_graphics_push_state(graphics);
+  lse_graphics_set_clip_rect(graphics, &(lse_rect_f){ 0, 0, 20, 20 });
+  lse_graphics_draw_render_object(graphics, fill, TEST_OPAQUE_COLOR);
+  lse_graphics_pop_state(graphics);
+  lse_graphics_draw_render_object(graphics, fill, TEST_OPAQUE_COLOR);
+
+  munit_assert_uint64(end_frame_draw_calls(graphics), ==, 3);
+  munit_assert_uint64(lse_graphics_get_render_stats(graphics, false)->clip_rect_changes, ==, 2);
+  munit_assert_int32(s_render_geometry_calls, ==, 3);
+
+  lse_graphics_destroy_render_object(graphics, fill);
+}
+
+TEST_CASE(lse_sdl_graphics_batch_6, "should not count a draw call for a clip rect change without pending draws") {
+  lse_graphics* graphics = fixture->graphics = create_graphics(fixture, true);
+
+  lse_graphics_set_clip_rect(graphics, &(lse_rect_f){ 0, 0, 20, 20 });
+  lse_graphics_set_clip_rect(graphics, &(lse_rect_f){ 0, 0, 40, 40 });
+
+  munit_assert_uint64(end_frame_draw_calls(graphics), ==, 0);
+  munit_assert_int32(s_render_geometry_calls, ==, 0);
+}
@@ -122,6 +122,7 @@ TEST_CASE(lse_style_from_string_3, "should parse enum values") {
   from_string_enum_input input[] = {
     { LSE_SP_ALIGN_ITEMS, "center", LSE_STYLE_ALIGN_CENTER },
     { LSE_SP_ALIGN_ITEMS, "CENTER", LSE_STYLE_ALIGN_CENTER },
+    { LSE_SP_WILL_CHANGE, "transform", LSE_STYLE_WILL_CHANGE_TRANSFORM },
   };
 
   for (size_t i = 0; i < c_arraylen(input); i++) {
@@ -89,6 +89,111 @@ TEST_CASE(lse_text_measure_3, "should return 0 size for empty string") {
   munit_assert_float(size.height, ==, 0.f);
 }
 
+TEST_CASE(lse_text_measure_4, "should measure from cached font metrics after warm up") {
+  lse_size first;
+  lse_size second;
+  lse_metrics_cache_stats before;
+  lse_metrics_cache_stats after;
+  lse_string* str = lse_string_new("The quick brown fox jumps over the lazy dog");
+
+  lse_text_measure(str, &fixture->style, &first);
+  lse_font_get_metrics_cache_stats(fixture->style.font, &before);
+  lse_text_measure(str, &fixture->style, &second);
+  lse_font_get_metrics_cache_stats(fixture->style.font, &after);
+  lse_unref(str);
+
+  munit_assert_uint64(after.misses, ==, before.misses);
+  munit_assert_uint64(after.hits, >, before.hits);
+  munit_assert_true(lse_equals_f(first.width, second.width));
+  munit_assert_true(lse_equals_f(first.height, second.height));
+}
+
+TEST_CASE(lse_text_layout_update_1, "should compute the same size as lse_text_measure") {
+  lse_size size;
+  lse_text_layout layout = lse_text_layout_init();
+  lse_string* str = lse_string_new("mmmm mmmm mmmm\nmm");
+
+  lse_text_measure(str, &fixture->style, &size);
+  munit_assert_true(lse_text_layout_update(&layout, str, &fixture->style));
+  lse_unref(str);
+
+  munit_assert_true(lse_equals_f(layout.size.width, size.width));
+  munit_assert_true(lse_equals_f(layout.size.height, size.height));
+  lse_text_layout_drop(&layout);
+}
+
+TEST_CASE(lse_text_layout_update_2, "should reuse layout when inputs are unchanged") {
+  lse_text_layout layout = lse_text_layout_init();
+  lse_string* str = lse_string_new("mmmm mmmm");
+
+  munit_assert_true(lse_text_layout_update(&layout, str, &fixture->style));
+  munit_assert_false(lse_text_layout_update(&layout, str, &fixture->style));
+
+  lse_text_layout_invalidate(&layout);
+  munit_assert_true(lse_text_layout_update(&layout, str, &fixture->style));
+
+  lse_unref(str);
+  lse_text_layout_drop(&layout);
+}
+
+TEST_CASE(lse_text_layout_update_3, "should recompute layout when text or wrap width changes") {
+  lse_text_layout layout = lse_text_layout_init();
+  lse_string* str = lse_string_new("mmmm mmmm");
+  lse_string* other = lse_string_new("mmmm mmmm");
+
+  lse_text_layout_update(&layout, str, &fixture->style);
+
+  fixture->style.context_box.width *= 2.f;
+  munit_assert_true(lse_text_layout_update(&layout, str, &fixture->style));
+  munit_assert_true(lse_text_layout_update(&layout, other, &fixture->style));
+
+  lse_unref(str);
+  lse_unref(other);
+  lse_text_layout_drop(&layout);
+}
+
+TEST_CASE(lse_text_layout_update_4, "should reuse layout at a narrower wrap width that fits the longest line") {
+  lse_text_layout layout = lse_text_layout_init();
+  lse_string* str = lse_string_new("mmmm mmmm");
+
+  lse_text_layout_update(&layout, str, &fixture->style);
+
+  fixture->style.context_box.width = layout.size.width;
+  munit_assert_false(lse_text_layout_update(&layout, str, &fixture->style));
+
+  fixture->style.context_box.width = layout.size.width - 1.f;
+  munit_assert_true(lse_text_layout_update(&layout, str, &fixture->style));
+
+  lse_unref(str);
+  lse_text_layout_drop(&layout);
+}
+
+TEST_CASE(lse_text_layout_update_5, "should store glyph positions per line, skipping whitespace") {
+  const lse_text_layout_line* line;
+  lse_text_layout layout = lse_text_layout_init();
+  lse_string* str = lse_string_new("mm mmmm");
+
+  // room for "mm", but not "mm mmmm"
+  fixture->style.context_box.width = compute_width(fixture, 2, 1) + 0.5f;
+  lse_text_layout_update(&layout, str, &fixture->style);
+  lse_unref(str);
+
+  munit_assert_size(lse_text_layout_get_line_count(&layout), ==, 2);
+
+  line = lse_text_layout_get_line(&layout, 0);
+  munit_assert_int32(line->glyph_start, ==, 0);
+  munit_assert_int32(line->glyph_count, ==, 2);
+  munit_assert_float(lse_text_layout_get_glyph(&layout, 0)->x, ==, 0.f);
+  munit_assert_float(lse_text_layout_get_glyph(&layout, 1)->x, >, 0.f);
+
+  line = lse_text_layout_get_line(&layout, 1);
+  munit_assert_int32(line->glyph_start, ==, 2);
+  munit_assert_int32(line->glyph_count, ==, 4);
+  munit_assert_uint32(lse_text_layout_get_glyph(&layout, 2)->codepoint, ==, 'm');
+
+  lse_text_layout_drop(&layout);
+}
+
 static float compute_width(lse_test_fixture* fixture, int32_t m_count, int32_t space_count) {
   lse_font_use_font_size(fixture->style.font, fixture->style.font_size_px);
 
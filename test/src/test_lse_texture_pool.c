@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2022 Light Source Software, LLC. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software distributed under the License is distributed on
+ * an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the License for the
+ * specific language governing permissions and limitations under the License.
+ */
+
+#include <lse_texture_pool.h>
+
+#include <lse_test.h>
+
+//
+// types
+//
+
+struct lse_test_fixture {
+  lse_texture_pool pool;
+  int32_t created;
+  int32_t destroyed;
+  // fake texture handles
+  int32_t handles[16];
+};
+
+//
+// constants
+//
+
+const int32_t TEST_ACCESS = 1;
+// room for two 64x64 textures
+const int64_t TEST_MAX_POOLED_BYTES = 2 * 64 * 64 * 4;
+
+static void* test_create(void* user_data, int32_t access, int32_t width, int32_t height) {
+  struct lse_test_fixture* fixture = user_data;
+
+  return &fixture->handles[fixture->created++];
+}
+
+static void test_destroy(void* user_data, void* texture) {
+  ((struct lse_test_fixture*)user_data)->destroyed++;
+}
+
+BEFORE_EACH(lse_texture_pool) {
+  fixture->pool = lse_texture_pool_init(&test_create, &test_destroy, fixture, TEST_MAX_POOLED_BYTES);
+}
+
+AFTER_EACH(lse_texture_pool) {
+  lse_texture_pool_drop(&fixture->pool);
+}
+
+TEST_CASE(lse_texture_pool_get_bucket_size_1, "should round small sizes up to a power of two") {
+  munit_assert_int32(lse_texture_pool_get_bucket_size(0), ==, 0);
+  munit_assert_int32(lse_texture_pool_get_bucket_size(1), ==, 8);
+  munit_assert_int32(lse_texture_pool_get_bucket_size(100), ==, 128);
+  munit_assert_int32(lse_texture_pool_get_bucket_size(128), ==, 128);
+  munit_assert_int32(lse_texture_pool_get_bucket_size(256), ==, 256);
+}
+
+TEST_CASE(lse_texture_pool_get_bucket_size_2, "should round large sizes up to a multiple of 64") {
+  munit_assert_int32(lse_texture_pool_get_bucket_size(257), ==, 320);
+  munit_assert_int32(lse_texture_pool_get_bucket_size(1280), ==, 1280);
+  munit_assert_int32(lse_texture_pool_get_bucket_size(1281), ==, 1344);
+}
+
+TEST_CASE(lse_texture_pool_acquire_1, "should create a bucket sized texture on miss") {
+  lse_pooled_texture texture = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 100, 20);
+
+  munit_assert_not_null(texture.handle);
+  munit_assert_int32(texture.width, ==, 128);
+  munit_assert_int32(texture.height, ==, 32);
+  munit_assert_int32(fixture->created, ==, 1);
+  munit_assert_uint64(fixture->pool.stats.misses, ==, 1);
+  munit_assert_int64(fixture->pool.stats.resident_bytes, ==, 128 * 32 * 4);
+
+  lse_texture_pool_release(&fixture->pool, &texture);
+}
+
+TEST_CASE(lse_texture_pool_acquire_2, "should reuse released texture for a size in the same bucket") {
+  lse_pooled_texture first = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 40, 40);
+
+  lse_texture_pool_release(&fixture->pool, &first);
+
+  lse_pooled_texture second = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 41, 39);
+
+  munit_assert_ptr_equal(second.handle, first.handle);
+  munit_assert_int32(fixture->created, ==, 1);
+  munit_assert_uint64(fixture->pool.stats.hits, ==, 1);
+  munit_assert_int64(fixture->pool.stats.pooled_bytes, ==, 0);
+
+  lse_texture_pool_release(&fixture->pool, &second);
+}
+
+TEST_CASE(lse_texture_pool_acquire_3, "should not reuse texture with a different access") {
+  lse_pooled_texture first = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 40, 40);
+
+  lse_texture_pool_release(&fixture->pool, &first);
+
+  lse_pooled_texture second = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS + 1, 40, 40);
+
+  munit_assert_ptr_not_equal(second.handle, first.handle);
+  munit_assert_int32(fixture->created, ==, 2);
+
+  lse_texture_pool_release(&fixture->pool, &second);
+}
+
+TEST_CASE(lse_texture_pool_release_1, "should evict least recently released texture when over budget") {
+  lse_pooled_texture a = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 64, 64);
+  lse_pooled_texture b = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 64, 64);
+  lse_pooled_texture c = lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 64, 64);
+
+  lse_texture_pool_release(&fixture->pool, &a);
+  lse_texture_pool_release(&fixture->pool, &b);
+  lse_texture_pool_release(&fixture->pool, &c);
+
+  munit_assert_int32(fixture->destroyed, ==, 1);
+  munit_assert_int64(fixture->pool.stats.pooled_bytes, ==, TEST_MAX_POOLED_BYTES);
+  munit_assert_int64(fixture->pool.stats.resident_bytes, ==, TEST_MAX_POOLED_BYTES);
+  munit_assert_ptr_equal(lse_texture_pool_acquire(&fixture->pool, TEST_ACCESS, 64, 64).handle, c.handle);
+}
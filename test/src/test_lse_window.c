@@ -13,6 +13,7 @@
 
 #include <lse_window.h>
 
+#include <lse_node.h>
 #include <lse_test.h>
 
 struct lse_test_fixture {
@@ -49,11 +50,12 @@ TEST_CASE(lse_window_reset_1, "should return settings for configured window") {
 
   lse_window_configure(fixture->window, &settings);
 
+  munit_assert_int32(lse_window_get_refresh_rate(fixture->window), ==, 60);
+  munit_assert_int32(lse_window_get_flags(fixture->window), ==, LSE_WINDOW_FLAG_VSYNC);
+
   // TODO: implement!
   //  munit_assert_int32(lse_window_get_width(fixture->window), ==, 1280);
   //  munit_assert_int32(lse_window_get_height(fixture->window), ==, 720);
-  //  munit_assert_int32(lse_window_get_refresh_rate(fixture->window), ==, 60);
-  //  munit_assert_int32(lse_window_get_flags(fixture->window), ==, 0);
 }
 
 TEST_CASE(lse_window_reset_2, "should return 0 values for un-configured window") {
@@ -62,3 +64,112 @@ TEST_CASE(lse_window_reset_2, "should return 0 values for un-configured window")
   munit_assert_int32(lse_window_get_refresh_rate(fixture->window), ==, 0);
   munit_assert_int32(lse_window_get_flags(fixture->window), ==, 0);
 }
+
+TEST_CASE(lse_window_present_1, "should skip frames when the scene graph is clean") {
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+
+  lse_window_configure(fixture->window, &settings);
+
+  lse_window_present(fixture->window);
+  munit_assert_uint64(lse_window_get_skipped_frame_count(fixture->window), ==, 0);
+
+  lse_window_present(fixture->window);
+  lse_window_present(fixture->window);
+  munit_assert_uint64(lse_window_get_skipped_frame_count(fixture->window), ==, 2);
+}
+
+TEST_CASE(lse_window_present_2, "should present frame after a composite request") {
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+
+  lse_window_configure(fixture->window, &settings);
+  lse_window_present(fixture->window);
+
+  lse_node_request_composite(lse_window_get_root(fixture->window));
+  lse_window_present(fixture->window);
+
+  munit_assert_uint64(lse_window_get_skipped_frame_count(fixture->window), ==, 0);
+}
+
+TEST_CASE(lse_window_present_3, "should count nodes culled outside of the window") {
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+  lse_node* node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_window_configure(fixture->window, &settings);
+  lse_node_append(lse_window_get_root(fixture->window), node);
+
+  // the mock graphics has no area, so nothing in the scene graph is visible
+  lse_window_present(fixture->window);
+
+  munit_assert_uint32(lse_window_get_culled_node_count(fixture->window), ==, 2);
+
+  lse_unref(node);
+}
+
+TEST_CASE(lse_window_invalidate_1, "should present a frame after the window was invalidated") {
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+
+  lse_window_configure(fixture->window, &settings);
+  lse_window_present(fixture->window);
+
+  lse_window_invalidate(fixture->window);
+
+  munit_assert_true(lse_window_present(fixture->window));
+  munit_assert_uint64(lse_window_get_skipped_frame_count(fixture->window), ==, 0);
+}
+
+TEST_CASE(lse_window_get_render_stats_1, "should count render objects per frame and cumulatively") {
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+  lse_render_stats frame;
+  lse_render_stats total;
+
+  lse_window_configure(fixture->window, &settings);
+  lse_style_set_color(lse_node_get_style(node), LSE_SP_BACKGROUND_COLOR, 0xFFFFFFFF);
+  lse_node_append(root, node);
+
+  lse_window_present(fixture->window);
+  lse_window_get_render_stats(fixture->window, false, &frame);
+  munit_assert_int32(frame.render_object_count, ==, 1);
+
+  // destroying the node releases its render object
+  lse_node_destroy(node);
+  lse_window_get_render_stats(fixture->window, true, &total);
+  munit_assert_int32(total.render_object_count, ==, 0);
+
+  // the last presented frame is not updated until the next present
+  lse_window_get_render_stats(fixture->window, false, &frame);
+  munit_assert_int32(frame.render_object_count, ==, 1);
+
+  lse_unref(node);
+}
+
+TEST_CASE(lse_window_begin_batch_1, "should defer inline layout until the batch ends") {
+  lse_window_settings settings = { .width = 1280, .height = 720 };
+  lse_node* root = lse_window_get_root(fixture->window);
+  lse_node* node = lse_window_create_node_from_tag(fixture->window, LSE_NODE_TAG_BOX);
+
+  lse_window_configure(fixture->window, &settings);
+  lse_window_begin_batch(fixture->window);
+  lse_window_begin_batch(fixture->window);
+
+  lse_node_append(root, node);
+  munit_assert_true(YGNodeIsDirty(lse_node_get_base(root)->yg_node));
+
+  lse_window_end_batch(fixture->window);
+  munit_assert_true(YGNodeIsDirty(lse_node_get_base(root)->yg_node));
+
+  lse_window_end_batch(fixture->window);
+  munit_assert_false(YGNodeIsDirty(lse_node_get_base(root)->yg_node));
+
+  lse_unref(node);
+}
+
+TEST_CASE(lse_window_get_image_store_1, "should share the image store with the other windows of the env") {
+  lse_window* other = lse_env_add_window(fixture->env);
+
+  munit_assert_not_null(lse_window_get_image_store(fixture->window));
+  munit_assert_ptr_equal(lse_window_get_image_store(fixture->window), lse_window_get_image_store(other));
+
+  lse_unref(other);
+}